@@ -22,6 +22,7 @@
 #include <thread>
 
 #include "common_event_listener.h"
+#include "common_event_wire_format.h"
 #include "icommon_event.h"
 
 namespace OHOS {
@@ -132,6 +133,14 @@ public:
      */
     bool FinishReceiver(
         const sptr<IRemoteObject> &proxy, const int32_t &code, const std::string &data, const bool &abortEvent);
+
+    /**
+     * Acknowledges events handled by a subscriber, returning delivery credit to the service.
+     *
+     * @param commonEventListener Indicates the common event listener of the subscriber.
+     * @param count Indicates the number of events handled since the last acknowledgement.
+     */
+    void AckEvents(const sptr<IRemoteObject> &commonEventListener, uint32_t count);
 #ifdef CEM_SUPPORT_DUMP
     /**
      * Dumps state of common event service.
@@ -198,6 +207,12 @@ public:
      */
     bool Resubscribe();
 
+    /**
+     * Forgets the wire format negotiated with the service, called when the service dies so that the next
+     * instance negotiates again.
+     */
+    void ResetWireFormat();
+
     /**
      * Set static subscriber state.
      *
@@ -224,6 +239,16 @@ private:
      */
     sptr<ICommonEvent> GetCommonEventProxy();
 
+    /**
+     * Negotiates the wire format with the service once per service instance, later calls only compare the
+     * service object. The version is only used for parcels sent through this proxy, within a
+     * CommonEventWireFormat::Scope.
+     *
+     * @param proxy Indicates the common event proxy.
+     * @return Returns the version agreed with the service.
+     */
+    int32_t NegotiateWireFormat(const sptr<ICommonEvent> &proxy);
+
     /**
      * Gets common evenet listener.
      *
@@ -255,6 +280,10 @@ private:
     static std::shared_ptr<CommonEvent> instance_;
     std::mutex eventListenersMutex_;
     std::map<std::shared_ptr<CommonEventSubscriber>, sptr<CommonEventListener>> eventListeners_;
+    std::mutex wireFormatMutex_;
+    // held so that its address cannot be reused by the proxy of a restarted service
+    sptr<IRemoteObject> negotiatedService_ = nullptr;
+    int32_t serviceVersion_ = CommonEventWireFormat::VERSION_UTF16;
     const size_t SUBSCRIBER_MAX_SIZE = 200;
     static const uint8_t ALREADY_SUBSCRIBED = 0;
     static const uint8_t INITIAL_SUBSCRIPTION = 1;
@@ -53,7 +53,10 @@ enum DumpEventType {
     SUBSCRIBER,
     STICKY,
     PENDING,
-    HISTORY
+    HISTORY,
+    METRICS,
+    STRUCTURED,
+    MEMORY
 };
 }  // namespace EventFwk
 }  // namespace OHOS
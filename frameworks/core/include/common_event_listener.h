@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_EVENT_CESFWK_INNERKITS_INCLUDE_COMMON_EVENT_LISTENER_H
 #define FOUNDATION_EVENT_CESFWK_INNERKITS_INCLUDE_COMMON_EVENT_LISTENER_H
 
+#include <atomic>
 #include <mutex>
 
 #include "common_event_subscriber.h"
@@ -64,6 +65,8 @@ private:
 
     void OnReceiveEvent(const CommonEventData &commonEventData, const bool &ordered, const bool &sticky);
 
+    void AckReceivedEvent();
+
 public:
     static std::shared_ptr<EventRunner> commonRunner_;
 
@@ -73,6 +76,7 @@ private:
     std::shared_ptr<EventRunner> runner_;
     std::shared_ptr<EventHandler> handler_;
     void *listenerQueue_ = nullptr;
+    std::atomic<uint32_t> unackedCount_ {0};
 };
 }  // namespace EventFwk
 }  // namespace OHOS
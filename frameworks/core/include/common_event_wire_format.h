@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_CORE_INCLUDE_COMMON_EVENT_WIRE_FORMAT_H
+#define FOUNDATION_EVENT_CESFWK_CORE_INCLUDE_COMMON_EVENT_WIRE_FORMAT_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "parcel.h"
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Wire format of the common event parcelables.
+ *
+ * VERSION_UTF16 is the original format which converts every string to UTF-16. VERSION_UTF8 writes the
+ * std::string fields directly as length-prefixed UTF-8 and starts with UTF8_TAG, so readers accept both
+ * formats. Writers only use VERSION_UTF8 inside a Scope, i.e. for a peer that agreed to it through
+ * NegotiateWireFormat; parcels written anywhere else keep VERSION_UTF16.
+ */
+class CommonEventWireFormat {
+public:
+    static constexpr int32_t VERSION_UTF16 = 1;
+    static constexpr int32_t VERSION_UTF8 = 2;
+    static constexpr int32_t VERSION_CURRENT = VERSION_UTF8;
+
+    /**
+     * Gets the version used to write parcels on the current thread.
+     *
+     * @return Returns the scoped version if set; otherwise VERSION_UTF16.
+     */
+    static int32_t GetWriteVersion();
+
+    /**
+     * Records the version supported by a client process. Used by the service only.
+     *
+     * @param pid Indicates the process id of the client.
+     * @param uid Indicates the user id of the client.
+     * @param version Indicates the version supported by the client.
+     * @return Returns the version both sides agree on.
+     */
+    static int32_t SetClientVersion(pid_t pid, uid_t uid, int32_t version);
+
+    /**
+     * Gets the version supported by a client process. Used by the service only.
+     *
+     * @param pid Indicates the process id of the client.
+     * @param uid Indicates the user id of the client.
+     * @return Returns the agreed version, VERSION_UTF16 if the client never negotiated.
+     */
+    static int32_t GetClientVersion(pid_t pid, uid_t uid);
+
+    /**
+     * Forgets the version of a client process whose listener died. Used by the service only.
+     *
+     * @param pid Indicates the process id of the client.
+     * @param uid Indicates the user id of the client.
+     */
+    static void RemoveClientVersion(pid_t pid, uid_t uid);
+
+    /**
+     * Writes the tag that starts a VERSION_UTF8 parcelable.
+     *
+     * @param parcel Indicates specified Parcel object.
+     * @return Returns true if success; false otherwise.
+     */
+    static bool WriteTag(Parcel &parcel);
+
+    /**
+     * Consumes the VERSION_UTF8 tag if present; otherwise leaves the read position unchanged.
+     *
+     * @param parcel Indicates specified Parcel object.
+     * @return Returns true if the parcelable is written in VERSION_UTF8.
+     */
+    static bool ReadTag(Parcel &parcel);
+
+    /**
+     * Sets the write version of the current thread while in scope, e.g. when the client calls the service
+     * or the service notifies a receiver whose process negotiated a different version.
+     */
+    class Scope {
+    public:
+        explicit Scope(int32_t version);
+        ~Scope();
+
+    private:
+        int32_t previous_;
+    };
+
+private:
+    static constexpr int32_t UTF8_TAG = 0x43455538;  // "CEU8"
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_CORE_INCLUDE_COMMON_EVENT_WIRE_FORMAT_H
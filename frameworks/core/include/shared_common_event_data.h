@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_CORE_INCLUDE_SHARED_COMMON_EVENT_DATA_H
+#define FOUNDATION_EVENT_CESFWK_CORE_INCLUDE_SHARED_COMMON_EVENT_DATA_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ashmem.h"
+#include "common_event_data.h"
+#include "message_parcel.h"
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Common event data forwarded by the service to many receivers.
+ *
+ * The first marshalling writes the want inline as usual and keeps what it wrote: the bytes when the want is at
+ * most SHARED_PAYLOAD_THRESHOLD, otherwise a read-only shared memory region. Later marshallings copy those bytes
+ * or only carry the region handle, so the want is marshalled once per event instead of once per receiver.
+ * The want must not be changed once the object has been marshalled.
+ */
+class SharedCommonEventData : public CommonEventData {
+public:
+    /**
+     * Creates a SharedCommonEventData instance holding a copy of the event.
+     *
+     * @param data Indicates the common event data.
+     */
+    explicit SharedCommonEventData(const CommonEventData &data);
+
+    ~SharedCommonEventData() override;
+
+    /**
+     * Marshals the common event data into a Parcel, reusing the want marshalled by the first call.
+     *
+     * @param parcel Indicates specified Parcel object.
+     * @return Returns true if success; false otherwise.
+     */
+    bool Marshalling(Parcel &parcel) const override;
+
+    /**
+     * Creates a read-only shared memory region holding a marshalled want.
+     *
+     * @param content Indicates the marshalled want.
+     * @param size Indicates the size of the marshalled want.
+     * @return Returns the region, nullptr if it can not be created.
+     */
+    static sptr<Ashmem> CreateSharedPayload(const void *content, size_t size);
+
+    /**
+     * Writes a want carried by a shared memory region.
+     *
+     * @param parcel Indicates specified MessageParcel object.
+     * @param payload Indicates the region holding the marshalled want.
+     * @return Returns true if success; false otherwise.
+     */
+    static bool WriteSharedWant(MessageParcel &parcel, const sptr<Ashmem> &payload);
+
+private:
+    bool WriteAndKeepWant(Parcel &parcel) const;
+
+    mutable std::mutex wantMutex_;
+    // set once the want has been marshalled, the want is not kept if it carries binder objects
+    mutable bool wantMarshalled_ = false;
+    mutable sptr<Ashmem> wantPayload_;
+    mutable std::shared_ptr<const std::vector<uint8_t>> wantBytes_;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_CORE_INCLUDE_SHARED_COMMON_EVENT_DATA_H
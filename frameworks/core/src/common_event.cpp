@@ -16,6 +16,7 @@
 #include "common_event.h"
 #include "common_event_constant.h"
 #include "common_event_death_recipient.h"
+#include "common_event_wire_format.h"
 #include "event_log_wrapper.h"
 #include "event_trace_wrapper.h"
 #include "hitrace_meter_adapter.h"
@@ -66,6 +67,7 @@ bool CommonEvent::PublishCommonEvent(const CommonEventData &data, const CommonEv
     if (!proxy) {
         return false;
     }
+    CommonEventWireFormat::Scope wireFormat(NegotiateWireFormat(proxy));
     int32_t funcResult = -1;
     auto res = -1;
     if (subscriber == nullptr) {
@@ -93,6 +95,7 @@ int32_t CommonEvent::PublishCommonEventAsUser(const CommonEventData &data, const
     if (!proxy) {
         return ERR_NOTIFICATION_CES_COMMON_PARAM_INVALID;
     }
+    CommonEventWireFormat::Scope wireFormat(NegotiateWireFormat(proxy));
     int32_t funcResult = -1;
     auto res = -1;
     if (subscriber == nullptr) {
@@ -120,6 +123,7 @@ bool CommonEvent::PublishCommonEvent(const CommonEventData &data, const CommonEv
     if (!proxy) {
         return false;
     }
+    CommonEventWireFormat::Scope wireFormat(NegotiateWireFormat(proxy));
     bool funcResult = false;
     auto res = -1;
     if (subscriber == nullptr) {
@@ -149,6 +153,7 @@ bool CommonEvent::PublishCommonEventAsUser(const CommonEventData &data, const Co
     if (!proxy) {
         return false;
     }
+    CommonEventWireFormat::Scope wireFormat(NegotiateWireFormat(proxy));
     bool funcResult = false;
     auto res = -1;
     if (subscriber == nullptr) {
@@ -193,6 +198,7 @@ int32_t CommonEvent::SubscribeOrUpdate(const std::shared_ptr<CommonEventSubscrib
 {
     sptr<IRemoteObject> commonEventListener = nullptr;
     uint8_t subscribeState = CreateCommonEventListener(subscriber, commonEventListener);
+    CommonEventWireFormat::Scope wireFormat(NegotiateWireFormat(proxy));
     int32_t funcResult = -1;
     if (subscribeState == INITIAL_SUBSCRIPTION) {
         auto res = proxy->SubscribeCommonEvent(subscriber->GetSubscribeInfo(),
@@ -200,7 +206,10 @@ int32_t CommonEvent::SubscribeOrUpdate(const std::shared_ptr<CommonEventSubscrib
         if (res != ERR_OK) {
             funcResult = ERR_NOTIFICATION_CES_COMMON_PARAM_INVALID;
         }
-        if (funcResult != ERR_OK) {
+        if (funcResult == ERR_OK) {
+            // opts the listener into credit based flow control, the service never throttles silent listeners
+            proxy->AckEvents(commonEventListener, 0);
+        } else {
             EVENT_LOGD(LOG_TAG_CES, "subscribe common event failed, remove event listener");
             sptr<CommonEventListener> listenerToStop = nullptr;
             {
@@ -240,7 +249,8 @@ int32_t CommonEvent::Subscribe(
         EVENT_LOGE(LOG_TAG_CES, "the subscriber is null");
         return ERR_NOTIFICATION_CES_COMMON_PARAM_INVALID;
     }
-    if (subscriber->GetSubscribeInfo().GetMatchingSkills().CountEvent() == 0) {
+    const MatchingSkills &matchingSkills = subscriber->GetSubscribeInfo().GetMatchingSkills();
+    if (matchingSkills.CountEvent() == 0 && matchingSkills.CountEventPrefixes() == 0) {
         EVENT_LOGE(LOG_TAG_CES, "the subscriber has no event");
         return ERR_NOTIFICATION_CES_COMMON_PARAM_INVALID;
     }
@@ -263,7 +273,8 @@ __attribute__((no_sanitize("cfi"))) int32_t CommonEvent::SubscribeCommonEvent(
         return ERR_NOTIFICATION_CES_COMMON_PARAM_INVALID;
     }
 
-    if (subscriber->GetSubscribeInfo().GetMatchingSkills().CountEvent() == 0) {
+    const MatchingSkills &matchingSkills = subscriber->GetSubscribeInfo().GetMatchingSkills();
+    if (matchingSkills.CountEvent() == 0 && matchingSkills.CountEventPrefixes() == 0) {
         EVENT_LOGE(LOG_TAG_CES, "the subscriber has no event");
         return ERR_NOTIFICATION_CES_COMMON_PARAM_INVALID;
     }
@@ -405,6 +416,20 @@ bool CommonEvent::FinishReceiver(
     }
     return funcResult;
 }
+
+void CommonEvent::AckEvents(const sptr<IRemoteObject> &commonEventListener, uint32_t count)
+{
+    if (commonEventListener == nullptr) {
+        return;
+    }
+    sptr<ICommonEvent> proxy = GetCommonEventProxy();
+    if (!proxy) {
+        return;
+    }
+    if (proxy->AckEvents(commonEventListener, count) != ERR_OK) {
+        EVENT_LOGW(LOG_TAG_CES, "failed to ack %{public}u events", count);
+    }
+}
 #ifdef CEM_SUPPORT_DUMP
 bool CommonEvent::DumpState(const uint8_t &dumpType, const std::string &event, const int32_t &userId,
     std::vector<std::string> &state)
@@ -556,6 +581,34 @@ sptr<ICommonEvent> CommonEvent::GetCommonEventProxy()
     return proxy;
 }
 
+int32_t CommonEvent::NegotiateWireFormat(const sptr<ICommonEvent> &proxy)
+{
+    sptr<IRemoteObject> service = proxy->AsObject();
+    {
+        std::lock_guard<std::mutex> lock(wireFormatMutex_);
+        if (negotiatedService_ == service) {
+            return serviceVersion_;
+        }
+    }
+    int32_t version = CommonEventWireFormat::VERSION_UTF16;
+    if (proxy->NegotiateWireFormat(CommonEventWireFormat::VERSION_CURRENT, version) != ERR_OK) {
+        version = CommonEventWireFormat::VERSION_UTF16;
+    }
+    version = std::clamp(version, CommonEventWireFormat::VERSION_UTF16, CommonEventWireFormat::VERSION_CURRENT);
+    std::lock_guard<std::mutex> lock(wireFormatMutex_);
+    negotiatedService_ = service;
+    serviceVersion_ = version;
+    EVENT_LOGD(LOG_TAG_CES, "wire format %{public}d", version);
+    return version;
+}
+
+void CommonEvent::ResetWireFormat()
+{
+    std::lock_guard<std::mutex> lock(wireFormatMutex_);
+    negotiatedService_ = nullptr;
+    serviceVersion_ = CommonEventWireFormat::VERSION_UTF16;
+}
+
 uint8_t CommonEvent::CreateCommonEventListener(
     const std::shared_ptr<CommonEventSubscriber> &subscriber, sptr<IRemoteObject> &commonEventListener)
 {
@@ -638,6 +691,7 @@ __attribute__((no_sanitize("cfi"))) bool CommonEvent::Resubscribe()
     if (!proxy) {
         return false;
     }
+    CommonEventWireFormat::Scope wireFormat(NegotiateWireFormat(proxy));
 
     std::lock_guard<std::mutex> lock(eventListenersMutex_);
     for (auto it = eventListeners_.begin(); it != eventListeners_.end();) {
@@ -658,6 +712,7 @@ __attribute__((no_sanitize("cfi"))) bool CommonEvent::Resubscribe()
             EVENT_LOGW(LOG_TAG_CES, "subscribe common event failed, remove event listener");
             it = eventListeners_.erase(it);
         } else {
+            proxy->AckEvents(listener, 0);
             it++;
         }
     }
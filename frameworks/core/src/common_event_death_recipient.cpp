@@ -96,6 +96,7 @@ void CommonEventDeathRecipient::SystemAbilityStatusChangeListener::OnRemoveSyste
     int32_t systemAbilityId, const std::string& deviceId)
 {
     EVENT_LOGW(LOG_TAG_CES, "CES died");
+    CommonEvent::GetInstance()->ResetWireFormat();
     std::lock_guard<ffrt::mutex> lock(mutex_);
     isSAOffline_ = true;
 }
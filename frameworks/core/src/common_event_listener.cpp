@@ -14,6 +14,7 @@
  */
 
 #include "common_event_listener.h"
+#include "common_event.h"
 #include "event_log_wrapper.h"
 #include "event_trace_wrapper.h"
 #include "hitrace_meter_adapter.h"
@@ -23,6 +24,9 @@ namespace OHOS {
 namespace EventFwk {
 std::shared_ptr<AppExecFwk::EventRunner> CommonEventListener::commonRunner_ = nullptr;
 std::atomic<int> ffrtIndex = 0;
+namespace {
+constexpr uint32_t ACK_BATCH_SIZE = 16;
+}
 
 CommonEventListener::CommonEventListener(const std::shared_ptr<CommonEventSubscriber> &commonEventSubscriber)
     : commonEventSubscriber_(commonEventSubscriber)
@@ -52,10 +56,13 @@ ErrCode CommonEventListener::NotifyEvent(const CommonEventData &commonEventData,
             return;
         }
         sThis->OnReceiveEvent(commonEventData, ordered, sticky);
+        sThis->AckReceivedEvent();
     };
 
-    if (handler_) {
-        handler_->PostTask(onReceiveEventFunc, "CommonEvent" + commonEventData.GetWant().GetAction());
+    if (handler_ && !handler_->PostTask(onReceiveEventFunc, "CommonEvent" + commonEventData.GetWant().GetAction())) {
+        // the event is dropped, its credit must still go back to the service
+        EVENT_LOGE(LOG_TAG_CES, "Failed to post %{public}s", commonEventData.GetWant().GetAction().c_str());
+        AckReceivedEvent();
     }
 
     if (listenerQueue_) {
@@ -158,6 +165,18 @@ __attribute__((no_sanitize("cfi"))) void CommonEventListener::OnReceiveEvent(
     EVENT_LOGD(LOG_TAG_CES, "end");
 }
 
+void CommonEventListener::AckReceivedEvent()
+{
+    // credit goes back in batches so acknowledgements stay far below the event rate
+    if (unackedCount_.fetch_add(1, std::memory_order_relaxed) + 1 < ACK_BATCH_SIZE) {
+        return;
+    }
+    uint32_t count = unackedCount_.exchange(0, std::memory_order_relaxed);
+    if (count > 0) {
+        CommonEvent::GetInstance()->AckEvents(this, count);
+    }
+}
+
 void CommonEventListener::Stop()
 {
     EVENT_LOGD(LOG_TAG_CES, "enter");
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common_event_wire_format.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+thread_local int32_t g_scopedVersion = 0;
+std::mutex g_clientVersionsMutex;
+std::unordered_map<uint64_t, int32_t> g_clientVersions;
+// clients that never subscribe are never seen dying; once full, an entry is evicted and that client
+// falls back to VERSION_UTF16, which every client reads
+constexpr size_t MAX_CLIENT_NUM = 512;
+
+uint64_t GetClientKey(pid_t pid, uid_t uid)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(uid)) << 32) | static_cast<uint32_t>(pid);
+}
+}
+
+int32_t CommonEventWireFormat::GetWriteVersion()
+{
+    return g_scopedVersion != 0 ? g_scopedVersion : VERSION_UTF16;
+}
+
+int32_t CommonEventWireFormat::SetClientVersion(pid_t pid, uid_t uid, int32_t version)
+{
+    int32_t agreed = std::clamp(version, VERSION_UTF16, VERSION_CURRENT);
+    uint64_t key = GetClientKey(pid, uid);
+    std::lock_guard<std::mutex> lock(g_clientVersionsMutex);
+    if (g_clientVersions.size() >= MAX_CLIENT_NUM && g_clientVersions.find(key) == g_clientVersions.end()) {
+        g_clientVersions.erase(g_clientVersions.begin());
+    }
+    g_clientVersions[key] = agreed;
+    return agreed;
+}
+
+int32_t CommonEventWireFormat::GetClientVersion(pid_t pid, uid_t uid)
+{
+    std::lock_guard<std::mutex> lock(g_clientVersionsMutex);
+    auto it = g_clientVersions.find(GetClientKey(pid, uid));
+    return it == g_clientVersions.end() ? VERSION_UTF16 : it->second;
+}
+
+void CommonEventWireFormat::RemoveClientVersion(pid_t pid, uid_t uid)
+{
+    std::lock_guard<std::mutex> lock(g_clientVersionsMutex);
+    g_clientVersions.erase(GetClientKey(pid, uid));
+}
+
+bool CommonEventWireFormat::WriteTag(Parcel &parcel)
+{
+    return parcel.WriteInt32(UTF8_TAG);
+}
+
+bool CommonEventWireFormat::ReadTag(Parcel &parcel)
+{
+    size_t pos = parcel.GetReadPosition();
+    int32_t tag = 0;
+    if (parcel.ReadInt32(tag) && tag == UTF8_TAG) {
+        return true;
+    }
+    parcel.RewindRead(pos);
+    return false;
+}
+
+CommonEventWireFormat::Scope::Scope(int32_t version) : previous_(g_scopedVersion)
+{
+    g_scopedVersion = version;
+}
+
+CommonEventWireFormat::Scope::~Scope()
+{
+    g_scopedVersion = previous_;
+}
+}  // namespace EventFwk
+}  // namespace OHOS
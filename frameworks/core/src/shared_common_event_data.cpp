@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shared_common_event_data.h"
+
+#include <sys/mman.h>
+
+#include "event_log_wrapper.h"
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+constexpr const char *SHARED_PAYLOAD_NAME = "CesWantPayload";
+constexpr size_t SHARED_PAYLOAD_MAX_SIZE = 16 * 1024 * 1024;
+}  // namespace
+
+SharedCommonEventData::SharedCommonEventData(const CommonEventData &data) : CommonEventData(data)
+{
+}
+
+SharedCommonEventData::~SharedCommonEventData()
+{
+}
+
+bool SharedCommonEventData::Marshalling(Parcel &parcel) const
+{
+    if (!MarshallingDataAndCode(parcel)) {
+        return false;
+    }
+
+    sptr<Ashmem> payload = nullptr;
+    std::shared_ptr<const std::vector<uint8_t>> bytes = nullptr;
+    bool marshalled = false;
+    {
+        std::lock_guard<std::mutex> lock(wantMutex_);
+        payload = wantPayload_;
+        bytes = wantBytes_;
+        marshalled = wantMarshalled_;
+    }
+    // ashmem handles can only be carried by a MessageParcel
+    MessageParcel *messageParcel = dynamic_cast<MessageParcel *>(&parcel);
+    if ((messageParcel != nullptr) && (payload != nullptr)) {
+        return WriteSharedWant(*messageParcel, payload);
+    }
+    if (bytes != nullptr) {
+        return parcel.WriteBuffer(bytes->data(), bytes->size());
+    }
+    if (marshalled) {
+        return WriteWant(parcel);
+    }
+    return WriteAndKeepWant(parcel);
+}
+
+bool SharedCommonEventData::WriteAndKeepWant(Parcel &parcel) const
+{
+    size_t wantPos = parcel.GetWritePosition();
+    size_t objectCount = parcel.GetOffsetsSize();
+    if (!parcel.WriteParcelable(&GetWant())) {
+        EVENT_LOGE(LOG_TAG_CES, "Failed to write want");
+        return false;
+    }
+    size_t wantSize = parcel.GetWritePosition() - wantPos;
+    const uint8_t *want = reinterpret_cast<const uint8_t *>(parcel.GetData() + wantPos);
+
+    // binder objects can not be copied as plain bytes, such a want is marshalled again every time
+    bool copyable = (parcel.GetOffsetsSize() == objectCount);
+    sptr<Ashmem> payload = nullptr;
+    std::shared_ptr<const std::vector<uint8_t>> bytes = nullptr;
+    if (copyable && (wantSize > SHARED_PAYLOAD_THRESHOLD)) {
+        payload = CreateSharedPayload(reinterpret_cast<const void *>(want), wantSize);
+    }
+    if (copyable && (payload == nullptr)) {
+        bytes = std::make_shared<const std::vector<uint8_t>>(want, want + wantSize);
+    }
+    {
+        std::lock_guard<std::mutex> lock(wantMutex_);
+        if (!wantMarshalled_) {
+            wantMarshalled_ = true;
+            wantPayload_ = payload;
+            wantBytes_ = bytes;
+        }
+    }
+
+    // move the want already written inline into shared memory
+    MessageParcel *messageParcel = dynamic_cast<MessageParcel *>(&parcel);
+    if ((messageParcel == nullptr) || (payload == nullptr) || !parcel.RewindWrite(wantPos)) {
+        return true;
+    }
+    return WriteSharedWant(*messageParcel, payload);
+}
+
+sptr<Ashmem> SharedCommonEventData::CreateSharedPayload(const void *content, size_t size)
+{
+    if (size > SHARED_PAYLOAD_MAX_SIZE) {
+        EVENT_LOGW(LOG_TAG_CES, "want payload too large, size = %{public}zu", size);
+        return nullptr;
+    }
+    int32_t payloadSize = static_cast<int32_t>(size);
+    sptr<Ashmem> payload = Ashmem::CreateAshmem(SHARED_PAYLOAD_NAME, payloadSize);
+    if (payload == nullptr) {
+        EVENT_LOGE(LOG_TAG_CES, "Failed to create ashmem");
+        return nullptr;
+    }
+    if (!payload->MapReadAndWriteAshmem()) {
+        EVENT_LOGE(LOG_TAG_CES, "Failed to map ashmem");
+        return nullptr;
+    }
+    bool written = payload->WriteToAshmem(content, payloadSize, 0);
+    payload->UnmapAshmem();
+    // receivers may only map the region read-only
+    if (!written || !payload->SetProtection(PROT_READ)) {
+        EVENT_LOGE(LOG_TAG_CES, "Failed to fill ashmem");
+        return nullptr;
+    }
+    return payload;
+}
+
+bool SharedCommonEventData::WriteSharedWant(MessageParcel &parcel, const sptr<Ashmem> &payload)
+{
+    if (!parcel.WriteInt32(VALUE_ASHMEM)) {
+        return false;
+    }
+    if (!parcel.WriteAshmem(payload)) {
+        EVENT_LOGE(LOG_TAG_CES, "Failed to write ashmem");
+        return false;
+    }
+    return true;
+}
+}  // namespace EventFwk
+}  // namespace OHOS
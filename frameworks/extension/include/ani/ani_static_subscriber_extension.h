@@ -61,6 +61,8 @@ public:
 
     void OnReceiveEvent(const std::shared_ptr<CommonEventData> data) override;
 
+    void OnReceiveEvents(const std::vector<std::shared_ptr<CommonEventData>> &data) override;
+
     void ResetEnv(ani_env* env);
 
     std::weak_ptr<StsStaticSubscriberExtension> GetWeakPtr();
@@ -68,6 +70,7 @@ public:
     void CallObjectMethod(bool withResult, const char* name, const char* signature, ...);
 
 private:
+    void CallOnReceiveEvent(const CommonEventData &commonEventData);
     void BindContext(ani_env *env, const std::shared_ptr<OHOSApplication> &application);
     AbilityRuntime::ETSRuntime& stsRuntime_;
     std::unique_ptr<ETSNativeReference> stsObj_;
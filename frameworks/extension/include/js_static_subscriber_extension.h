@@ -54,11 +54,15 @@ public:
 
     void OnReceiveEvent(std::shared_ptr<CommonEventData> data) override;
 
+    void OnReceiveEvents(const std::vector<std::shared_ptr<CommonEventData>> &data) override;
+
     void ExecNapiWrap(napi_env env, napi_value obj);
 
     std::weak_ptr<JsStaticSubscriberExtension> GetWeakPtr();
 
 private:
+    void CallOnReceiveEvent(const std::shared_ptr<CommonEventData> &data);
+
     AbilityRuntime::JsRuntime& jsRuntime_;
     std::unique_ptr<NativeReference> jsObj_;
 };
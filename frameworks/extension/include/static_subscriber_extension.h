@@ -16,6 +16,8 @@
 #ifndef OHOS_COMMON_EVENT_SERVICE_STATIC_SUBSCRIBER_EXTENSION_H
 #define OHOS_COMMON_EVENT_SERVICE_STATIC_SUBSCRIBER_EXTENSION_H
 
+#include <vector>
+
 #include "common_event_data.h"
 #include "extension_base.h"
 #include "runtime.h"
@@ -42,6 +44,13 @@ public:
     static StaticSubscriberExtension* Create(const std::unique_ptr<AbilityRuntime::Runtime>& runtime);
 
     virtual void OnReceiveEvent(std::shared_ptr<CommonEventData> data);
+
+    /**
+     * Receives a batch of events queued by the service, the default delivers them one by one.
+     *
+     * @param data Indicates the common event data in publish order.
+     */
+    virtual void OnReceiveEvents(const std::vector<std::shared_ptr<CommonEventData>> &data);
 };
 } // namespace EventFwk
 } // namespace OHOS
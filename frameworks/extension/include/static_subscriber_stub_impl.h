@@ -17,6 +17,7 @@
 #define OHOS_COMMON_EVENT_SERVICE_STATIC_SUBSCRIBER_STUB_IMPL_H
 
 #include <memory>
+#include <vector>
 #include "static_subscriber_extension.h"
 #include "static_subscriber_stub.h"
 
@@ -31,6 +32,8 @@ public:
 
     ErrCode OnReceiveEvent(const CommonEventData& data, int32_t& funcResult) override;
 
+    ErrCode OnReceiveEvents(const std::vector<CommonEventData>& data, int32_t& funcResult) override;
+
 private:
     std::weak_ptr<StaticSubscriberExtension> extension_;
 };
@@ -264,23 +264,53 @@ void StsStaticSubscriberExtension::OnReceiveEvent(std::shared_ptr<CommonEventDat
         return;
     }
     std::weak_ptr<StsStaticSubscriberExtension> wThis = GetWeakPtr();
-    auto task = [wThis, commonEventData, this]() {
+    auto task = [wThis, commonEventData]() {
         std::shared_ptr<StsStaticSubscriberExtension> sThis = wThis.lock();
         if (sThis == nullptr) {
             return;
         }
-        ani_env* env = sThis->stsRuntime_.GetAniEnv();
-        if (!env) {
-            EVENT_LOGE(LOG_TAG_CES, "task env not found env");
+        sThis->CallOnReceiveEvent(commonEventData);
+    };
+    handler_->PostTask(task, "CommonEvent" + data->GetWant().GetAction());
+}
+
+void StsStaticSubscriberExtension::OnReceiveEvents(const std::vector<std::shared_ptr<CommonEventData>> &data)
+{
+    EVENT_LOGD(LOG_TAG_CES, "OnReceiveEvents execute size = %{public}zu", data.size());
+    if (handler_ == nullptr) {
+        EVENT_LOGE(LOG_TAG_CES, "handler is invalid");
+        return;
+    }
+    if (data.empty()) {
+        return;
+    }
+    std::weak_ptr<StsStaticSubscriberExtension> wThis = GetWeakPtr();
+    auto task = [wThis, data]() {
+        std::shared_ptr<StsStaticSubscriberExtension> sThis = wThis.lock();
+        if (sThis == nullptr) {
             return;
         }
-
-        ani_object ani_data {};
-        AniCommonEventUtils::ConvertCommonEventDataToEts(env, ani_data, commonEventData);
-        const char* signature  = "C{commonEvent.commonEventData.CommonEventData}:";
-        CallObjectMethod(false, "onReceiveEvent", signature, ani_data);
+        for (const auto &commonEventData : data) {
+            if (commonEventData != nullptr) {
+                sThis->CallOnReceiveEvent(*commonEventData);
+            }
+        }
     };
-    handler_->PostTask(task, "CommonEvent" + data->GetWant().GetAction());
+    handler_->PostTask(task, "CommonEvents" + data.front()->GetWant().GetAction());
+}
+
+void StsStaticSubscriberExtension::CallOnReceiveEvent(const CommonEventData &commonEventData)
+{
+    ani_env* env = stsRuntime_.GetAniEnv();
+    if (!env) {
+        EVENT_LOGE(LOG_TAG_CES, "task env not found env");
+        return;
+    }
+
+    ani_object ani_data {};
+    AniCommonEventUtils::ConvertCommonEventDataToEts(env, ani_data, commonEventData);
+    const char* signature  = "C{commonEvent.commonEventData.CommonEventData}:";
+    CallObjectMethod(false, "onReceiveEvent", signature, ani_data);
 }
 
 void StsStaticSubscriberExtension::ResetEnv(ani_env* env)
@@ -211,6 +211,10 @@ void JsStaticSubscriberExtension::OnReceiveEvent(std::shared_ptr<CommonEventData
         EVENT_LOGE(LOG_TAG_CES_NAPI, "handler is invalid");
         return;
     }
+    if (data == nullptr) {
+        EVENT_LOGE(LOG_TAG_CES_NAPI, "OnReceiveEvent common event data is invalid");
+        return;
+    }
     std::weak_ptr<JsStaticSubscriberExtension> wThis = GetWeakPtr();
 
     auto task = [wThis, data]() {
@@ -218,54 +222,84 @@ void JsStaticSubscriberExtension::OnReceiveEvent(std::shared_ptr<CommonEventData
         if (sThis == nullptr) {
             return;
         }
-        if (data == nullptr) {
-            EVENT_LOGE(LOG_TAG_CES_NAPI, "OnReceiveEvent common event data is invalid");
-            return;
-        }
-        if (!sThis->jsObj_) {
-            EVENT_LOGE(LOG_TAG_CES_NAPI, "Not found StaticSubscriberExtension.js");
-            return;
-        }
+        sThis->CallOnReceiveEvent(data);
+    };
+    handler_->PostTask(task, "CommonEvent" + data->GetWant().GetAction());
+}
 
-        AbilityRuntime::HandleScope handleScope(sThis->jsRuntime_);
-        napi_env env = sThis->jsRuntime_.GetNapiEnv();
-        napi_value commonEventData = nullptr;
-        napi_create_object(env, &commonEventData);
-        Want want = data->GetWant();
-
-        napi_value wantAction = nullptr;
-        napi_create_string_utf8(env, want.GetAction().c_str(), want.GetAction().size(), &wantAction);
-        napi_set_named_property(env, commonEventData, "event", wantAction);
-        napi_value wantBundle = nullptr;
-        napi_create_string_utf8(env, want.GetBundle().c_str(), want.GetBundle().size(), &wantBundle);
-        napi_set_named_property(env, commonEventData, "bundleName", wantBundle);
-        napi_value dataCode = nullptr;
-        napi_create_int32(env, data->GetCode(), &dataCode);
-        napi_set_named_property(env, commonEventData, "code", dataCode);
-        napi_value dataNapi = nullptr;
-        napi_create_string_utf8(env, data->GetData().c_str(), data->GetData().size(), &dataNapi);
-        napi_set_named_property(env, commonEventData, "data", dataNapi);
-        napi_value napiParams = AppExecFwk::WrapWantParams(
-            env, want.GetParams());
-        napi_set_named_property(env, commonEventData, "parameters", napiParams);
-
-        napi_value argv[] = {commonEventData};
-        napi_value obj = sThis->jsObj_->GetNapiValue();
-        if (obj == nullptr) {
-            EVENT_LOGE(LOG_TAG_CES_NAPI, "Failed to get StaticSubscriberExtension object");
-            return;
-        }
+void JsStaticSubscriberExtension::OnReceiveEvents(const std::vector<std::shared_ptr<CommonEventData>> &data)
+{
+    EVENT_LOGD(LOG_TAG_CES_NAPI, "%{public}s called, size = %{public}zu.", __func__, data.size());
+    if (handler_ == nullptr) {
+        EVENT_LOGE(LOG_TAG_CES_NAPI, "handler is invalid");
+        return;
+    }
+    if (data.empty()) {
+        return;
+    }
+    std::weak_ptr<JsStaticSubscriberExtension> wThis = GetWeakPtr();
 
-        napi_value method = nullptr;
-        napi_get_named_property(env, obj, "onReceiveEvent", &method);
-        if (method == nullptr) {
-            EVENT_LOGE(LOG_TAG_CES_NAPI, "Failed to get onReceiveEvent from StaticSubscriberExtension object");
+    // one handler task for the whole batch, the js callback is still invoked once per event
+    auto task = [wThis, data]() {
+        std::shared_ptr<JsStaticSubscriberExtension> sThis = wThis.lock();
+        if (sThis == nullptr) {
             return;
         }
-        napi_call_function(env, obj, method, ARGC_ONE, argv, nullptr);
-        EVENT_LOGD(LOG_TAG_CES_NAPI, "JsStaticSubscriberExtension js receive event called.");
+        for (const auto &commonEventData : data) {
+            sThis->CallOnReceiveEvent(commonEventData);
+        }
     };
-    handler_->PostTask(task, "CommonEvent" + data->GetWant().GetAction());
+    handler_->PostTask(task, "CommonEvents" + data.front()->GetWant().GetAction());
+}
+
+void JsStaticSubscriberExtension::CallOnReceiveEvent(const std::shared_ptr<CommonEventData> &data)
+{
+    if (data == nullptr) {
+        EVENT_LOGE(LOG_TAG_CES_NAPI, "OnReceiveEvent common event data is invalid");
+        return;
+    }
+    if (!jsObj_) {
+        EVENT_LOGE(LOG_TAG_CES_NAPI, "Not found StaticSubscriberExtension.js");
+        return;
+    }
+
+    AbilityRuntime::HandleScope handleScope(jsRuntime_);
+    napi_env env = jsRuntime_.GetNapiEnv();
+    napi_value commonEventData = nullptr;
+    napi_create_object(env, &commonEventData);
+    Want want = data->GetWant();
+
+    napi_value wantAction = nullptr;
+    napi_create_string_utf8(env, want.GetAction().c_str(), want.GetAction().size(), &wantAction);
+    napi_set_named_property(env, commonEventData, "event", wantAction);
+    napi_value wantBundle = nullptr;
+    napi_create_string_utf8(env, want.GetBundle().c_str(), want.GetBundle().size(), &wantBundle);
+    napi_set_named_property(env, commonEventData, "bundleName", wantBundle);
+    napi_value dataCode = nullptr;
+    napi_create_int32(env, data->GetCode(), &dataCode);
+    napi_set_named_property(env, commonEventData, "code", dataCode);
+    napi_value dataNapi = nullptr;
+    napi_create_string_utf8(env, data->GetData().c_str(), data->GetData().size(), &dataNapi);
+    napi_set_named_property(env, commonEventData, "data", dataNapi);
+    napi_value napiParams = AppExecFwk::WrapWantParams(
+        env, want.GetParams());
+    napi_set_named_property(env, commonEventData, "parameters", napiParams);
+
+    napi_value argv[] = {commonEventData};
+    napi_value obj = jsObj_->GetNapiValue();
+    if (obj == nullptr) {
+        EVENT_LOGE(LOG_TAG_CES_NAPI, "Failed to get StaticSubscriberExtension object");
+        return;
+    }
+
+    napi_value method = nullptr;
+    napi_get_named_property(env, obj, "onReceiveEvent", &method);
+    if (method == nullptr) {
+        EVENT_LOGE(LOG_TAG_CES_NAPI, "Failed to get onReceiveEvent from StaticSubscriberExtension object");
+        return;
+    }
+    napi_call_function(env, obj, method, ARGC_ONE, argv, nullptr);
+    EVENT_LOGD(LOG_TAG_CES_NAPI, "JsStaticSubscriberExtension js receive event called.");
 }
 } // namespace EventFwk
 } // namespace OHOS
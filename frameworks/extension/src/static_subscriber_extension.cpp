@@ -55,5 +55,12 @@ void StaticSubscriberExtension::OnReceiveEvent(std::shared_ptr<CommonEventData>
 {
     EVENT_LOGD(LOG_TAG_CES, "OnReceiveEvent called.");
 }
+
+void StaticSubscriberExtension::OnReceiveEvents(const std::vector<std::shared_ptr<CommonEventData>> &data)
+{
+    for (const auto &commonEventData : data) {
+        OnReceiveEvent(commonEventData);
+    }
+}
 } // namespace EventFwk
 } // namespace OHOS
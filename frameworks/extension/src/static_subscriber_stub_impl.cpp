@@ -33,5 +33,24 @@ ErrCode StaticSubscriberStubImpl::OnReceiveEvent(const CommonEventData& data, in
     funcResult = -1;
     return ERR_INVALID_DATA;
 }
+
+ErrCode StaticSubscriberStubImpl::OnReceiveEvents(const std::vector<CommonEventData>& data, int32_t& funcResult)
+{
+    EVENT_LOGD(LOG_TAG_CES, "OnReceiveEvents begin, size = %{public}zu.", data.size());
+    auto extension = extension_.lock();
+    if (extension == nullptr) {
+        EVENT_LOGE(LOG_TAG_CES, "OnReceiveEvents end failed.");
+        funcResult = -1;
+        return ERR_INVALID_DATA;
+    }
+    std::vector<std::shared_ptr<CommonEventData>> commonEventData;
+    commonEventData.reserve(data.size());
+    for (const auto &item : data) {
+        commonEventData.emplace_back(std::make_shared<CommonEventData>(item));
+    }
+    extension->OnReceiveEvents(commonEventData);
+    funcResult = 0;
+    return ERR_OK;
+}
 } // namespace EventFwk
 } // namespace OHOS
@@ -68,6 +68,11 @@ public:
         return 0;
     }
 
+    ErrCode OnReceiveEvents(const std::vector<CommonEventData>& data, int32_t& funcResult) override
+    {
+        return 0;
+    }
+
     int32_t returnCode_ = ERR_NONE;
 };
 
@@ -87,6 +92,11 @@ public:
         return 0;
     }
 
+    ErrCode OnReceiveEvents(const std::vector<CommonEventData>& data, int32_t& funcResult) override
+    {
+        return 0;
+    }
+
     int32_t returnCode_ = 1;
 };
 
@@ -69,6 +69,12 @@ public:
         return 0;
     }
 
+    ErrCode OnReceiveEvents(const std::vector<CommonEventData>& data, int32_t& funcResult) override
+    {
+        GTEST_LOG_(INFO) << "MockRegisterService::OnReceiveEvents called.";
+        return 0;
+    }
+
     int32_t returnCode_ = ERR_NONE;
 };
 
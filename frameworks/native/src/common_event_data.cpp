@@ -14,12 +14,19 @@
  */
 #include "common_event_data.h"
 
+#include "common_event_wire_format.h"
 #include "event_log_wrapper.h"
 #include "message_parcel.h"
+#include "securec.h"
+#include "shared_common_event_data.h"
 #include "string_ex.h"
 
 namespace OHOS {
 namespace EventFwk {
+namespace {
+constexpr int32_t SHARED_PAYLOAD_MAX_SIZE = 16 * 1024 * 1024;
+}  // namespace
+
 CommonEventData::CommonEventData() : code_(0)
 {
 }
@@ -70,6 +77,15 @@ const Want &CommonEventData::GetWant() const
 
 bool CommonEventData::Marshalling(Parcel &parcel) const
 {
+    return MarshallingDataAndCode(parcel) && WriteWant(parcel);
+}
+
+bool CommonEventData::MarshallingDataAndCode(Parcel &parcel) const
+{
+    if (CommonEventWireFormat::GetWriteVersion() >= CommonEventWireFormat::VERSION_UTF8) {
+        return MarshallingUtf8(parcel);
+    }
+
     // write data
     if (GetData().empty()) {
         if (!parcel.WriteInt32(VALUE_NULL)) {
@@ -90,17 +106,61 @@ bool CommonEventData::Marshalling(Parcel &parcel) const
         EVENT_LOGE(LOG_TAG_CES, "Failed to write code");
         return false;
     }
+    return true;
+}
+
+bool CommonEventData::MarshallingUtf8(Parcel &parcel) const
+{
+    if (!CommonEventWireFormat::WriteTag(parcel)) {
+        return false;
+    }
+    if (!parcel.WriteString(data_)) {
+        EVENT_LOGE(LOG_TAG_CES, "Failed to write data");
+        return false;
+    }
+    if (!parcel.WriteInt32(code_)) {
+        EVENT_LOGE(LOG_TAG_CES, "Failed to write code");
+        return false;
+    }
+    return true;
+}
 
+bool CommonEventData::WriteWant(Parcel &parcel) const
+{
+    size_t wantPos = parcel.GetWritePosition();
+    size_t objectCount = parcel.GetOffsetsSize();
     if (!parcel.WriteParcelable(&want_)) {
         EVENT_LOGE(LOG_TAG_CES, "Failed to write want");
         return false;
     }
+    size_t wantSize = parcel.GetWritePosition() - wantPos;
+    // ashmem handles can only be carried by a MessageParcel
+    MessageParcel *messageParcel = dynamic_cast<MessageParcel *>(&parcel);
+    if ((messageParcel == nullptr) || (wantSize <= SHARED_PAYLOAD_THRESHOLD) ||
+        (parcel.GetOffsetsSize() != objectCount)) {
+        return true;
+    }
 
-    return true;
+    // move the want already written inline into shared memory
+    sptr<Ashmem> payload = SharedCommonEventData::CreateSharedPayload(
+        reinterpret_cast<const void *>(parcel.GetData() + wantPos), wantSize);
+    if (payload == nullptr || !parcel.RewindWrite(wantPos)) {
+        EVENT_LOGW(LOG_TAG_CES, "keep want inline, size = %{public}zu", wantSize);
+        return true;
+    }
+    return SharedCommonEventData::WriteSharedWant(*messageParcel, payload);
 }
 
 __attribute__((no_sanitize("cfi"))) bool CommonEventData::ReadFromParcel(Parcel &parcel)
 {
+    if (CommonEventWireFormat::ReadTag(parcel)) {
+        if (!parcel.ReadString(data_) || !parcel.ReadInt32(code_)) {
+            EVENT_LOGE(LOG_TAG_CES, "Failed to read data or code");
+            return false;
+        }
+        return ReadWant(parcel);
+    }
+
     // read data
     int empty = VALUE_NULL;
     if (!parcel.ReadInt32(empty)) {
@@ -113,7 +173,17 @@ __attribute__((no_sanitize("cfi"))) bool CommonEventData::ReadFromParcel(Parcel
     // read code
     code_ = parcel.ReadInt32();
 
-    // read want
+    return ReadWant(parcel);
+}
+
+__attribute__((no_sanitize("cfi"))) bool CommonEventData::ReadWant(Parcel &parcel)
+{
+    size_t wantPos = parcel.GetReadPosition();
+    int32_t wantMode = VALUE_NULL;
+    if (parcel.ReadInt32(wantMode) && (wantMode == VALUE_ASHMEM)) {
+        return ReadSharedWant(parcel);
+    }
+    parcel.RewindRead(wantPos);
     std::unique_ptr<Want> want(parcel.ReadParcelable<Want>());
     if (!want) {
         EVENT_LOGE(LOG_TAG_CES, "Failed to ReadParcelable<Want>");
@@ -124,6 +194,48 @@ __attribute__((no_sanitize("cfi"))) bool CommonEventData::ReadFromParcel(Parcel
     return true;
 }
 
+__attribute__((no_sanitize("cfi"))) bool CommonEventData::ReadSharedWant(Parcel &parcel)
+{
+    MessageParcel *messageParcel = dynamic_cast<MessageParcel *>(&parcel);
+    if (messageParcel == nullptr) {
+        EVENT_LOGE(LOG_TAG_CES, "ashmem want without MessageParcel");
+        return false;
+    }
+    sptr<Ashmem> payload = messageParcel->ReadAshmem();
+    if (payload == nullptr) {
+        EVENT_LOGE(LOG_TAG_CES, "Failed to read ashmem");
+        return false;
+    }
+    int32_t size = payload->GetAshmemSize();
+    if (size <= 0 || size > SHARED_PAYLOAD_MAX_SIZE || !payload->MapReadOnlyAshmem()) {
+        EVENT_LOGE(LOG_TAG_CES, "Failed to map ashmem, size = %{public}d", size);
+        return false;
+    }
+    // copy out before parsing so the content cannot change underneath the reader
+    const void *content = payload->ReadFromAshmem(size, 0);
+    void *buffer = (content == nullptr) ? nullptr : malloc(size);
+    if (buffer == nullptr || memcpy_s(buffer, size, content, size) != EOK) {
+        EVENT_LOGE(LOG_TAG_CES, "Failed to copy ashmem");
+        free(buffer);
+        payload->UnmapAshmem();
+        return false;
+    }
+    payload->UnmapAshmem();
+
+    Parcel wantParcel;
+    if (!wantParcel.ParseFrom(reinterpret_cast<uintptr_t>(buffer), size)) {
+        free(buffer);
+        return false;
+    }
+    std::unique_ptr<Want> want(wantParcel.ReadParcelable<Want>());
+    if (!want) {
+        EVENT_LOGE(LOG_TAG_CES, "Failed to ReadParcelable<Want> from ashmem");
+        return false;
+    }
+    want_ = *want;
+    return true;
+}
+
 CommonEventData *CommonEventData::Unmarshalling(Parcel &parcel)
 {
     CommonEventData *commonEventData = new (std::nothrow) CommonEventData();
@@ -14,6 +14,7 @@
  */
 
 #include "common_event_publish_info.h"
+#include "common_event_wire_format.h"
 #include "event_log_wrapper.h"
 #include "string_ex.h"
 #include <cstdint>
@@ -162,11 +163,13 @@ bool CommonEventPublishInfo::Marshalling(Parcel &parcel) const
     EVENT_LOGD(LOG_TAG_CES, "enter");
 
     // write subscriber permissions
-    std::vector<std::u16string> permissionVec_;
-    for (std::vector<std::string>::size_type i = 0; i < subscriberPermissions_.size(); ++i) {
-        permissionVec_.emplace_back(Str8ToStr16(subscriberPermissions_[i]));
-    }
-    if (!parcel.WriteString16Vector(permissionVec_)) {
+    bool utf8 = CommonEventWireFormat::GetWriteVersion() >= CommonEventWireFormat::VERSION_UTF8;
+    if (utf8) {
+        if (!CommonEventWireFormat::WriteTag(parcel) || !parcel.WriteStringVector(subscriberPermissions_)) {
+            EVENT_LOGE(LOG_TAG_CES, "common event Publish Info write permission failed");
+            return false;
+        }
+    } else if (!WritePermissionsUtf16(parcel)) {
         EVENT_LOGE(LOG_TAG_CES, "common event Publish Info write permission failed");
         return false;
     }
@@ -183,7 +186,7 @@ bool CommonEventPublishInfo::Marshalling(Parcel &parcel) const
         return false;
     }
     // write bundleName
-    if (!parcel.WriteString16(Str8ToStr16(bundleName_))) {
+    if (!(utf8 ? parcel.WriteString(bundleName_) : parcel.WriteString16(Str8ToStr16(bundleName_)))) {
         EVENT_LOGE(LOG_TAG_CES, "common event Publish Info  write bundleName failed");
         return false;
     }
@@ -211,6 +214,28 @@ bool CommonEventPublishInfo::Marshalling(Parcel &parcel) const
     return true;
 }
 
+bool CommonEventPublishInfo::WritePermissionsUtf16(Parcel &parcel) const
+{
+    std::vector<std::u16string> permissionVec_;
+    for (std::vector<std::string>::size_type i = 0; i < subscriberPermissions_.size(); ++i) {
+        permissionVec_.emplace_back(Str8ToStr16(subscriberPermissions_[i]));
+    }
+    return parcel.WriteString16Vector(permissionVec_);
+}
+
+bool CommonEventPublishInfo::ReadPermissionsUtf16(Parcel &parcel)
+{
+    std::vector<std::u16string> permissionVec_;
+    if (!parcel.ReadString16Vector(&permissionVec_)) {
+        return false;
+    }
+    subscriberPermissions_.clear();
+    for (std::vector<std::u16string>::size_type i = 0; i < permissionVec_.size(); i++) {
+        subscriberPermissions_.emplace_back(Str16ToStr8(permissionVec_[i]));
+    }
+    return true;
+}
+
 bool CommonEventPublishInfo::isSubscriberType(int32_t subscriberType)
 {
     switch (subscriberType) {
@@ -228,21 +253,24 @@ bool CommonEventPublishInfo::ReadFromParcel(Parcel &parcel)
     EVENT_LOGD(LOG_TAG_CES, "enter");
 
     // read subscriber permissions
-    std::vector<std::u16string> permissionVec_;
-    if (!parcel.ReadString16Vector(&permissionVec_)) {
+    bool utf8 = CommonEventWireFormat::ReadTag(parcel);
+    if (!(utf8 ? parcel.ReadStringVector(&subscriberPermissions_) : ReadPermissionsUtf16(parcel))) {
         EVENT_LOGE(LOG_TAG_CES, "ReadFromParcel read permission error");
         return false;
     }
-    subscriberPermissions_.clear();
-    for (std::vector<std::u16string>::size_type i = 0; i < permissionVec_.size(); i++) {
-        subscriberPermissions_.emplace_back(Str16ToStr8(permissionVec_[i]));
-    }
     // read ordered
     ordered_ = parcel.ReadBool();
     // read sticky
     sticky_ = parcel.ReadBool();
     // read bundleName
-    bundleName_ = Str16ToStr8(parcel.ReadString16());
+    if (utf8) {
+        if (!parcel.ReadString(bundleName_)) {
+            EVENT_LOGE(LOG_TAG_CES, "ReadFromParcel read bundleName error");
+            return false;
+        }
+    } else {
+        bundleName_ = Str16ToStr8(parcel.ReadString16());
+    }
     // read subscriberUids
     if (!parcel.ReadInt32Vector(&subscriberUids_)) {
         EVENT_LOGE(LOG_TAG_CES, "ReadFromParcel read subscriberUids error");
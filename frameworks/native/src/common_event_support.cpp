@@ -14,6 +14,9 @@
  */
 
 #include "common_event_support.h"
+
+#include <unordered_set>
+
 #include "event_log_wrapper.h"
 
 namespace OHOS {
@@ -1782,14 +1785,12 @@ const std::string CommonEventSupport::COMMON_EVENT_SANDBOX_BUNDLE_REMOVED =
     "usual.event.SANDBOX_BUNDLE_REMOVED";
 
 CommonEventSupport::CommonEventSupport()
-{
-    Init();
-}
+{}
 
 CommonEventSupport::~CommonEventSupport()
 {}
 
-void CommonEventSupport::Init()
+void CommonEventSupport::Init(std::vector<std::string> &events)
 {
     /**
      * Indicates the action of a common event that the user has finished booting and the system has been loaded.
@@ -1797,7 +1798,7 @@ void CommonEventSupport::Init()
      * permission.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BOOT_COMPLETED);
+    events.emplace_back(COMMON_EVENT_BOOT_COMPLETED);
     /**
      * Indicates the action of a common event that the user has finished booting and the system has been loaded but the
      * screen is still locked.
@@ -1805,705 +1806,705 @@ void CommonEventSupport::Init()
      * permission.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_LOCKED_BOOT_COMPLETED);
+    events.emplace_back(COMMON_EVENT_LOCKED_BOOT_COMPLETED);
     /**
      * Indicates the action of a common event that the device is being shut down and the final shutdown will proceed.
      * This is different from sleeping. All unsaved data will be lost after shut down.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SHUTDOWN);
+    events.emplace_back(COMMON_EVENT_SHUTDOWN);
     /**
      * Indicates the action of a common event that the charging state, level, and other information about the battery
      * have changed.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BATTERY_CHANGED);
+    events.emplace_back(COMMON_EVENT_BATTERY_CHANGED);
     /**
      * Indicates the action of a common event that the battery level is low.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BATTERY_LOW);
+    events.emplace_back(COMMON_EVENT_BATTERY_LOW);
     /**
      * Indicates the action of a common event that the battery exit the low state.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BATTERY_OKAY);
+    events.emplace_back(COMMON_EVENT_BATTERY_OKAY);
     /**
      * Indicates the action of a common event that the device is connected to the external power.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_POWER_CONNECTED);
+    events.emplace_back(COMMON_EVENT_POWER_CONNECTED);
     /**
      * Indicates the action of a common event that the device is disconnected from the external power.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_POWER_DISCONNECTED);
+    events.emplace_back(COMMON_EVENT_POWER_DISCONNECTED);
 
     /**
      * Indicates the action of a common event that the device screen is off and the device is sleeping.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SCREEN_OFF);
+    events.emplace_back(COMMON_EVENT_SCREEN_OFF);
     /**
      * Indicates the action of a common event that the device screen is on and the device is interactive.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SCREEN_ON);
+    events.emplace_back(COMMON_EVENT_SCREEN_ON);
     /**
      * Indicates the action of a common event that the thermal level changed.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_THERMAL_LEVEL_CHANGED);
+    events.emplace_back(COMMON_EVENT_THERMAL_LEVEL_CHANGED);
     /**
      * Indicates the action of a common event that the device is about to enter the force sleep mode.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_ENTER_FORCE_SLEEP);
+    events.emplace_back(COMMON_EVENT_ENTER_FORCE_SLEEP);
     /**
      * Indicates the action of a common event that the device exits the force sleep mode.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_EXIT_FORCE_SLEEP);
+    events.emplace_back(COMMON_EVENT_EXIT_FORCE_SLEEP);
     /**
      * Indicates the action of a common event that the device is about to enter the hibernate mode.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_ENTER_HIBERNATE);
+    events.emplace_back(COMMON_EVENT_ENTER_HIBERNATE);
     /**
      * Indicates the action of a common event that the device exits the hibernate mode.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_EXIT_HIBERNATE);
+    events.emplace_back(COMMON_EVENT_EXIT_HIBERNATE);
     /**
      * Indicates the action of a common event that the device is idle and charging,
      * services can do some business on the background.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_CHARGE_IDLE_MODE_CHANGED);
+    events.emplace_back(COMMON_EVENT_CHARGE_IDLE_MODE_CHANGED);
     /**
      * Indicates the action of a common event that the user unlocks the device.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_PRESENT);
+    events.emplace_back(COMMON_EVENT_USER_PRESENT);
 
     /**
      * Indicates the action of a common event that the system time has changed.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_TIME_TICK);
+    events.emplace_back(COMMON_EVENT_TIME_TICK);
     /**
      * Indicates the action of a common event that the system time is set.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_TIME_CHANGED);
+    events.emplace_back(COMMON_EVENT_TIME_CHANGED);
     /**
      * Indicates the action of a common event that the system date has changed.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_DATE_CHANGED);
     /**
      * Indicates the action of a common event that the system time zone has changed.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_TIMEZONE_CHANGED);
+    events.emplace_back(COMMON_EVENT_TIMEZONE_CHANGED);
 
     /**
      * Indicates the action of a common event that a user closes a temporary system dialog box.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_CLOSE_SYSTEM_DIALOGS);
+    events.emplace_back(COMMON_EVENT_CLOSE_SYSTEM_DIALOGS);
 
     /**
      * Indicates the action of a common event that bundle scan has finished.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BUNDLE_SCAN_FINISHED);
+    events.emplace_back(COMMON_EVENT_BUNDLE_SCAN_FINISHED);
     /**
      * Indicates the action of a common event that a new application package has been installed on the device.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_ADDED);
+    events.emplace_back(COMMON_EVENT_PACKAGE_ADDED);
     /**
      * Indicates the action of a common event that an application's skill has changed.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SKILL_CHANGED);
+    events.emplace_back(COMMON_EVENT_SKILL_CHANGED);
     /**
      * This commonEvent means when a new application package start to install on the device.
      * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_INSTALLATION_STARTED);
+    events.emplace_back(COMMON_EVENT_PACKAGE_INSTALLATION_STARTED);
     /**
      * This common event means an application package enables or disables a dynamic icon.
      * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DYNAMIC_ICON_CHANGED);
+    events.emplace_back(COMMON_EVENT_DYNAMIC_ICON_CHANGED);
     /**
      * Indicates the action of a common event that a new version of an installed application package has replaced
      * the previous one on the device.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_REPLACED);
+    events.emplace_back(COMMON_EVENT_PACKAGE_REPLACED);
     /**
      * Indicates the action of a common event that a new version of your application package has replaced
      * the previous one. This common event is sent only to the application that was replaced.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_MY_PACKAGE_REPLACED);
+    events.emplace_back(COMMON_EVENT_MY_PACKAGE_REPLACED);
     /**
      * Indicates the action of a common event that an installed application has been uninstalled from the device
      * with the application data remained.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_REMOVED);
+    events.emplace_back(COMMON_EVENT_PACKAGE_REMOVED);
     /**
      * Indicates the action of a common event that an installed bundle has been uninstalled from the device with the
      * application data remained.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BUNDLE_REMOVED);
+    events.emplace_back(COMMON_EVENT_BUNDLE_REMOVED);
     /**
      * Indicates the action of a common event that an installed application, including both the application data and
      * code, have been completely uninstalled from the device.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_FULLY_REMOVED);
+    events.emplace_back(COMMON_EVENT_PACKAGE_FULLY_REMOVED);
     /**
      * Indicates the action of a common event that an application package has been changed
      * (for example, a component in the package has been enabled or disabled).
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_CHANGED);
+    events.emplace_back(COMMON_EVENT_PACKAGE_CHANGED);
     /**
      * Indicates the action of a common event that the user has restarted the application package and killed all its
      * processes.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_RESTARTED);
+    events.emplace_back(COMMON_EVENT_PACKAGE_RESTARTED);
     /**
      * Indicates the action of a common event that the user has cleared the application package data.
      * This common event is published after COMMON_EVENT_PACKAGE_RESTARTED is triggered and the data has been cleared.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_DATA_CLEARED);
+    events.emplace_back(COMMON_EVENT_PACKAGE_DATA_CLEARED);
     /**
      * Indicates the action of a common event that the data of an uninstalled bundle is cleared.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_UNINSTALLED_DATA_CLEARED);
+    events.emplace_back(COMMON_EVENT_PACKAGE_UNINSTALLED_DATA_CLEARED);
     /**
      * Indicates the action of a common event that the user has cleared the application package cache.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_CACHE_CLEARED);
+    events.emplace_back(COMMON_EVENT_PACKAGE_CACHE_CLEARED);
     /**
      * Indicates the action of a common event that application packages have been suspended.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGES_SUSPENDED);
+    events.emplace_back(COMMON_EVENT_PACKAGES_SUSPENDED);
     /**
      * Indicates the action of a common event that application packages have not been suspended.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGES_UNSUSPENDED);
+    events.emplace_back(COMMON_EVENT_PACKAGES_UNSUSPENDED);
     /**
      * Indicates the action of a common event that an application package has been suspended.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_MY_PACKAGE_SUSPENDED);
+    events.emplace_back(COMMON_EVENT_MY_PACKAGE_SUSPENDED);
     /**
      * Indicates the action of a common event that an application package has not been suspended.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_MY_PACKAGE_UNSUSPENDED);
+    events.emplace_back(COMMON_EVENT_MY_PACKAGE_UNSUSPENDED);
     /**
      * Indicates the action of a common event that a user ID has been removed from the system.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_UID_REMOVED);
+    events.emplace_back(COMMON_EVENT_UID_REMOVED);
     /**
      * Indicates the action of a common event that an installed application is started for the first time.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_FIRST_LAUNCH);
+    events.emplace_back(COMMON_EVENT_PACKAGE_FIRST_LAUNCH);
     /**
      * Indicates the action of a common event that an application requires system verification.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_NEEDS_VERIFICATION);
+    events.emplace_back(COMMON_EVENT_PACKAGE_NEEDS_VERIFICATION);
     /**
      * Indicates the action of a common event that an application has been verified by the system.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PACKAGE_VERIFIED);
+    events.emplace_back(COMMON_EVENT_PACKAGE_VERIFIED);
 
     /**
      * Indicates the action of a common event that applications installed on the external storage become
      * available for the system.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_EXTERNAL_APPLICATIONS_AVAILABLE);
+    events.emplace_back(COMMON_EVENT_EXTERNAL_APPLICATIONS_AVAILABLE);
     /**
      * Indicates the action of a common event that applications installed on the external storage become unavailable for
      * the system.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_EXTERNAL_APPLICATIONS_UNAVAILABLE);
+    events.emplace_back(COMMON_EVENT_EXTERNAL_APPLICATIONS_UNAVAILABLE);
 
     /**
      * Indicates the action of a common event that the device state (for example, orientation and locale) has changed.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_CONFIGURATION_CHANGED);
+    events.emplace_back(COMMON_EVENT_CONFIGURATION_CHANGED);
     /**
      * Indicates the action of a common event that the device locale has changed.
      * This common event can only be published by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_LOCALE_CHANGED);
+    events.emplace_back(COMMON_EVENT_LOCALE_CHANGED);
 
     /**
      * Indicates the action of a common event that the device storage is insufficient.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_MANAGE_PACKAGE_STORAGE);
+    events.emplace_back(COMMON_EVENT_MANAGE_PACKAGE_STORAGE);
 
     /**
      * Indicates the action of a common event that one sandbox package is installed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SANDBOX_PACKAGE_ADDED);
+    events.emplace_back(COMMON_EVENT_SANDBOX_PACKAGE_ADDED);
     /**
      * Indicates the action of a common event that one sandbox package is uninstalled.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SANDBOX_PACKAGE_REMOVED);
+    events.emplace_back(COMMON_EVENT_SANDBOX_PACKAGE_REMOVED);
     /**
      * Indicates the action of a common event that the system is in driving mode.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DRIVE_MODE);
+    events.emplace_back(COMMON_EVENT_DRIVE_MODE);
     /**
      * Indicates the action of a common event that the system is in home mode.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_HOME_MODE);
+    events.emplace_back(COMMON_EVENT_HOME_MODE);
     /**
      * Indicates the action of a common event that the system is in office mode.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_OFFICE_MODE);
+    events.emplace_back(COMMON_EVENT_OFFICE_MODE);
 
     /**
     * Indicates the action of a common event that the window mode is split screen.
     * This is a protected common event, which can be sent only by the system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SPLIT_SCREEN);
+    events.emplace_back(COMMON_EVENT_SPLIT_SCREEN);
 
     /**
      * Indicates the action of a common event that the user has been started.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_STARTED);
+    events.emplace_back(COMMON_EVENT_USER_STARTED);
     /**
      * Indicates the action of a common event that the user has been brought to the background.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_BACKGROUND);
+    events.emplace_back(COMMON_EVENT_USER_BACKGROUND);
     /**
      * Indicates the action of a common event that the user has been brought to the foreground.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_FOREGROUND);
+    events.emplace_back(COMMON_EVENT_USER_FOREGROUND);
     /**
      * Indicates the action of a common event that a user switch is happening.
      * To subscribe to this common event, your application must have the ohos.permission.MANAGE_LOCAL_ACCOUNTS
      * permission or ohos.permission.INTERACT_ACROSS_LOCAL_ACCOUNTS permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_SWITCHED);
+    events.emplace_back(COMMON_EVENT_USER_SWITCHED);
     /**
      * Indicates the action of a common event that the user is going to be started.
      * To subscribe to this common event, your application must have the ohos.permission.INTERACT_ACROSS_LOCAL_ACCOUNTS
      * permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_STARTING);
+    events.emplace_back(COMMON_EVENT_USER_STARTING);
     /**
      * Indicates the action of a common event that the credential-encrypted storage has become unlocked
      * for the current user when the device is unlocked after being restarted.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_UNLOCKED);
+    events.emplace_back(COMMON_EVENT_USER_UNLOCKED);
     /**
      * Indicates the action of a common event that the user is going to be stopped.
      * To subscribe to this common event, your application must have the ohos.permission.INTERACT_ACROSS_LOCAL_ACCOUNTS
      * permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_STOPPING);
+    events.emplace_back(COMMON_EVENT_USER_STOPPING);
     /**
      * Indicates the action of a common event that the user has been stopped.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_STOPPED);
+    events.emplace_back(COMMON_EVENT_USER_STOPPED);
     /**
      * Indicates the action of a common event about a login of a user with account ID.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_HWID_LOGIN);
+    events.emplace_back(COMMON_EVENT_HWID_LOGIN);
     /**
      * Indicates the action of a common event about a logout of a user with account ID.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_HWID_LOGOUT);
+    events.emplace_back(COMMON_EVENT_HWID_LOGOUT);
     /**
      * Indicates the action of a common event that the account ID is invalid.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_HWID_TOKEN_INVALID);
+    events.emplace_back(COMMON_EVENT_HWID_TOKEN_INVALID);
     /**
      * Indicates the action of a common event about a logoff of a account ID.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_HWID_LOGOFF);
+    events.emplace_back(COMMON_EVENT_HWID_LOGOFF);
 
     /**
      * Indicates the action of a common event about the Wi-Fi state, such as enabled and disabled.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_POWER_STATE);
+    events.emplace_back(COMMON_EVENT_WIFI_POWER_STATE);
 
     /**
      * Indicates the action of a common event that the Wi-Fi access point has been scanned and proven to be available.
      * To subscribe to this common event, your application must have the ohos.permission.LOCATION permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_SCAN_FINISHED);
+    events.emplace_back(COMMON_EVENT_WIFI_SCAN_FINISHED);
 
     /**
      * Indicates the action of a common event that the Wi-Fi signal strength (RSSI) has changed.
      * To subscribe to this common event, your application must have the ohos.permission.GET_WIFI_INFO permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_RSSI_VALUE);
+    events.emplace_back(COMMON_EVENT_WIFI_RSSI_VALUE);
 
     /**
      * Indicates the action of a common event that the Wi-Fi connection state has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_CONN_STATE);
+    events.emplace_back(COMMON_EVENT_WIFI_CONN_STATE);
 
     /**
      * Indicates the action of a common event about the Wi-Fi hotspot state, such as enabled or disabled.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_HOTSPOT_STATE);
+    events.emplace_back(COMMON_EVENT_WIFI_HOTSPOT_STATE);
 
     /**
      * Indicates the action of a common event that a client has joined the Wi-Fi hotspot of the current device. You can
      * register this common event to listen for information about the clients joining your hotspot.
      * To subscribe to this common event, your application must have the ohos.permission.GET_WIFI_INFO permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_AP_STA_JOIN);
+    events.emplace_back(COMMON_EVENT_WIFI_AP_STA_JOIN);
 
     /**
      * Indicates the action of a common event that a client has dropped connection to the Wi-Fi hotspot of the current
      * device. You can register this common event to listen for information about the clients leaving your hotspot.
      * To subscribe to this common event, your application must have the ohos.permission.GET_WIFI_INFO permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_AP_STA_LEAVE);
+    events.emplace_back(COMMON_EVENT_WIFI_AP_STA_LEAVE);
 
     /**
      * Indicates the action of a common event that the state of MPLink (an enhanced Wi-Fi feature) has changed.
      * To subscribe to this common event, your application must have the ohos.permission.MPLINK_CHANGE_STATE permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_MPLINK_STATE_CHANGE);
+    events.emplace_back(COMMON_EVENT_WIFI_MPLINK_STATE_CHANGE);
 
     /**
      * Indicates the action of a common event that the Wi-Fi P2P connection state has changed.
      * To subscribe to this common event, your application must have the ohos.permission.GET_WIFI_INFO and
      * ohos.permission.LOCATION permissions.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_P2P_CONN_STATE);
+    events.emplace_back(COMMON_EVENT_WIFI_P2P_CONN_STATE);
 
     /**
      * Indicates the action of a common event about the Wi-Fi P2P state, such as enabled and disabled.
      * To subscribe to this common event, your application must have the ohos.permission.GET_WIFI_INFO permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_P2P_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_WIFI_P2P_STATE_CHANGED);
 
     /**
      * Indicates that the Wi-Fi P2P peers state change.
      * To subscribe to this common event, your application must have the ohos.permission.GET_WIFI_INFO permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_P2P_PEERS_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_WIFI_P2P_PEERS_STATE_CHANGED);
 
     /**
      * Indicates that the Wi-Fi P2P discovery state change.
      * To subscribe to this common event, your application must have the ohos.permission.GET_WIFI_INFO permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_P2P_PEERS_DISCOVERY_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_WIFI_P2P_PEERS_DISCOVERY_STATE_CHANGED);
 
     /**
      * Indicates that the Wi-Fi P2P current device state change.
      * To subscribe to this common event, your application must have the ohos.permission.GET_WIFI_INFO permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_P2P_CURRENT_DEVICE_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_WIFI_P2P_CURRENT_DEVICE_STATE_CHANGED);
 
     /**
      * Indicates that the Wi-Fi P2P group info is changed.
      * To subscribe to this common event, your application must have the ohos.permission.GET_WIFI_INFO permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_WIFI_P2P_GROUP_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_WIFI_P2P_GROUP_STATE_CHANGED);
 
     /**
      * Indicates that network traffic statistics have been updated.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_NETMANAGER_NETSTATES_UPDATED);
+    events.emplace_back(COMMON_EVENT_NETMANAGER_NETSTATES_UPDATED);
 
     /**
      * Indicates that the network traffic has exceeded the limit.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_NETMANAGER_NETSTATES_LIMITED);
+    events.emplace_back(COMMON_EVENT_NETMANAGER_NETSTATES_LIMITED);
 
     /**
      * Indicates the action of a common event about the connection state of Bluetooth handsfree communication.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREE_AG_CONNECT_STATE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREE_AG_CONNECT_STATE_UPDATE);
 
     /**
      * Indicates the action of a common event that bluetooth handsfree ag connection state change.
      * To subscribe to this protected common event, your application must have the ohos.permission.ACCESS_BLUETOOTH
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREE_AG_CONNECT_STATE_CHANGE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREE_AG_CONNECT_STATE_CHANGE);
 
     /**
      * Indicates the action of a common event that the device connected to the Bluetooth handsfree is active.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREE_AG_CURRENT_DEVICE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREE_AG_CURRENT_DEVICE_UPDATE);
 
     /**
      * Indicates the action of a common event that the connection state of Bluetooth A2DP has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREE_AG_AUDIO_STATE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREE_AG_AUDIO_STATE_UPDATE);
 
     /**
      * Indicates the action of a common event about the connection state of Bluetooth A2DP.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CONNECT_STATE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CONNECT_STATE_UPDATE);
 
     /**
      * Indicates the action of a common event that bluetooth a2dp source connection state change.
      * To subscribe to this protected common event, your application must have the ohos.permission.ACCESS_BLUETOOTH
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CONNECT_STATE_CHANGE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CONNECT_STATE_CHANGE);
 
     /**
      * Indicates the action of a common event that the device connected using Bluetooth A2DP is active.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CURRENT_DEVICE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CURRENT_DEVICE_UPDATE);
 
     /**
      * Indicates the action of a common event that the playing state of Bluetooth A2DP has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_PLAYING_STATE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_PLAYING_STATE_UPDATE);
 
     /**
      * Indicates the action of a common event that the AVRCP connection state of Bluetooth A2DP has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_AVRCP_CONNECT_STATE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_AVRCP_CONNECT_STATE_UPDATE);
 
     /**
      * Indicates the action of a common event that bluetooth avrcp connection state change.
      * To subscribe to this protected common event, your application must have the ohos.permission.ACCESS_BLUETOOTH
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_AVRCP_CONNECT_STATE_CHANGE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_AVRCP_CONNECT_STATE_CHANGE);
 
     /**
      * Indicates the action of a common event that the audio codec state of Bluetooth A2DP has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CODEC_VALUE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CODEC_VALUE_UPDATE);
 
     /**
      * Indicates the action of a common event that bluetooth codec change.
      * To subscribe to this protected common event, your application must have the ohos.permission.ACCESS_BLUETOOTH
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CODEC_VALUE_CHANGE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CODEC_VALUE_CHANGE);
 
     /**
      * Indicates the action of a common event that bluetooth remote device a2dp play state change.
      * To subscribe to this protected common event, your application must have the ohos.permission.ACCESS_BLUETOOTH
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_PLAY_STATE_CHANGE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSOURCE_PLAY_STATE_CHANGE);
 
     /**
      * Indicates the action of a common event that bluetooth remote device sco state change.
      * To subscribe to this protected common event, your application must have the ohos.permission.ACCESS_BLUETOOTH
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_SCO_CONNECT_STATE_CHANGE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_SCO_CONNECT_STATE_CHANGE);
     /**
      * Indicates the action of a common event that a remote Bluetooth device has been discovered.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_DISCOVERED);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_DISCOVERED);
 
     /**
      * Indicates the action of a common event that the Bluetooth class of a remote Bluetooth device has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_CLASS_VALUE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_CLASS_VALUE_UPDATE);
 
     /**
      * Indicates the action of a common event that a low level (ACL) connection has been established with a remote
      * Bluetooth device.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_ACL_CONNECTED);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_ACL_CONNECTED);
 
     /**
      * Indicates the action of a common event that a low level (ACL) connection has been disconnected from a remote
      * Bluetooth device.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_ACL_DISCONNECTED);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_ACL_DISCONNECTED);
 
     /**
      * Indicates the action of a common event that bluetooth remote device acl state change.
      * To subscribe to this protected common event, your application must have the ohos.permission.ACCESS_BLUETOOTH
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_ACL_STATE_CHANGE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_ACL_STATE_CHANGE);
 
     /**
      * Indicates the action of a common event that the friendly name of a remote Bluetooth device has been retrieved for
      * the first time or has been changed since the last retrieval.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_NAME_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_NAME_UPDATE);
 
     /**
      * Indicates the action of a common event that the connection state of a remote Bluetooth device has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_PAIR_STATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_PAIR_STATE);
 
     /**
      * Indicates the action of a common event that bluetooth pair state change.
      * To subscribe to this protected common event, your application must have the ohos.permission.ACCESS_BLUETOOTH
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_PAIR_STATE_CHANGE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_PAIR_STATE_CHANGE);
 
     /**
      * Indicates the action of a common event that the battery level of a remote Bluetooth device has been retrieved
      * for the first time or has been changed since the last retrieval.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_BATTERY_VALUE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_BATTERY_VALUE_UPDATE);
 
     /**
      * Indicates the action of a common event about the SDP state of a remote Bluetooth device.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_SDP_RESULT);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_SDP_RESULT);
 
     /**
      * Indicates the action of a common event about the UUID connection state of a remote Bluetooth device.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_UUID_VALUE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_UUID_VALUE);
 
     /**
      * Indicates the action of a common event about the pairing request from a remote Bluetooth device.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_PAIRING_REQ);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_PAIRING_REQ);
 
     /**
      * Indicates the action of a common event that Bluetooth pairing is canceled.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_PAIRING_CANCEL);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_PAIRING_CANCEL);
 
     /**
      * Indicates the action of a common event about the connection request from a remote Bluetooth device.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_CONNECT_REQ);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_CONNECT_REQ);
 
     /**
      * Indicates the action of a common event about the response to the connection request from a remote Bluetooth
      * device.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_CONNECT_REPLY);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_CONNECT_REPLY);
 
     /**
      * Indicates the action of a common event that the connection to a remote Bluetooth device has been canceled.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_CONNECT_CANCEL);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_CONNECT_CANCEL);
 
     /**
      * Indicates the action of a common event that the connection state of a Bluetooth handsfree has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREEUNIT_CONNECT_STATE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREEUNIT_CONNECT_STATE_UPDATE);
 
     /**
      * Indicates the action of a common event that the audio state of a Bluetooth handsfree has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREEUNIT_AUDIO_STATE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREEUNIT_AUDIO_STATE_UPDATE);
 
     /**
      * Indicates the action of a common event that the audio gateway state of a Bluetooth handsfree has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREEUNIT_AG_COMMON_EVENT);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREEUNIT_AG_COMMON_EVENT);
 
     /**
      * Indicates the action of a common event that the calling state of a Bluetooth handsfree has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREEUNIT_AG_CALL_STATE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HANDSFREEUNIT_AG_CALL_STATE_UPDATE);
 
     /**
      * Indicates the action of a common event that the state of a Bluetooth adapter has been changed, for example,
      * Bluetooth has been turned on or off.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_STATE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_STATE_UPDATE);
 
     /**
      * Indicates the action of a common event about the requests for the user to allow Bluetooth to be scanned.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_REQ_DISCOVERABLE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_REQ_DISCOVERABLE);
 
     /**
      * Indicates the action of a common event about the requests for the user to turn on Bluetooth.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_REQ_ENABLE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_REQ_ENABLE);
 
     /**
      * Indicates the action of a common event about the requests for the user to turn off Bluetooth.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_REQ_DISABLE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_REQ_DISABLE);
 
     /**
      * Indicates the action of a common event that the Bluetooth scanning mode of a device has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_SCAN_MODE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_SCAN_MODE_UPDATE);
 
     /**
      * Indicates the action of a common event that bluetooth scan mode change.
      * To subscribe to this protected common event, your application must have the ohos.permission.ACCESS_BLUETOOTH
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_SCAN_MODE_CHANGE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_SCAN_MODE_CHANGE);
 
     /**
      * Indicates the action of a common event that the Bluetooth scanning has been started on the device.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_DISCOVERY_STARTED);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_DISCOVERY_STARTED);
 
     /**
      * Indicates the action of a common event that the Bluetooth scanning is finished on the device.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_DISCOVERY_FINISHED);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_DISCOVERY_FINISHED);
 
     /**
      * Indicates the action of a common event that the Bluetooth adapter name of the device has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_NAME_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_HOST_NAME_UPDATE);
 
     /**
      * Indicates the action of a common event that the connection state of Bluetooth A2DP Sink has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSINK_CONNECT_STATE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSINK_CONNECT_STATE_UPDATE);
 
     /**
      * Indicates the action of a common event that the playing state of Bluetooth A2DP Sink has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSINK_PLAYING_STATE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSINK_PLAYING_STATE_UPDATE);
 
     /**
      * Indicates the action of a common event that the audio state of Bluetooth A2DP Sink has changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSINK_AUDIO_STATE_UPDATE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_A2DPSINK_AUDIO_STATE_UPDATE);
 
      /**
      * Indicates the status of the Bluetooth device connect status has been changed.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_CONNECT_STATUS_VALUE);
+    events.emplace_back(COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_CONNECT_STATUS_VALUE);
 
     /**
      * Indicates the action of a common event that the state of the device NFC adapter has changed.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_NFC_ACTION_ADAPTER_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_NFC_ACTION_ADAPTER_STATE_CHANGED);
 
     /**
      * Indicates the action of a common event that the NFC RF field is detected to be in the enabled state.
@@ -2511,7 +2512,7 @@ void CommonEventSupport::Init()
      * permission.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_NFC_ACTION_RF_FIELD_ON_DETECTED);
+    events.emplace_back(COMMON_EVENT_NFC_ACTION_RF_FIELD_ON_DETECTED);
 
     /**
      * Indicates the action of a common event that the NFC RF field is detected to be in the disabled state.
@@ -2519,56 +2520,56 @@ void CommonEventSupport::Init()
      * permission.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_NFC_ACTION_RF_FIELD_OFF_DETECTED);
+    events.emplace_back(COMMON_EVENT_NFC_ACTION_RF_FIELD_OFF_DETECTED);
 
     /**
      * Indicates the action of a common event that the system stops charging the battery.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISCHARGING);
+    events.emplace_back(COMMON_EVENT_DISCHARGING);
 
     /**
      * Indicates the action of a common event that the system starts charging the battery.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_CHARGING);
+    events.emplace_back(COMMON_EVENT_CHARGING);
 
     /**
      * Indicates the action of a common event that a charge type has been updated.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_CHARGE_TYPE_CHANGED);
+    events.emplace_back(COMMON_EVENT_CHARGE_TYPE_CHANGED);
 
     /**
      * Indicates the action of a common event that the system idle mode has changed.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DEVICE_IDLE_MODE_CHANGED);
+    events.emplace_back(COMMON_EVENT_DEVICE_IDLE_MODE_CHANGED);
 
     /**
      * Indicates the action of a common event that the list of exempt applications is updated in the idle mode.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DEVICE_IDLE_EXEMPTION_LIST_UPDATED);
+    events.emplace_back(COMMON_EVENT_DEVICE_IDLE_EXEMPTION_LIST_UPDATED);
 
     /**
      * Indicates the action of a common event that the power save mode of the system has changed.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_POWER_SAVE_MODE_CHANGED);
+    events.emplace_back(COMMON_EVENT_POWER_SAVE_MODE_CHANGED);
 
     /**
      * Indicates the action of a common event that a user has been added to the system.
      * To subscribe to this common event, your application must have the ohos.permission.MANAGE_LOCAL_ACCOUNTS
      * permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_ADDED);
+    events.emplace_back(COMMON_EVENT_USER_ADDED);
     /**
      * Indicates the action of a common event that a user has been removed from the system.
      * To subscribe to this common event, your application must have the ohos.permission.MANAGE_LOCAL_ACCOUNTS
      * permission.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_REMOVED);
+    events.emplace_back(COMMON_EVENT_USER_REMOVED);
 
     /**
      * Indicates the action of a common event that an ability has been added.
@@ -2576,7 +2577,7 @@ void CommonEventSupport::Init()
      * permission.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_ABILITY_ADDED);
+    events.emplace_back(COMMON_EVENT_ABILITY_ADDED);
 
     /**
      * Indicates the action of a common event that an ability has been removed.
@@ -2584,7 +2585,7 @@ void CommonEventSupport::Init()
      * permission.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_ABILITY_REMOVED);
+    events.emplace_back(COMMON_EVENT_ABILITY_REMOVED);
 
     /**
      * Indicates the action of a common event that an ability has been updated.
@@ -2592,246 +2593,246 @@ void CommonEventSupport::Init()
      * permission.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_ABILITY_UPDATED);
+    events.emplace_back(COMMON_EVENT_ABILITY_UPDATED);
 
     /**
      * Indicates the action of a common event that the location mode of the system has changed.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_LOCATION_MODE_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_LOCATION_MODE_STATE_CHANGED);
 
     /**
      * Indicates the action of a common event that the in-vehicle infotainment (IVI) system of a vehicle is sleeping.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_IVI_SLEEP);
+    events.emplace_back(COMMON_EVENT_IVI_SLEEP);
 
     /**
      * The ivi is slept and notify the app stop playing.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_IVI_PAUSE);
+    events.emplace_back(COMMON_EVENT_IVI_PAUSE);
 
     /**
      * Indicates the action of a common event that a third-party application is instructed to pause the current work.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_IVI_STANDBY);
+    events.emplace_back(COMMON_EVENT_IVI_STANDBY);
 
     /**
      * Indicates the action of a common event that a third-party application is instructed to save its last mode.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_IVI_LASTMODE_SAVE);
+    events.emplace_back(COMMON_EVENT_IVI_LASTMODE_SAVE);
 
     /**
      * Indicates the action of a common event that the voltage of the vehicle power system is abnormal.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_IVI_VOLTAGE_ABNORMAL);
+    events.emplace_back(COMMON_EVENT_IVI_VOLTAGE_ABNORMAL);
 
     /**
      * The ivi temperature is too high.
      * This is a protected common event that can only be sent by system.
      * This common event will be delete later, please use COMMON_EVENT_IVI_TEMPERATURE_ABNORMAL.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_IVI_HIGH_TEMPERATURE);
+    events.emplace_back(COMMON_EVENT_IVI_HIGH_TEMPERATURE);
 
     /**
      * The ivi temperature is extreme high.
      * This is a protected common event that can only be sent by system.
      * This common event will be delete later, please use COMMON_EVENT_IVI_TEMPERATURE_ABNORMAL.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_IVI_EXTREME_TEMPERATURE);
+    events.emplace_back(COMMON_EVENT_IVI_EXTREME_TEMPERATURE);
 
     /**
      * Indicates the action of a common event that the in-vehicle system has an extreme temperature.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_IVI_TEMPERATURE_ABNORMAL);
+    events.emplace_back(COMMON_EVENT_IVI_TEMPERATURE_ABNORMAL);
 
     /**
      * Indicates the action of a common event that the voltage of the vehicle power system is restored to normal.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_IVI_VOLTAGE_RECOVERY);
+    events.emplace_back(COMMON_EVENT_IVI_VOLTAGE_RECOVERY);
 
     /**
      * Indicates the action of a common event that the temperature of the in-vehicle system is restored to normal.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_IVI_TEMPERATURE_RECOVERY);
+    events.emplace_back(COMMON_EVENT_IVI_TEMPERATURE_RECOVERY);
 
     /**
      * Indicates the action of a common event that the battery service is active.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_IVI_ACTIVE);
+    events.emplace_back(COMMON_EVENT_IVI_ACTIVE);
 
     /**
      * The usb state changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USB_STATE);
+    events.emplace_back(COMMON_EVENT_USB_STATE);
 
     /**
      * The usb port changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USB_PORT_CHANGED);
+    events.emplace_back(COMMON_EVENT_USB_PORT_CHANGED);
 
     /**
      * Indicates the action of a common event that a USB device has been attached when the user device functions as a
      * USB host.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USB_DEVICE_ATTACHED);
+    events.emplace_back(COMMON_EVENT_USB_DEVICE_ATTACHED);
 
     /**
      * Indicates the action of a common event that a USB device has been detached when the user device functions as a
      * USB host.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USB_DEVICE_DETACHED);
+    events.emplace_back(COMMON_EVENT_USB_DEVICE_DETACHED);
 
     /**
      * Indicates the action of a common event that a USB accessory has been attached.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USB_ACCESSORY_ATTACHED);
+    events.emplace_back(COMMON_EVENT_USB_ACCESSORY_ATTACHED);
 
     /**
      * Indicates the action of a common event that a USB accessory has been detached.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USB_ACCESSORY_DETACHED);
+    events.emplace_back(COMMON_EVENT_USB_ACCESSORY_DETACHED);
 
     /**
      * Indicates the action of a common event that a USB control data.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USB_CONTROL_DATA);
+    events.emplace_back(COMMON_EVENT_USB_CONTROL_DATA);
 
     /**
      * The storage space is low.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DEVICE_STORAGE_LOW);
+    events.emplace_back(COMMON_EVENT_DEVICE_STORAGE_LOW);
 
     /**
      * The storage space is normal.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DEVICE_STORAGE_OK);
+    events.emplace_back(COMMON_EVENT_DEVICE_STORAGE_OK);
 
     /**
      * The storage space is full.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DEVICE_STORAGE_FULL);
+    events.emplace_back(COMMON_EVENT_DEVICE_STORAGE_FULL);
 
     /**
      * The network connection was changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_CONNECTIVITY_CHANGE);
+    events.emplace_back(COMMON_EVENT_CONNECTIVITY_CHANGE);
 
     /**
      * The global http proxy was changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_HTTP_PROXY_CHANGE);
+    events.emplace_back(COMMON_EVENT_HTTP_PROXY_CHANGE);
 
     /**
      * Indicates the action of a common event that an external storage device was removed.
      * To subscribe to this common event, your application must have the ohos.permission.STORAGE_MANAGER permission.
      * This common event can be published only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISK_REMOVED);
+    events.emplace_back(COMMON_EVENT_DISK_REMOVED);
 
     /**
      * Indicates the action of a common event that an external storage device was unmounted.
      * To subscribe to this common event, your application must have the ohos.permission.STORAGE_MANAGER permission.
      * This common event can be published only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISK_UNMOUNTED);
+    events.emplace_back(COMMON_EVENT_DISK_UNMOUNTED);
 
     /**
      * Indicates the action of a common event that an external storage device was mounted.
      * To subscribe to this common event, your application must have the ohos.permission.STORAGE_MANAGER permission.
      * This common event can be published only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISK_MOUNTED);
+    events.emplace_back(COMMON_EVENT_DISK_MOUNTED);
 
     /**
      * Indicates the action of a common event that an external storage device was removed without being unmounted.
      * To subscribe to this common event, your application must have the ohos.permission.STORAGE_MANAGER permission.
      * This common event can be published only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISK_BAD_REMOVAL);
+    events.emplace_back(COMMON_EVENT_DISK_BAD_REMOVAL);
 
     /**
      * Indicates the action of a common event that an external storage device becomes unmountable.
      * To subscribe to this common event, your application must have the ohos.permission.STORAGE_MANAGER permission.
      * This common event can be published only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISK_UNMOUNTABLE);
+    events.emplace_back(COMMON_EVENT_DISK_UNMOUNTABLE);
 
     /**
      * Indicates the action of a common event that the state of a system data disk volume has changed.
      * To subscribe to this common event, your application must have the ohos.permission.STORAGE_MANAGER permission.
      * This common event can be published only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISK_VOLUME_STATE_CHANGE);
+    events.emplace_back(COMMON_EVENT_DISK_VOLUME_STATE_CHANGE);
 
     /**
      * Indicates the action of a common event that an external storage device was ejected.
      * To subscribe to this common event, your application must have the ohos.permission.STORAGE_MANAGER permission.
      * This common event can be published only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISK_EJECT);
+    events.emplace_back(COMMON_EVENT_DISK_EJECT);
 
     /**
      * Indicates the action of a common event that an external storage device was removed.
      * To subscribe to this common event, your application must have the ohos.permission.STORAGE_MANAGER permission.
      * This common event can be published only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_VOLUME_REMOVED);
+    events.emplace_back(COMMON_EVENT_VOLUME_REMOVED);
 
     /**
      * Indicates the action of a common event that an external storage device was unmounted.
      * To subscribe to this common event, your application must have the ohos.permission.STORAGE_MANAGER permission.
      * This common event can be published only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_VOLUME_UNMOUNTED);
+    events.emplace_back(COMMON_EVENT_VOLUME_UNMOUNTED);
 
     /**
      * Indicates the action of a common event that an external storage device was mounted.
      * To subscribe to this common event, your application must have the ohos.permission.STORAGE_MANAGER permission.
      * This common event can be published only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_VOLUME_MOUNTED);
+    events.emplace_back(COMMON_EVENT_VOLUME_MOUNTED);
 
     /**
      * Indicates the action of a common event that an external storage device was removed without being unmounted.
      * To subscribe to this common event, your application must have the ohos.permission.STORAGE_MANAGER permission.
      * This common event can be published only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_VOLUME_BAD_REMOVAL);
+    events.emplace_back(COMMON_EVENT_VOLUME_BAD_REMOVAL);
 
     /**
      * Indicates the action of a common event that an external storage device was ejected.
      * To subscribe to this common event, your application must have the ohos.permission.STORAGE_MANAGER permission.
      * This common event can be published only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_VOLUME_EJECT);
+    events.emplace_back(COMMON_EVENT_VOLUME_EJECT);
 
     /**
      * Indicates the action of a common event that the account visible changed.
      * To subscribe to this common event, your application must have the ohos.permission.GET_APP_ACCOUNTS permission.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_VISIBLE_ACCOUNTS_UPDATED);
+    events.emplace_back(COMMON_EVENT_VISIBLE_ACCOUNTS_UPDATED);
 
     /**
      * Indicates the action of a common event that the account is deleted.
@@ -2839,7 +2840,7 @@ void CommonEventSupport::Init()
      * permission.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_ACCOUNT_DELETED);
+    events.emplace_back(COMMON_EVENT_ACCOUNT_DELETED);
 
     /**
      * Indicates the action of a common event that the foundation is ready.
@@ -2847,133 +2848,133 @@ void CommonEventSupport::Init()
      * permission.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_FOUNDATION_READY);
+    events.emplace_back(COMMON_EVENT_FOUNDATION_READY);
 
     /**
      * Indicates the action of a common event that the application is launched for the first time after installation.
      * This common event is published when the UIAbility is started for the first time after installation.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_APP_FIRST_LAUNCH);
+    events.emplace_back(COMMON_EVENT_APP_FIRST_LAUNCH);
 
     /**
      * Indicates the action of a common event that the default voice subscription has changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SIM_CARD_DEFAULT_VOICE_SUBSCRIPTION_CHANGED);
+    events.emplace_back(COMMON_EVENT_SIM_CARD_DEFAULT_VOICE_SUBSCRIPTION_CHANGED);
 
     /**
      * Indicates the action of a common event that the phone SIM card state has changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SIM_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_SIM_STATE_CHANGED);
 
     /**
      * Indicates the action of a common event that the airplane mode of the device has changed.
      * This common event can be triggered only by system applications.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_AIRPLANE_MODE_CHANGED);
+    events.emplace_back(COMMON_EVENT_AIRPLANE_MODE_CHANGED);
 
     /**
      * Indicates the action of a common event that a new sms bas been received by the device.
      * To subscribe to this common event, your application must have the ohos.permission.RECEIVE_SMS permission.
      * This common event can be triggered only by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SMS_RECEIVE_COMPLETED);
+    events.emplace_back(COMMON_EVENT_SMS_RECEIVE_COMPLETED);
 
     /**
      * Indicates the action of a common event that a new sms emergency cell broadcast bas been received by the device.
      * This common event can be triggered only by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SMS_EMERGENCY_CB_RECEIVE_COMPLETED);
+    events.emplace_back(COMMON_EVENT_SMS_EMERGENCY_CB_RECEIVE_COMPLETED);
 
     /**
      * Indicates the action of a common event that a new sms normal cell broadcast bas been received by the device.
      * This common event can be triggered only by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SMS_CB_RECEIVE_COMPLETED);
+    events.emplace_back(COMMON_EVENT_SMS_CB_RECEIVE_COMPLETED);
 
     /**
      * Indicates the action of a common event that a STK command has been received by the device.
      * This common event can be triggered only by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_STK_COMMAND);
+    events.emplace_back(COMMON_EVENT_STK_COMMAND);
 
     /**
      * Indicates the action of a common event that STK session end.
      * This common event can be triggered only by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_STK_SESSION_END);
+    events.emplace_back(COMMON_EVENT_STK_SESSION_END);
 
     /**
      * Indicates the action of a common event that the STK phone card state has changed.
      * This common event can be triggered only by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_STK_CARD_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_STK_CARD_STATE_CHANGED);
 
     /**
      * Indicates the action of a common event that an alpha string during call control  has been received by the device.
      * This common event can be triggered only by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_STK_ALPHA_IDENTIFIER);
+    events.emplace_back(COMMON_EVENT_STK_ALPHA_IDENTIFIER);
 
     /**
      * Indicates the action of a common event that the spn display information has been updated.
      * This common event can be triggered only by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SPN_INFO_CHANGED);
+    events.emplace_back(COMMON_EVENT_SPN_INFO_CHANGED);
 
     /**
      * Indicates the action of a common event that the NITZ time has been updated.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_NITZ_TIME_CHANGED);
+    events.emplace_back(COMMON_EVENT_NITZ_TIME_CHANGED);
 
     /**
      * Indicates the action of a common event that the NITZ time zone has been updated.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_NITZ_TIMEZONE_CHANGED);
+    events.emplace_back(COMMON_EVENT_NITZ_TIMEZONE_CHANGED);
 
     /**
      * Indicates the action of a common event that a new sms wappush has been received by the device.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SMS_WAPPUSH_RECEIVE_COMPLETED);
+    events.emplace_back(COMMON_EVENT_SMS_WAPPUSH_RECEIVE_COMPLETED);
 
     /**
      * Indicates the action of a common event that the operator config has been updated.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_OPERATOR_CONFIG_CHANGED);
+    events.emplace_back(COMMON_EVENT_OPERATOR_CONFIG_CHANGED);
 
     /**
      * Indicates the action of a common event that the notification slot has been updated.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SLOT_CHANGE);
+    events.emplace_back(COMMON_EVENT_SLOT_CHANGE);
 
     /**
      * Only for test case.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_TEST_ACTION1);
+    events.emplace_back(COMMON_EVENT_TEST_ACTION1);
 
     /**
      * Only for test case.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_TEST_ACTION2);
+    events.emplace_back(COMMON_EVENT_TEST_ACTION2);
 
     /**
      * Indicates the action of a common event that the default SMS subscription has been changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SIM_CARD_DEFAULT_SMS_SUBSCRIPTION_CHANGED);
+    events.emplace_back(COMMON_EVENT_SIM_CARD_DEFAULT_SMS_SUBSCRIPTION_CHANGED);
 
     /**
      * Indicates the action of a common event that the default data subscription has been changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SIM_CARD_DEFAULT_DATA_SUBSCRIPTION_CHANGED);
+    events.emplace_back(COMMON_EVENT_SIM_CARD_DEFAULT_DATA_SUBSCRIPTION_CHANGED);
 
     /**
      * Indicates the action of a common event that the call state has been changed.
@@ -2981,43 +2982,43 @@ void CommonEventSupport::Init()
      * permission.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_CALL_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_CALL_STATE_CHANGED);
 
     /**
      * Indicates the action of a common event that the default main subscription has been changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SIM_CARD_DEFAULT_MAIN_SUBSCRIPTION_CHANGED);
+    events.emplace_back(COMMON_EVENT_SIM_CARD_DEFAULT_MAIN_SUBSCRIPTION_CHANGED);
 
     /**
      * Indicates the action of a common event that the status of setting primary slot has been changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SET_PRIMARY_SLOT_STATUS);
+    events.emplace_back(COMMON_EVENT_SET_PRIMARY_SLOT_STATUS);
 
     /**
      * Indicates the action of a common event that the roaming status of main card has been changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PRIMARY_SLOT_ROAMING);
+    events.emplace_back(COMMON_EVENT_PRIMARY_SLOT_ROAMING);
 
     /**
      * Indicates the action of a common event that the cellular data state has been changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_CELLULAR_DATA_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_CELLULAR_DATA_STATE_CHANGED);
 
     /**
      * Indicates the action of a common event that the signal info has been changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SIGNAL_INFO_CHANGED);
+    events.emplace_back(COMMON_EVENT_SIGNAL_INFO_CHANGED);
 
     /**
      * Indicates the action of a common event that the network state has been changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_NETWORK_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_NETWORK_STATE_CHANGED);
 
     /**
      * Indicates the action of a common event that the incoming call has been missed.
@@ -3025,171 +3026,171 @@ void CommonEventSupport::Init()
      * permission.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_INCOMING_CALL_MISSED);
+    events.emplace_back(COMMON_EVENT_INCOMING_CALL_MISSED);
 
     /**
      * Indicate the result of quick fix apply.
      * This common event can be triggered only by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_QUICK_FIX_APPLY_RESULT);
+    events.emplace_back(COMMON_EVENT_QUICK_FIX_APPLY_RESULT);
 
     /**
      * Indicate the result of quick fix revoke.
      * This common event can be triggered only by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_QUICK_FIX_REVOKE_RESULT);
+    events.emplace_back(COMMON_EVENT_QUICK_FIX_REVOKE_RESULT);
 
     /**
      * Indicates the action of a common event that radio state change.
      * To subscribe to this protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_RADIO_STATE_CHANGE);
+    events.emplace_back(COMMON_EVENT_RADIO_STATE_CHANGE);
 
     /**
      * Indicates an OS account sub-profile is created.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_OS_ACCOUNT_SUB_PROFILE_CREATED);
+    events.emplace_back(COMMON_EVENT_OS_ACCOUNT_SUB_PROFILE_CREATED);
 
     /**
      * Indicates an OS account sub-profile is deleted.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_OS_ACCOUNT_SUB_PROFILE_DELETED);
+    events.emplace_back(COMMON_EVENT_OS_ACCOUNT_SUB_PROFILE_DELETED);
 
     /**
      * Indicates an OS account sub-profile is switching.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_OS_ACCOUNT_SUB_PROFILE_SWITCHING);
+    events.emplace_back(COMMON_EVENT_OS_ACCOUNT_SUB_PROFILE_SWITCHING);
 
     /**
      * Indicates an OS account sub-profile is switched.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_OS_ACCOUNT_SUB_PROFILE_SWITCHED);
+    events.emplace_back(COMMON_EVENT_OS_ACCOUNT_SUB_PROFILE_SWITCHED);
 
     /**
      * Indicates a distributed account is bound.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISTRIBUTED_ACCOUNT_BOUND);
+    events.emplace_back(COMMON_EVENT_DISTRIBUTED_ACCOUNT_BOUND);
 
     /**
      * Indicates a distributed account is unbound.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISTRIBUTED_ACCOUNT_UNBOUND);
+    events.emplace_back(COMMON_EVENT_DISTRIBUTED_ACCOUNT_UNBOUND);
 
     /**
     * Indicates the action of a common event about a login of a distributed account.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISTRIBUTED_ACCOUNT_LOGIN);
+    events.emplace_back(COMMON_EVENT_DISTRIBUTED_ACCOUNT_LOGIN);
 
     /**
     * Indicates the action of a common event about a logout of a distributed account.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISTRIBUTED_ACCOUNT_LOGOUT);
+    events.emplace_back(COMMON_EVENT_DISTRIBUTED_ACCOUNT_LOGOUT);
 
     /**
     * Indicates the action of a common event that the token of a distributed account is invalid.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISTRIBUTED_ACCOUNT_TOKEN_INVALID);
+    events.emplace_back(COMMON_EVENT_DISTRIBUTED_ACCOUNT_TOKEN_INVALID);
 
     /**
     * Indicates the action of a common event about a logoff of a distributed account.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DISTRIBUTED_ACCOUNT_LOGOFF);
+    events.emplace_back(COMMON_EVENT_DISTRIBUTED_ACCOUNT_LOGOFF);
 
     /**
     * Indicates the action of a common event that the user information has been updated.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_INFO_UPDATED);
+    events.emplace_back(COMMON_EVENT_USER_INFO_UPDATED);
 
     /**
     * Indicate the action of a common event that domain account status has been changed.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_DOMAIN_ACCOUNT_STATUS_CHANGED);
+    events.emplace_back(COMMON_EVENT_DOMAIN_ACCOUNT_STATUS_CHANGED);
 
     /**
     * Indicate the action of a common event that os account status has been locking.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_LOCKING);
+    events.emplace_back(COMMON_EVENT_USER_LOCKING);
 
     /**
     * Indicate the action of a common event that os account status has been locked.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_USER_LOCKED);
+    events.emplace_back(COMMON_EVENT_USER_LOCKED);
 
     /**
      * Indicates the action of a common event that the screen lock.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SCREEN_LOCKED);
+    events.emplace_back(COMMON_EVENT_SCREEN_LOCKED);
 
     /**
      * Indicates the action of a common event that the screen unlock.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SCREEN_UNLOCKED);
+    events.emplace_back(COMMON_EVENT_SCREEN_UNLOCKED);
 
     /**
     * Indicates the action of a common event that the time to exit from the lock screen.
     * Public events do not concern whether the file system is decrypted.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SCREEN_LOCK_EXITING);
+    events.emplace_back(COMMON_EVENT_SCREEN_LOCK_EXITING);
 
     /**
     * Indicates the action of a common event that the call audio quality information has been updated.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_AUDIO_QUALITY_CHANGE);
+    events.emplace_back(COMMON_EVENT_AUDIO_QUALITY_CHANGE);
 
     /**
     * Indicates the action of a common event about special code.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SPECIAL_CODE);
+    events.emplace_back(COMMON_EVENT_SPECIAL_CODE);
 
     /**
      * Indicates the action of a common event about reminder
      * When the user clicks the button and the application (creator)
      * is in the foreground, a event is sent. event data is: button type,reminder id
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_REMINDER_STATUS_CHANGE);
+    events.emplace_back(COMMON_EVENT_REMINDER_STATUS_CHANGE);
 
     /**
      * Indicates that the privacy status is changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_PRIVACY_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_PRIVACY_STATE_CHANGED);
 
     /**
      * This common event means that minors mode is enabled.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_MINORSMODE_ON);
+    events.emplace_back(COMMON_EVENT_MINORSMODE_ON);
 
     /**
      * This common event means that minors mode is disabled.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_MINORSMODE_OFF);
+    events.emplace_back(COMMON_EVENT_MINORSMODE_OFF);
 
     /**
      * Indicates that the file access state is changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SCREEN_LOCK_FILE_ACCESS_STATE_CHANGED);
+    events.emplace_back(COMMON_EVENT_SCREEN_LOCK_FILE_ACCESS_STATE_CHANGED);
 
     /**
      * Indicates the action of a common event that the bundle resources have been changed.
@@ -3197,134 +3198,134 @@ void CommonEventSupport::Init()
      * permission.
      * This is a protected common event, which can be sent only by the system.
      */
-    commonEventSupport_.emplace_back(COMMON_EVENT_BUNDLE_RESOURCES_CHANGED);
+    events.emplace_back(COMMON_EVENT_BUNDLE_RESOURCES_CHANGED);
 
     /**
      * This common event means that datashare is ready.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_DATA_SHARE_READY);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_DATA_SHARE_READY);
 
     /**
     * This common event means that overlay package is added.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_OVERLAY_PACKAGE_ADDED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_OVERLAY_PACKAGE_ADDED);
 
     /**
     * This common event means that overlay package is changed.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_OVERLAY_PACKAGE_CHANGED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_OVERLAY_PACKAGE_CHANGED);
 
     /**
     * This common event means that disposed rule is added.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_DISPOSED_RULE_ADDED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_DISPOSED_RULE_ADDED);
 
     /**
     * This common event means that disposed rule is deleted.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_DISPOSED_RULE_DELETED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_DISPOSED_RULE_DELETED);
 
     /**
     * This common event means that vpn connection status has been changed.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_VPN_CONNECTION_STATUS_CHANGED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_VPN_CONNECTION_STATUS_CHANGED);
 
     /**
      * Indicates that the second mount is ready.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_SECOND_MOUNTED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_SECOND_MOUNTED);
 
     /**
      * Indicates that an application begins to restored.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_RESTORE_START);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_RESTORE_START);
 
     /**
      * Indicates that an application finished restore.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_RESTORE_END);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_RESTORE_END);
 
     /**
      * Indicates that the managed browser policy is changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_MANAGED_BROWSER_POLICY_CHANGED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_MANAGED_BROWSER_POLICY_CHANGED);
 
     /**
      * Indicates that the default application is changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_DEFAULT_APPLICATION_CHANGED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_DEFAULT_APPLICATION_CHANGED);
 
     /**
      * This common event means that the visibility of shortcut has been changed.
      * To subscribe to this common event, your application must have the ohos.permission.MANAGE_SHORTCUTS permission.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_SHORTCUT_CHANGED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_SHORTCUT_CHANGED);
 
     /**
      * This common event means that a system user joins in the account-related trusted device group.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_TRUSTED_RING_CHECKIN);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_TRUSTED_RING_CHECKIN);
 
     /**
      * This common event means that a system user quits the account-relate trusted device group.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_TRUSTED_RING_CHECKOUT);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_TRUSTED_RING_CHECKOUT);
 
     /**
      * This common event means that the account-related trusted device group has been reset.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_TRUSTED_RING_RESET);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_TRUSTED_RING_RESET);
 
     /**
      * Indicates enter kiosk mode.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_KIOSK_MODE_ON);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_KIOSK_MODE_ON);
 
     /**
      * Indicates exit kiosk mode.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_KIOSK_MODE_OFF);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_KIOSK_MODE_OFF);
 
     /**
      * Indicates that the device has updated the config policy of customazation subsystem.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_CUSTOM_CONFIG_POLICY_UPDATED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_CUSTOM_CONFIG_POLICY_UPDATED);
 
     /**
      * Indicates that the device has updated the custom roaming region of device.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_CUSTOM_ROAMING_REGION_UPDATED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_CUSTOM_ROAMING_REGION_UPDATED);
 
     /**
      * Indicates that the device screen capture.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_SCREEN_SHARE);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_SCREEN_SHARE);
 
     /**
      * Indicates that exit str when cancel before alerting.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_CANCEL_BEFORE_ALERTING);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_CANCEL_BEFORE_ALERTING);
 
     /**
      * Indicates that the cloud disk sync folder info has changed.
@@ -3332,31 +3333,31 @@ void CommonEventSupport::Init()
      * permission.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_CLOUD_DISK_STATE_CHANGED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_CLOUD_DISK_STATE_CHANGED);
 
     /**
      * Indicates that the open and closed state of the stand associated with the tablet mode has changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_TABLET_MODE_CHANGED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_TABLET_MODE_CHANGED);
 
     /**
      * Indicates that the state (open or closed) of the laptop lid has changed.
      * This is a protected common event that can only be sent by system.
      */
-    commonEventSupport_.emplace_back(CommonEventSupport::COMMON_EVENT_LID_STATE_CHANGED);
+    events.emplace_back(CommonEventSupport::COMMON_EVENT_LID_STATE_CHANGED);
 
     /**
     * Indicates that specific volumes on the device have been decrypted.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_VOLUME_DECRYPTED);
+    events.emplace_back(COMMON_EVENT_VOLUME_DECRYPTED);
 
     /**
     * Indicates that specific volumes on the device have been encrypted.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_VOLUME_ENCRYPTED);
+    events.emplace_back(COMMON_EVENT_VOLUME_ENCRYPTED);
 
     /**
     * Indicates that specific volumes on the device have had their encryption policy set.
@@ -3364,19 +3365,19 @@ void CommonEventSupport::Init()
     * permission.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_VOLUME_ENCRYPTION_POLICY_SET);
+    events.emplace_back(COMMON_EVENT_VOLUME_ENCRYPTION_POLICY_SET);
 
     /**
     * Indicates that the sandbox application has been installed on the device.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SANDBOX_BUNDLE_ADDED);
+    events.emplace_back(COMMON_EVENT_SANDBOX_BUNDLE_ADDED);
 
     /**
     * Indicates that the sandbox application has been uninstalled on the device.
     * This is a protected common event that can only be sent by system.
     */
-    commonEventSupport_.emplace_back(COMMON_EVENT_SANDBOX_BUNDLE_REMOVED);
+    events.emplace_back(COMMON_EVENT_SANDBOX_BUNDLE_REMOVED);
     return;
 }
 
@@ -3384,11 +3385,13 @@ bool CommonEventSupport::IsSystemEvent(std::string &str)
 {
     EVENT_LOGD(LOG_TAG_CES, "enter");
 
-    std::vector<std::string>::iterator iter = find(commonEventSupport_.begin(), commonEventSupport_.end(), str);
-    if (iter != commonEventSupport_.end()) {
-        return true;
-    }
-    return false;
+    // built on the first check rather than when the service starts, the list is only needed to fill the set
+    static const std::unordered_set<std::string> systemEvents = []() {
+        std::vector<std::string> events;
+        Init(events);
+        return std::unordered_set<std::string>(events.begin(), events.end());
+    }();
+    return systemEvents.find(str) != systemEvents.end();
 }
 }  // namespace EventFwk
 }  // namespace OHOS
@@ -14,11 +14,16 @@
  */
 
 #include "matching_skills.h"
+#include "common_event_wire_format.h"
 #include "event_log_wrapper.h"
 #include "string_ex.h"
 
 namespace OHOS {
 namespace EventFwk {
+namespace {
+constexpr char EVENT_WILDCARD = '*';
+}
+
 MatchingSkills::MatchingSkills()
 {}
 
@@ -27,6 +32,7 @@ MatchingSkills::MatchingSkills(const MatchingSkills &matchingSkills)
     entities_ = matchingSkills.entities_;
     events_ = matchingSkills.events_;
     schemes_ = matchingSkills.schemes_;
+    eventPrefixes_ = matchingSkills.eventPrefixes_;
 }
 
 MatchingSkills::~MatchingSkills()
@@ -43,23 +49,17 @@ std::string MatchingSkills::GetEntity(size_t index) const
 
 void MatchingSkills::AddEntity(const std::string &entity)
 {
-    auto it = std::find(entities_.begin(), entities_.end(), entity);
-    if (it == entities_.end()) {
-        entities_.emplace_back(entity);
-    }
+    entities_.Add(entity);
 }
 
 bool MatchingSkills::HasEntity(const std::string &entity) const
 {
-    return std::find(entities_.cbegin(), entities_.cend(), entity) != entities_.cend();
+    return entities_.Contains(entity);
 }
 
 void MatchingSkills::RemoveEntity(const std::string &entity)
 {
-    auto it = std::find(entities_.cbegin(), entities_.cend(), entity);
-    if (it != entities_.cend()) {
-        entities_.erase(it);
-    }
+    entities_.Remove(entity);
 }
 
 size_t MatchingSkills::CountEntities() const
@@ -67,12 +67,14 @@ size_t MatchingSkills::CountEntities() const
     return entities_.size();
 }
 
+const std::vector<std::string> &MatchingSkills::GetEntities() const
+{
+    return entities_.items();
+}
+
 void MatchingSkills::AddEvent(const std::string &event)
 {
-    auto it = std::find(events_.cbegin(), events_.cend(), event);
-    if (it == events_.cend()) {
-        events_.emplace_back(event);
-    }
+    events_.Add(event);
 }
 
 size_t MatchingSkills::CountEvent() const
@@ -91,20 +93,73 @@ std::string MatchingSkills::GetEvent(size_t index) const
 
 std::vector<std::string> MatchingSkills::GetEvents() const
 {
-    return events_;
+    return events_.items();
+}
+
+const std::vector<std::string> &MatchingSkills::GetEventsRef() const
+{
+    return events_.items();
 }
 
 void MatchingSkills::RemoveEvent(const std::string &event)
 {
-    auto it = std::find(events_.cbegin(), events_.cend(), event);
-    if (it != events_.cend()) {
-        events_.erase(it);
-    }
+    events_.Remove(event);
 }
 
 bool MatchingSkills::HasEvent(const std::string &event) const
 {
-    return std::find(events_.cbegin(), events_.cend(), event) != events_.cend();
+    return events_.Contains(event);
+}
+
+void MatchingSkills::AddEventPrefix(const std::string &prefix)
+{
+    std::string name = prefix;
+    if (!name.empty() && name.back() == EVENT_WILDCARD) {
+        name.pop_back();
+    }
+    if (name.size() < MIN_EVENT_PREFIX_LENGTH) {
+        EVENT_LOGW(LOG_TAG_CES, "ignore event prefix %{public}s shorter than %{public}zu", name.c_str(),
+            MIN_EVENT_PREFIX_LENGTH);
+        return;
+    }
+    eventPrefixes_.Add(name);
+}
+
+bool MatchingSkills::HasEventPrefix(const std::string &prefix) const
+{
+    if (!prefix.empty() && prefix.back() == EVENT_WILDCARD) {
+        return eventPrefixes_.Contains(prefix.substr(0, prefix.size() - 1));
+    }
+    return eventPrefixes_.Contains(prefix);
+}
+
+void MatchingSkills::RemoveEventPrefix(const std::string &prefix)
+{
+    if (!prefix.empty() && prefix.back() == EVENT_WILDCARD) {
+        eventPrefixes_.Remove(prefix.substr(0, prefix.size() - 1));
+        return;
+    }
+    eventPrefixes_.Remove(prefix);
+}
+
+size_t MatchingSkills::CountEventPrefixes() const
+{
+    return eventPrefixes_.size();
+}
+
+const std::vector<std::string> &MatchingSkills::GetEventPrefixes() const
+{
+    return eventPrefixes_.items();
+}
+
+bool MatchingSkills::MatchEventPrefix(const std::string &event) const
+{
+    for (const auto &prefix : eventPrefixes_) {
+        if (event.compare(0, prefix.size(), prefix) == 0) {
+            return true;
+        }
+    }
+    return false;
 }
 
 std::string MatchingSkills::GetScheme(size_t index) const
@@ -118,23 +173,17 @@ std::string MatchingSkills::GetScheme(size_t index) const
 
 void MatchingSkills::AddScheme(const std::string &scheme)
 {
-    auto it = std::find(schemes_.begin(), schemes_.end(), scheme);
-    if (it == schemes_.end()) {
-        schemes_.emplace_back(scheme);
-    }
+    schemes_.Add(scheme);
 }
 
 bool MatchingSkills::HasScheme(const std::string &scheme) const
 {
-    return std::find(schemes_.begin(), schemes_.end(), scheme) != schemes_.end();
+    return schemes_.Contains(scheme);
 }
 
 void MatchingSkills::RemoveScheme(const std::string &scheme)
 {
-    auto it = std::find(schemes_.cbegin(), schemes_.cend(), scheme);
-    if (it != schemes_.cend()) {
-        schemes_.erase(it);
-    }
+    schemes_.Remove(scheme);
 }
 
 size_t MatchingSkills::CountSchemes() const
@@ -142,6 +191,11 @@ size_t MatchingSkills::CountSchemes() const
     return schemes_.size();
 }
 
+const std::vector<std::string> &MatchingSkills::GetSchemes() const
+{
+    return schemes_.items();
+}
+
 bool MatchingSkills::WriteVectorInfo(Parcel &parcel, std::vector<std::u16string>vectorInfo) const
 {
     if (vectorInfo.empty()) {
@@ -161,6 +215,14 @@ bool MatchingSkills::WriteVectorInfo(Parcel &parcel, std::vector<std::u16string>
 
 bool MatchingSkills::Marshalling(Parcel &parcel) const
 {
+    if (CommonEventWireFormat::GetWriteVersion() >= CommonEventWireFormat::VERSION_UTF8) {
+        return MarshallingUtf8(parcel);
+    }
+    if (!eventPrefixes_.empty()) {
+        EVENT_LOGE(LOG_TAG_CES, "event prefixes need the UTF-8 wire format");
+        return false;
+    }
+
     // write entity
     std::vector<std::u16string> actionU16Entity;
     for (std::vector<std::string>::size_type i = 0; i < entities_.size(); i++) {
@@ -197,8 +259,43 @@ bool MatchingSkills::Marshalling(Parcel &parcel) const
     return true;
 }
 
+bool MatchingSkills::MarshallingUtf8(Parcel &parcel) const
+{
+    if (!CommonEventWireFormat::WriteTag(parcel)) {
+        return false;
+    }
+    if (!parcel.WriteStringVector(entities_.items()) || !parcel.WriteStringVector(events_.items()) ||
+        !parcel.WriteStringVector(schemes_.items()) || !parcel.WriteStringVector(eventPrefixes_.items())) {
+        EVENT_LOGE(LOG_TAG_CES, "matching skills write error");
+        return false;
+    }
+    return true;
+}
+
+bool MatchingSkills::ReadFromParcelUtf8(Parcel &parcel)
+{
+    std::vector<std::string> entities;
+    std::vector<std::string> events;
+    std::vector<std::string> schemes;
+    std::vector<std::string> eventPrefixes;
+    if (!parcel.ReadStringVector(&entities) || !parcel.ReadStringVector(&events) ||
+        !parcel.ReadStringVector(&schemes) || !parcel.ReadStringVector(&eventPrefixes)) {
+        EVENT_LOGE(LOG_TAG_CES, "matching skills read error");
+        return false;
+    }
+    entities_.Assign(std::move(entities));
+    events_.Assign(std::move(events));
+    schemes_.Assign(std::move(schemes));
+    eventPrefixes_.Assign(std::move(eventPrefixes));
+    return true;
+}
+
 bool MatchingSkills::ReadFromParcel(Parcel &parcel)
 {
+    if (CommonEventWireFormat::ReadTag(parcel)) {
+        return ReadFromParcelUtf8(parcel);
+    }
+
     // read entities
     std::vector<std::u16string> actionU16Entity;
     int32_t empty = VALUE_NULL;
@@ -212,7 +309,7 @@ bool MatchingSkills::ReadFromParcel(Parcel &parcel)
     }
     entities_.clear();
     for (std::vector<std::u16string>::size_type i = 0; i < actionU16Entity.size(); i++) {
-        entities_.emplace_back(Str16ToStr8(actionU16Entity[i]));
+        entities_.Add(Str16ToStr8(actionU16Entity[i]));
     }
 
     // read event
@@ -228,7 +325,7 @@ bool MatchingSkills::ReadFromParcel(Parcel &parcel)
     }
     events_.clear();
     for (std::vector<std::u16string>::size_type i = 0; i < actionU16Event.size(); i++) {
-        events_.emplace_back(Str16ToStr8(actionU16Event[i]));
+        events_.Add(Str16ToStr8(actionU16Event[i]));
     }
 
     // read event
@@ -244,7 +341,7 @@ bool MatchingSkills::ReadFromParcel(Parcel &parcel)
     }
     schemes_.clear();
     for (std::vector<std::u16string>::size_type i = 0; i < actionU16Scheme.size(); i++) {
-        schemes_.emplace_back(Str16ToStr8(actionU16Scheme[i]));
+        schemes_.Add(Str16ToStr8(actionU16Scheme[i]));
     }
     return true;
 }
@@ -274,7 +371,7 @@ bool MatchingSkills::MatchEvent(const std::string &event) const
         return false;
     }
 
-    return HasEvent(event);
+    return HasEvent(event) || MatchEventPrefix(event);
 }
 
 bool MatchingSkills::MatchEntity(const std::vector<std::string> &entities) const
@@ -284,9 +381,8 @@ bool MatchingSkills::MatchEntity(const std::vector<std::string> &entities) const
         return true;
     }
 
-    for (auto vec : entities) {
-        auto it = std::find(entities_.cbegin(), entities_.cend(), vec);
-        if (it == entities_.cend()) {
+    for (const auto &entity : entities) {
+        if (!entities_.Contains(entity)) {
             return false;
         }
     }
@@ -310,7 +406,14 @@ bool MatchingSkills::MatchScheme(const std::string &scheme) const
 
 bool MatchingSkills::Match(const Want &want) const
 {
-    return MatchEvent(want.GetAction()) && MatchEntity(want.GetEntities()) && MatchScheme(want.GetScheme());
+    if (!MatchEvent(want.GetAction()) || !MatchEntity(want.GetEntities())) {
+        return false;
+    }
+    // GetScheme parses the uri, skip it when no uri is carried
+    if (schemes_.empty() && want.GetUriString().empty()) {
+        return true;
+    }
+    return MatchScheme(want.GetScheme());
 }
 
 std::string MatchingSkills::ToString() const
@@ -328,6 +431,12 @@ std::string MatchingSkills::ToString() const
             result.append(",").append(schemes_[i]);
         }
     }
+    if (eventPrefixes_.size() > 0) {
+        result.append(" EventPrefixes: ").append(eventPrefixes_[0]);
+        for (size_t i = 1; i < eventPrefixes_.size(); ++i) {
+            result.append(",").append(eventPrefixes_[i]);
+        }
+    }
     if (entities_.size() > 0) {
         result.append(" Entrities: ").append(entities_[0]);
         for (size_t i = 1; i < entities_.size(); ++i) {
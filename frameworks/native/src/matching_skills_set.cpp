@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "matching_skills_set.h"
+
+#include <functional>
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+constexpr size_t LINEAR_SEARCH_MAX_SIZE = 8;
+constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+}
+
+void MatchingSkillsSet::Assign(std::vector<std::string> &&items)
+{
+    clear();
+    items_.reserve(items.size());
+    hashes_.reserve(items.size());
+    for (auto &item : items) {
+        size_t hash = std::hash<std::string>()(item);
+        if (Find(item, hash) != NOT_FOUND) {
+            continue;
+        }
+        items_.emplace_back(std::move(item));
+        hashes_.emplace_back(hash);
+        InsertIndex(items_.size() - 1);
+    }
+}
+
+bool MatchingSkillsSet::Add(const std::string &item)
+{
+    size_t hash = std::hash<std::string>()(item);
+    if (Find(item, hash) != NOT_FOUND) {
+        return false;
+    }
+    items_.emplace_back(item);
+    hashes_.emplace_back(hash);
+    InsertIndex(items_.size() - 1);
+    return true;
+}
+
+bool MatchingSkillsSet::Contains(const std::string &item) const
+{
+    if (items_.empty()) {
+        return false;
+    }
+    return Find(item, std::hash<std::string>()(item)) != NOT_FOUND;
+}
+
+bool MatchingSkillsSet::Remove(const std::string &item)
+{
+    size_t position = Find(item, std::hash<std::string>()(item));
+    if (position == NOT_FOUND) {
+        return false;
+    }
+    items_.erase(items_.begin() + position);
+    hashes_.erase(hashes_.begin() + position);
+    RebuildIndex();
+    return true;
+}
+
+void MatchingSkillsSet::clear()
+{
+    items_.clear();
+    hashes_.clear();
+    slots_.clear();
+}
+
+size_t MatchingSkillsSet::Find(const std::string &item, size_t hash) const
+{
+    if (slots_.empty()) {
+        for (size_t i = 0; i < items_.size(); ++i) {
+            if (hashes_[i] == hash && items_[i] == item) {
+                return i;
+            }
+        }
+        return NOT_FOUND;
+    }
+    size_t mask = slots_.size() - 1;
+    for (size_t slot = hash & mask; slots_[slot] != 0; slot = (slot + 1) & mask) {
+        size_t position = slots_[slot] - 1;
+        if (hashes_[position] == hash && items_[position] == item) {
+            return position;
+        }
+    }
+    return NOT_FOUND;
+}
+
+void MatchingSkillsSet::InsertIndex(size_t position)
+{
+    if (items_.size() <= LINEAR_SEARCH_MAX_SIZE) {
+        return;
+    }
+    // keep the load factor at or below one half
+    if (slots_.size() < items_.size() * 2) {
+        RebuildIndex();
+        return;
+    }
+    size_t mask = slots_.size() - 1;
+    size_t slot = hashes_[position] & mask;
+    while (slots_[slot] != 0) {
+        slot = (slot + 1) & mask;
+    }
+    slots_[slot] = static_cast<uint32_t>(position + 1);
+}
+
+void MatchingSkillsSet::RebuildIndex()
+{
+    slots_.clear();
+    if (items_.size() <= LINEAR_SEARCH_MAX_SIZE) {
+        return;
+    }
+    size_t capacity = LINEAR_SEARCH_MAX_SIZE * 2;
+    while (capacity < items_.size() * 4) {
+        capacity <<= 1;
+    }
+    slots_.assign(capacity, 0);
+    size_t mask = capacity - 1;
+    for (size_t position = 0; position < items_.size(); ++position) {
+        size_t slot = hashes_[position] & mask;
+        while (slots_[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        slots_[slot] = static_cast<uint32_t>(position + 1);
+    }
+}
+}  // namespace EventFwk
+}  // namespace OHOS
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+#include "common_event_data.h"
+#include "message_parcel.h"
+#include "shared_common_event_data.h"
+
+using namespace testing;
+using namespace testing::ext;
+using namespace OHOS;
+using namespace OHOS::EventFwk;
+namespace {
+    const std::string EVENT = "com.ces.test.payload";
+    const std::string PARAM_KEY = "payload";
+    const std::string DATA = "data";
+    const int32_t CODE = 7;
+}
+
+class CommonEventDataTest : public ::testing::Test {
+protected:
+void SetUp() override {}
+void TearDown() override {}
+
+static std::shared_ptr<CommonEventData> CreateEventData(size_t paramSize)
+{
+    Want want;
+    want.SetAction(EVENT);
+    want.SetParam(PARAM_KEY, std::string(paramSize, 'x'));
+    return std::make_shared<CommonEventData>(want, CODE, DATA);
+}
+};
+
+/**
+ * @tc.name  : CommonEventData_SharedPayload_001
+ * @tc.number: CommonEventDataTest_001
+ * @tc.desc  : Test a want below the threshold is marshalled inline and read back
+ */
+HWTEST_F(CommonEventDataTest, CommonEventData_SharedPayload_001, TestSize.Level0)
+{
+    auto data = CreateEventData(16);
+
+    MessageParcel parcel;
+    EXPECT_TRUE(parcel.WriteParcelable(data.get()));
+    EXPECT_EQ(parcel.GetOffsetsSize(), 0);
+
+    std::unique_ptr<CommonEventData> result(parcel.ReadParcelable<CommonEventData>());
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetWant().GetAction(), EVENT);
+    EXPECT_EQ(result->GetWant().GetStringParam(PARAM_KEY).size(), 16);
+    EXPECT_EQ(result->GetCode(), CODE);
+    EXPECT_EQ(result->GetData(), DATA);
+}
+
+/**
+ * @tc.name  : CommonEventData_SharedPayload_002
+ * @tc.number: CommonEventDataTest_002
+ * @tc.desc  : Test a want above the threshold is carried as an ashmem handle instead of inline
+ */
+HWTEST_F(CommonEventDataTest, CommonEventData_SharedPayload_002, TestSize.Level0)
+{
+    size_t paramSize = CommonEventData::SHARED_PAYLOAD_THRESHOLD * 2;
+    auto data = CreateEventData(paramSize);
+
+    MessageParcel parcel;
+    EXPECT_TRUE(parcel.WriteParcelable(data.get()));
+    EXPECT_EQ(parcel.GetOffsetsSize(), 1);
+    EXPECT_LT(parcel.GetDataSize(), CommonEventData::SHARED_PAYLOAD_THRESHOLD);
+
+    std::unique_ptr<CommonEventData> result(parcel.ReadParcelable<CommonEventData>());
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetWant().GetAction(), EVENT);
+    EXPECT_EQ(result->GetWant().GetStringParam(PARAM_KEY), std::string(paramSize, 'x'));
+    EXPECT_EQ(result->GetCode(), CODE);
+    EXPECT_EQ(result->GetData(), DATA);
+}
+
+/**
+ * @tc.name  : CommonEventData_SharedPayload_003
+ * @tc.number: CommonEventDataTest_003
+ * @tc.desc  : Test a shared region outlives its owner and is reused by every marshalling
+ */
+HWTEST_F(CommonEventDataTest, CommonEventData_SharedPayload_003, TestSize.Level0)
+{
+    size_t paramSize = CommonEventData::SHARED_PAYLOAD_THRESHOLD + 1;
+    auto data = std::make_shared<SharedCommonEventData>(*CreateEventData(paramSize));
+
+    MessageParcel first;
+    MessageParcel second;
+    EXPECT_TRUE(first.WriteParcelable(data.get()));
+    EXPECT_TRUE(second.WriteParcelable(data.get()));
+    EXPECT_EQ(first.GetOffsetsSize(), 1);
+    EXPECT_EQ(second.GetOffsetsSize(), 1);
+    EXPECT_LT(second.GetDataSize(), CommonEventData::SHARED_PAYLOAD_THRESHOLD);
+    data = nullptr;
+
+    std::unique_ptr<CommonEventData> firstResult(first.ReadParcelable<CommonEventData>());
+    std::unique_ptr<CommonEventData> secondResult(second.ReadParcelable<CommonEventData>());
+    ASSERT_NE(firstResult, nullptr);
+    ASSERT_NE(secondResult, nullptr);
+    EXPECT_EQ(firstResult->GetWant().GetStringParam(PARAM_KEY).size(), paramSize);
+    EXPECT_EQ(secondResult->GetWant().GetStringParam(PARAM_KEY).size(), paramSize);
+    EXPECT_EQ(secondResult->GetCode(), CODE);
+}
+
+/**
+ * @tc.name  : CommonEventData_SharedPayload_004
+ * @tc.number: CommonEventDataTest_004
+ * @tc.desc  : Test a plain Parcel keeps the want inline even once it is held in shared memory
+ */
+HWTEST_F(CommonEventDataTest, CommonEventData_SharedPayload_004, TestSize.Level0)
+{
+    size_t paramSize = CommonEventData::SHARED_PAYLOAD_THRESHOLD * 2;
+    auto data = std::make_shared<SharedCommonEventData>(*CreateEventData(paramSize));
+
+    MessageParcel messageParcel;
+    EXPECT_TRUE(messageParcel.WriteParcelable(data.get()));
+    EXPECT_EQ(messageParcel.GetOffsetsSize(), 1);
+
+    Parcel parcel;
+    EXPECT_TRUE(data->Marshalling(parcel));
+    EXPECT_GT(parcel.GetDataSize(), CommonEventData::SHARED_PAYLOAD_THRESHOLD);
+    std::unique_ptr<CommonEventData> result(CommonEventData::Unmarshalling(parcel));
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetWant().GetStringParam(PARAM_KEY).size(), paramSize);
+}
+
+/**
+ * @tc.name  : CommonEventData_SharedPayload_005
+ * @tc.number: CommonEventDataTest_005
+ * @tc.desc  : Test a small want is copied from its first marshalling and the code and data stay current
+ */
+HWTEST_F(CommonEventDataTest, CommonEventData_SharedPayload_005, TestSize.Level0)
+{
+    auto data = std::make_shared<SharedCommonEventData>(*CreateEventData(16));
+    Parcel expected;
+    EXPECT_TRUE(CreateEventData(16)->Marshalling(expected));
+    Parcel first;
+    Parcel second;
+    EXPECT_TRUE(data->Marshalling(first));
+    EXPECT_TRUE(data->Marshalling(second));
+    ASSERT_EQ(second.GetDataSize(), expected.GetDataSize());
+    EXPECT_EQ(memcmp(reinterpret_cast<const void *>(second.GetData()),
+        reinterpret_cast<const void *>(expected.GetData()), second.GetDataSize()), 0);
+
+    data->SetCode(CODE + 1);
+    data->SetData(EVENT);
+    MessageParcel messageParcel;
+    EXPECT_TRUE(messageParcel.WriteParcelable(data.get()));
+    std::unique_ptr<CommonEventData> result(messageParcel.ReadParcelable<CommonEventData>());
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetWant().GetStringParam(PARAM_KEY).size(), 16);
+    EXPECT_EQ(result->GetCode(), CODE + 1);
+    EXPECT_EQ(result->GetData(), EVENT);
+}
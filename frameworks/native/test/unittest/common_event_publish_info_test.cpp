@@ -13,8 +13,11 @@
  * limitations under the License.
  */
 
+#include <unistd.h>
+
 #include "gtest/gtest.h"
 #include "common_event_publish_info.h"
+#include "common_event_wire_format.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -109,4 +112,64 @@ HWTEST_F(CommonEventPublishInfoTest, GetFilterSettings_002, TestSize.Level0)
 {
     CommonEventPublishInfo commonEventPublishInfo;
     EXPECT_EQ(commonEventPublishInfo.GetFilterSettings(), 0);
-}
\ No newline at end of file
+}
+/*
+ * tc.number: CommonEventPublishInfo_002
+ * tc.name: test ReadFromParcel with UTF-8 wire format
+ * tc.type: FUNC
+ * tc.desc: Invoke Marshalling with the UTF-8 wire format and verify Unmarshalling reads it back
+ */
+HWTEST_F(CommonEventPublishInfoTest, CommonEventPublishInfo_002, TestSize.Level0)
+{
+    Parcel parcel;
+    CommonEventPublishInfo commonEventPublishInfo;
+    commonEventPublishInfo.SetBundleName("testBundle");
+    commonEventPublishInfo.SetOrdered(true);
+    commonEventPublishInfo.SetSubscriberPermissions({ "testPermission1", "testPermission2" });
+    commonEventPublishInfo.SetSubscriberUid({ 1, 2 });
+    {
+        CommonEventWireFormat::Scope wireFormat(CommonEventWireFormat::VERSION_UTF8);
+        EXPECT_EQ(commonEventPublishInfo.Marshalling(parcel), true);
+    }
+
+    sptr<CommonEventPublishInfo> publishInfo = CommonEventPublishInfo::Unmarshalling(parcel);
+    ASSERT_NE(publishInfo, nullptr);
+    EXPECT_EQ(publishInfo->GetBundleName(), "testBundle");
+    EXPECT_TRUE(publishInfo->IsOrdered());
+    EXPECT_FALSE(publishInfo->IsSticky());
+    EXPECT_EQ(publishInfo->GetSubscriberPermissions(), commonEventPublishInfo.GetSubscriberPermissions());
+    EXPECT_EQ(publishInfo->GetSubscriberUid().size(), 2);
+}
+
+/**
+ * @tc.name  : ClientVersion_ShouldBeForgotten_WhenClientIsRemoved
+ * @tc.number: CommonEventPublishInfoTest_004
+ * @tc.desc  : Test a client version is kept per pid and uid until the client process is removed
+ */
+HWTEST_F(CommonEventPublishInfoTest, ClientVersion_ShouldBeForgotten_WhenClientIsRemoved, TestSize.Level0)
+{
+    pid_t pid = getpid();
+    uid_t uid = getuid();
+    EXPECT_EQ(CommonEventWireFormat::SetClientVersion(pid, uid, CommonEventWireFormat::VERSION_CURRENT + 1),
+        CommonEventWireFormat::VERSION_CURRENT);
+    EXPECT_EQ(CommonEventWireFormat::GetClientVersion(pid, uid), CommonEventWireFormat::VERSION_CURRENT);
+    // a process of another uid that reused the pid never negotiated
+    EXPECT_EQ(CommonEventWireFormat::GetClientVersion(pid, uid + 1), CommonEventWireFormat::VERSION_UTF16);
+    CommonEventWireFormat::RemoveClientVersion(pid, uid);
+    EXPECT_EQ(CommonEventWireFormat::GetClientVersion(pid, uid), CommonEventWireFormat::VERSION_UTF16);
+}
+
+/**
+ * @tc.name  : WriteVersion_ShouldBeUtf16_WhenOutOfScope
+ * @tc.number: CommonEventPublishInfoTest_005
+ * @tc.desc  : Test parcels are only written in the negotiated format inside a scope
+ */
+HWTEST_F(CommonEventPublishInfoTest, WriteVersion_ShouldBeUtf16_WhenOutOfScope, TestSize.Level0)
+{
+    EXPECT_EQ(CommonEventWireFormat::GetWriteVersion(), CommonEventWireFormat::VERSION_UTF16);
+    {
+        CommonEventWireFormat::Scope wireFormat(CommonEventWireFormat::VERSION_UTF8);
+        EXPECT_EQ(CommonEventWireFormat::GetWriteVersion(), CommonEventWireFormat::VERSION_UTF8);
+    }
+    EXPECT_EQ(CommonEventWireFormat::GetWriteVersion(), CommonEventWireFormat::VERSION_UTF16);
+}
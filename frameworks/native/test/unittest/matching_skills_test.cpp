@@ -16,6 +16,7 @@
 #define private public
 #define protected public
 #include "async_common_event_result.h"
+#include "common_event_wire_format.h"
 #include "matching_skills.h"
 #undef private
 #undef protected
@@ -235,7 +236,7 @@ HWTEST_F(MatchingSkillsTest, MatchingSkills_001, TestSize.Level1)
 {
     MatchingSkills matchSkills;
     std::string event = "event.unit.test";
-    matchSkills.entities_.emplace_back(event);
+    matchSkills.AddEntity(event);
     size_t index = 1;
     EXPECT_EQ("", matchSkills.GetEntity(index));
 }
@@ -253,7 +254,7 @@ HWTEST_F(MatchingSkillsTest, MatchingSkills_002, TestSize.Level1)
 {
     MatchingSkills matchSkills;
     std::string event = "event.unit.test";
-    matchSkills.entities_.emplace_back(event);
+    matchSkills.AddEntity(event);
     size_t index = -1;
     EXPECT_EQ("", matchSkills.GetEntity(index));
 }
@@ -271,7 +272,7 @@ HWTEST_F(MatchingSkillsTest, MatchingSkills_003, TestSize.Level1)
 {
     MatchingSkills matchSkills;
     std::string event = "event.unit.test";
-    matchSkills.entities_.emplace_back(event);
+    matchSkills.AddEntity(event);
     size_t index = 0;
     EXPECT_EQ("event.unit.test", matchSkills.GetEntity(index));
 }
@@ -289,7 +290,7 @@ HWTEST_F(MatchingSkillsTest, MatchingSkills_004, TestSize.Level1)
 {
     MatchingSkills matchSkills;
     std::string event = "event.unit.test";
-    matchSkills.events_.emplace_back(event);
+    matchSkills.AddEvent(event);
     size_t index = 1;
     EXPECT_EQ("", matchSkills.GetEvent(index));
 }
@@ -307,7 +308,7 @@ HWTEST_F(MatchingSkillsTest, MatchingSkills_005, TestSize.Level1)
 {
     MatchingSkills matchSkills;
     std::string event = "event.unit.test";
-    matchSkills.events_.emplace_back(event);
+    matchSkills.AddEvent(event);
     size_t index = -1;
     EXPECT_EQ("", matchSkills.GetEvent(index));
 }
@@ -325,7 +326,7 @@ HWTEST_F(MatchingSkillsTest, MatchingSkills_006, TestSize.Level1)
 {
     MatchingSkills matchSkills;
     std::string event = "event.unit.test";
-    matchSkills.events_.emplace_back(event);
+    matchSkills.AddEvent(event);
     size_t index = 0;
     EXPECT_EQ("event.unit.test", matchSkills.GetEvent(index));
 }
@@ -343,7 +344,7 @@ HWTEST_F(MatchingSkillsTest, MatchingSkills_007, TestSize.Level1)
 {
     MatchingSkills matchSkills;
     std::string event = "event.unit.test";
-    matchSkills.schemes_.emplace_back(event);
+    matchSkills.AddScheme(event);
     size_t index = 1;
     EXPECT_EQ("", matchSkills.GetScheme(index));
 }
@@ -361,7 +362,7 @@ HWTEST_F(MatchingSkillsTest, MatchingSkills_008, TestSize.Level1)
 {
     MatchingSkills matchSkills;
     std::string event = "event.unit.test";
-    matchSkills.schemes_.emplace_back(event);
+    matchSkills.AddScheme(event);
     size_t index = -1;
     EXPECT_EQ("", matchSkills.GetScheme(index));
 }
@@ -379,7 +380,7 @@ HWTEST_F(MatchingSkillsTest, MatchingSkills_009, TestSize.Level1)
 {
     MatchingSkills matchSkills;
     std::string event = "event.unit.test";
-    matchSkills.schemes_.emplace_back(event);
+    matchSkills.AddScheme(event);
     size_t index = 0;
     EXPECT_EQ("event.unit.test", matchSkills.GetScheme(index));
 }
@@ -531,7 +532,8 @@ HWTEST_F(MatchingSkillsTest, AsyncCommonEventResult_007, TestSize.Level1)
 HWTEST_F(MatchingSkillsTest, toString_ShouldReturnCorrectString_WhenEventsIsNotEmpty, TestSize.Level1)
 {
     MatchingSkills matchingSkills;
-    matchingSkills.events_ = {"event1", "event2"};
+    matchingSkills.AddEvent("event1");
+    matchingSkills.AddEvent("event2");
     std::string expected = " Events: event1,event2";
     EXPECT_EQ(matchingSkills.ToString(), expected);
 }
@@ -544,7 +546,8 @@ HWTEST_F(MatchingSkillsTest, toString_ShouldReturnCorrectString_WhenEventsIsNotE
 HWTEST_F(MatchingSkillsTest, toString_ShouldReturnCorrectString_WhenSchemesIsNotEmpty, TestSize.Level1)
 {
     MatchingSkills matchingSkills;
-    matchingSkills.schemes_ = {"scheme1", "scheme2"};
+    matchingSkills.AddScheme("scheme1");
+    matchingSkills.AddScheme("scheme2");
     std::string expected = " Schemes: scheme1,scheme2";
     EXPECT_EQ(matchingSkills.ToString(), expected);
 }
@@ -557,7 +560,8 @@ HWTEST_F(MatchingSkillsTest, toString_ShouldReturnCorrectString_WhenSchemesIsNot
 HWTEST_F(MatchingSkillsTest, toString_ShouldReturnCorrectString_WhenEntitiesIsNotEmpty, TestSize.Level1)
 {
     MatchingSkills matchingSkills;
-    matchingSkills.entities_ = {"entity1", "entity2"};
+    matchingSkills.AddEntity("entity1");
+    matchingSkills.AddEntity("entity2");
     std::string expected = " Entrities: entity1,entity2";
     EXPECT_EQ(matchingSkills.ToString(), expected);
 }
@@ -570,9 +574,12 @@ HWTEST_F(MatchingSkillsTest, toString_ShouldReturnCorrectString_WhenEntitiesIsNo
 HWTEST_F(MatchingSkillsTest, toString_ShouldReturnCorrectString_WhenAllFieldsAreNotEmpty, TestSize.Level1)
 {
     MatchingSkills matchingSkills;
-    matchingSkills.events_ = {"event1", "event2"};
-    matchingSkills.schemes_ = {"scheme1", "scheme2"};
-    matchingSkills.entities_ = {"entity1", "entity2"};
+    matchingSkills.AddEvent("event1");
+    matchingSkills.AddEvent("event2");
+    matchingSkills.AddScheme("scheme1");
+    matchingSkills.AddScheme("scheme2");
+    matchingSkills.AddEntity("entity1");
+    matchingSkills.AddEntity("entity2");
     std::string expected = " Events: event1,event2 Schemes: scheme1,scheme2 Entrities: entity1,entity2";
     EXPECT_EQ(matchingSkills.ToString(), expected);
 }
@@ -587,4 +594,127 @@ HWTEST_F(MatchingSkillsTest, toString_ShouldReturnCorrectString_WhenAllFieldsAre
     MatchingSkills matchingSkills;
     std::string expected = "";
     EXPECT_EQ(matchingSkills.ToString(), expected);
-}
\ No newline at end of file
+}
+/**
+* @tc.name  : Marshalling_ShouldRoundTrip_WhenWireFormatIsUtf8
+* @tc.number: MatchingSkillsTest_006
+* @tc.desc  : Test the UTF-8 wire format keeps every skill and is read back
+*/
+HWTEST_F(MatchingSkillsTest, Marshalling_ShouldRoundTrip_WhenWireFormatIsUtf8, TestSize.Level1)
+{
+    MatchingSkills matchingSkills;
+    matchingSkills.AddEvent("event1");
+    matchingSkills.AddEvent("\u4e8b\u4ef6");
+    matchingSkills.AddEntity("entity1");
+    matchingSkills.AddScheme("scheme1");
+
+    Parcel parcel;
+    {
+        CommonEventWireFormat::Scope wireFormat(CommonEventWireFormat::VERSION_UTF8);
+        EXPECT_TRUE(matchingSkills.Marshalling(parcel));
+    }
+    std::unique_ptr<MatchingSkills> result(MatchingSkills::Unmarshalling(parcel));
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetEvents(), matchingSkills.GetEvents());
+    EXPECT_EQ(result->GetEntity(0), "entity1");
+    EXPECT_EQ(result->GetScheme(0), "scheme1");
+}
+
+/**
+* @tc.name  : Marshalling_ShouldRoundTrip_WhenWireFormatIsUtf16
+* @tc.number: MatchingSkillsTest_007
+* @tc.desc  : Test the legacy wire format is still written and read back
+*/
+HWTEST_F(MatchingSkillsTest, Marshalling_ShouldRoundTrip_WhenWireFormatIsUtf16, TestSize.Level1)
+{
+    MatchingSkills matchingSkills;
+    matchingSkills.AddEvent("event1");
+    matchingSkills.AddEntity("entity1");
+
+    Parcel parcel;
+    {
+        CommonEventWireFormat::Scope wireFormat(CommonEventWireFormat::VERSION_UTF16);
+        EXPECT_TRUE(matchingSkills.Marshalling(parcel));
+    }
+    int32_t entityFlag = 0;
+    EXPECT_TRUE(parcel.ReadInt32(entityFlag));
+    EXPECT_EQ(entityFlag, 1);
+    parcel.RewindRead(0);
+    std::unique_ptr<MatchingSkills> result(MatchingSkills::Unmarshalling(parcel));
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetEvent(0), "event1");
+    EXPECT_EQ(result->GetEntity(0), "entity1");
+    EXPECT_EQ(result->CountSchemes(), 0);
+}
+
+/**
+* @tc.name  : AddEvent_ShouldKeepOrderAndDedup_WhenEventsExceedLinearSearch
+* @tc.number: MatchingSkillsTest_008
+* @tc.desc  : Test a large event set keeps insertion order, drops duplicates and supports lookup and removal
+*/
+HWTEST_F(MatchingSkillsTest, AddEvent_ShouldKeepOrderAndDedup_WhenEventsExceedLinearSearch, TestSize.Level1)
+{
+    const size_t eventCount = 200;
+    MatchingSkills matchingSkills;
+    for (size_t i = 0; i < eventCount; ++i) {
+        matchingSkills.AddEvent("event" + std::to_string(i));
+        matchingSkills.AddEvent("event" + std::to_string(i / 2));
+    }
+    ASSERT_EQ(matchingSkills.CountEvent(), eventCount);
+    for (size_t i = 0; i < eventCount; ++i) {
+        EXPECT_EQ(matchingSkills.GetEvent(i), "event" + std::to_string(i));
+    }
+
+    matchingSkills.RemoveEvent("event100");
+    EXPECT_FALSE(matchingSkills.HasEvent("event100"));
+    EXPECT_TRUE(matchingSkills.HasEvent("event199"));
+    EXPECT_EQ(matchingSkills.GetEvent(100), "event101");
+    EXPECT_EQ(matchingSkills.CountEvent(), eventCount - 1);
+
+    Want want;
+    want.SetAction("event150");
+    EXPECT_TRUE(matchingSkills.Match(want));
+    want.SetAction("event100");
+    EXPECT_FALSE(matchingSkills.Match(want));
+}
+
+/**
+* @tc.name  : AddEventPrefix_ShouldMatchEventsByPrefix_WhenWildcardIsGiven
+* @tc.number: MatchingSkillsTest_009
+* @tc.desc  : Test event prefixes match by prefix, are kept without the wildcard, ignore short prefixes
+*             and need the UTF-8 wire format
+*/
+HWTEST_F(MatchingSkillsTest, AddEventPrefix_ShouldMatchEventsByPrefix_WhenWildcardIsGiven, TestSize.Level1)
+{
+    MatchingSkills matchingSkills;
+    matchingSkills.AddEventPrefix("usual.event.wifi.*");
+    matchingSkills.AddEventPrefix("usual.event.wifi.");
+    matchingSkills.AddEventPrefix("*");
+    matchingSkills.AddEventPrefix("usual.*");
+    EXPECT_EQ(matchingSkills.CountEventPrefixes(), 1);
+    EXPECT_FALSE(matchingSkills.HasEventPrefix("usual.*"));
+    EXPECT_TRUE(matchingSkills.HasEventPrefix("usual.event.wifi.*"));
+    EXPECT_TRUE(matchingSkills.MatchEventPrefix("usual.event.wifi.POWER_STATE"));
+    EXPECT_FALSE(matchingSkills.MatchEventPrefix("usual.event.wifi"));
+
+    Want want;
+    want.SetAction("usual.event.wifi.SCAN_FINISHED");
+    EXPECT_TRUE(matchingSkills.Match(want));
+
+    Parcel legacyParcel;
+    {
+        CommonEventWireFormat::Scope wireFormat(CommonEventWireFormat::VERSION_UTF16);
+        EXPECT_FALSE(matchingSkills.Marshalling(legacyParcel));
+    }
+    Parcel parcel;
+    {
+        CommonEventWireFormat::Scope wireFormat(CommonEventWireFormat::VERSION_UTF8);
+        EXPECT_TRUE(matchingSkills.Marshalling(parcel));
+    }
+    std::unique_ptr<MatchingSkills> result(MatchingSkills::Unmarshalling(parcel));
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetEventPrefixes(), matchingSkills.GetEventPrefixes());
+
+    matchingSkills.RemoveEventPrefix("usual.event.wifi.*");
+    EXPECT_FALSE(matchingSkills.Match(want));
+}
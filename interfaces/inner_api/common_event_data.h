@@ -47,6 +47,11 @@ public:
 
     ~CommonEventData();
 
+    /**
+     * Marshalled want size in bytes above which the want is carried in shared memory instead of inline.
+     */
+    static constexpr size_t SHARED_PAYLOAD_THRESHOLD = 64 * 1024;
+
     /**
      * Sets the want attribute of a common event.
      *
@@ -112,12 +117,25 @@ private:
      */
     bool ReadFromParcel(Parcel &parcel);
 
+    bool MarshallingDataAndCode(Parcel &parcel) const;
+
+    bool MarshallingUtf8(Parcel &parcel) const;
+
+    bool ReadWant(Parcel &parcel);
+
+    bool WriteWant(Parcel &parcel) const;
+
+    bool ReadSharedWant(Parcel &parcel);
+
+    friend class SharedCommonEventData;
+
 private:
     Want want_;
     int32_t code_;
     std::string data_;
     static constexpr int VALUE_NULL = -1;
     static constexpr int VALUE_OBJECT = 1;
+    static constexpr int VALUE_ASHMEM = 2;
 };
 }  // namespace EventFwk
 }  // namespace OHOS
@@ -205,6 +205,10 @@ private:
      */
     bool ReadFromParcel(Parcel &parcel);
 
+    bool WritePermissionsUtf16(Parcel &parcel) const;
+
+    bool ReadPermissionsUtf16(Parcel &parcel);
+
     bool isSubscriberType(int32_t subsciberType);
 
 private:
@@ -1618,9 +1618,9 @@ public:
     bool IsSystemEvent(std::string &str);
 
 private:
-    void Init();
+    static void Init(std::vector<std::string> &events);
 
-private:
+    // unused since IsSystemEvent checks a shared set, kept so that the object size and layout stay unchanged
     std::vector<std::string> commonEventSupport_;
 };
 }  // namespace EventFwk
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_EVENT_CESFWK_KITS_NATIVE_INCLUDE_MATCHING_SKILLS_H
 #define FOUNDATION_EVENT_CESFWK_KITS_NATIVE_INCLUDE_MATCHING_SKILLS_H
 
+#include "matching_skills_set.h"
 #include "parcel.h"
 #include "want.h"
 
@@ -35,6 +36,11 @@ public:
 
     ~MatchingSkills();
 
+    /**
+     * Minimum length of an event prefix, so that a prefix subscription can not match nearly every event.
+     */
+    static constexpr size_t MIN_EVENT_PREFIX_LENGTH = 8;
+
     /**
      * Obtains an entity.
      *
@@ -101,6 +107,27 @@ public:
      */
     std::vector<std::string> GetEvents() const;
 
+    /**
+     * Gets events without copying them, the reference is valid until this object is changed.
+     *
+     * @return Returns the events in MatchingSkills object.
+     */
+    const std::vector<std::string> &GetEventsRef() const;
+
+    /**
+     * Gets entities.
+     *
+     * @return Returns the entities in MatchingSkills object.
+     */
+    const std::vector<std::string> &GetEntities() const;
+
+    /**
+     * Gets schemes.
+     *
+     * @return Returns the schemes in MatchingSkills object.
+     */
+    const std::vector<std::string> &GetSchemes() const;
+
     /**
      * Removes events.
      *
@@ -116,6 +143,56 @@ public:
      */
     bool HasEvent(const std::string &event) const;
 
+    /**
+     * Adds an event prefix to this MatchingSkills object. Every event whose name starts with the prefix is
+     * matched. A trailing '*' is treated as a wildcard, so "usual.event.wifi.*" and "usual.event.wifi." are
+     * the same subscription. Prefixes shorter than MIN_EVENT_PREFIX_LENGTH, not counting the wildcard, are
+     * ignored, and the service rejects a subscription carrying one.
+     *
+     * Prefix subscribers only receive system defined events and events published by themselves, unless they are
+     * system applications. The permissions of each event are still checked as for exact subscriptions.
+     *
+     * @param prefix Indicates the event prefix.
+     */
+    void AddEventPrefix(const std::string &prefix);
+
+    /**
+     * Checks whether the event prefix is in this MatchingSkills object.
+     *
+     * @param prefix Indicates the event prefix.
+     * @return Returns whether the event prefix in MatchingSkills object or not.
+     */
+    bool HasEventPrefix(const std::string &prefix) const;
+
+    /**
+     * Removes an event prefix.
+     *
+     * @param prefix Indicates the event prefix.
+     */
+    void RemoveEventPrefix(const std::string &prefix);
+
+    /**
+     * Gets event prefix count.
+     *
+     * @return Returns event prefix count.
+     */
+    size_t CountEventPrefixes() const;
+
+    /**
+     * Gets event prefixes, without the trailing wildcard.
+     *
+     * @return Returns the event prefixes in MatchingSkills object.
+     */
+    const std::vector<std::string> &GetEventPrefixes() const;
+
+    /**
+     * Checks whether the event is matched by one of the event prefixes.
+     *
+     * @param event Indicates the event.
+     * @return Returns true if one of the prefixes matches; false otherwise.
+     */
+    bool MatchEventPrefix(const std::string &event) const;
+
     /**
      * Obtains an Scheme.
      *
@@ -188,6 +265,22 @@ private:
      */
     bool ReadFromParcel(Parcel &parcel);
 
+    /**
+     * Marshals the skills as length-prefixed UTF-8 strings.
+     *
+     * @param parcel Indicates specified Parcel object.
+     * @return Returns true if success; false otherwise.
+     */
+    bool MarshallingUtf8(Parcel &parcel) const;
+
+    /**
+     * Reads the skills written by MarshallingUtf8.
+     *
+     * @param parcel Indicates specified Parcel object.
+     * @return Returns true if success; false otherwise.
+     */
+    bool ReadFromParcelUtf8(Parcel &parcel);
+
     /**
      * Matches event.
      *
@@ -215,9 +308,10 @@ private:
     std::string ToString() const;
 
 private:
-    std::vector<std::string> entities_;
-    std::vector<std::string> events_;
-    std::vector<std::string> schemes_;
+    MatchingSkillsSet entities_;
+    MatchingSkillsSet events_;
+    MatchingSkillsSet schemes_;
+    MatchingSkillsSet eventPrefixes_;
     static constexpr int32_t VALUE_NULL = -1;
     static constexpr int32_t VALUE_OBJECT = 1;
     friend class CommonEvent;
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_KITS_NATIVE_INCLUDE_MATCHING_SKILLS_SET_H
+#define FOUNDATION_EVENT_CESFWK_KITS_NATIVE_INCLUDE_MATCHING_SKILLS_SET_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Insertion-ordered set of strings used by MatchingSkills.
+ *
+ * Items are kept in a flat vector in the order they were added, together with their precomputed hashes.
+ * Small sets are searched linearly by hash; larger sets build an open-addressing index so that lookups,
+ * inserts and duplicate checks stay O(1) for subscribers with hundreds of events.
+ */
+class MatchingSkillsSet {
+public:
+    MatchingSkillsSet() = default;
+
+    /**
+     * Replaces the content, dropping duplicated items.
+     *
+     * @param items Indicates the items in insertion order.
+     */
+    void Assign(std::vector<std::string> &&items);
+
+    /**
+     * Appends an item if it is not in the set yet.
+     *
+     * @param item Indicates the item.
+     * @return Returns true if the item is appended; false if it already exists.
+     */
+    bool Add(const std::string &item);
+
+    /**
+     * Checks whether the set contains an item.
+     *
+     * @param item Indicates the item.
+     * @return Returns true if the item exists; false otherwise.
+     */
+    bool Contains(const std::string &item) const;
+
+    /**
+     * Removes an item while keeping the order of the others.
+     *
+     * @param item Indicates the item.
+     * @return Returns true if the item is removed; false if it does not exist.
+     */
+    bool Remove(const std::string &item);
+
+    void clear();
+
+    size_t size() const
+    {
+        return items_.size();
+    }
+
+    bool empty() const
+    {
+        return items_.empty();
+    }
+
+    const std::string &operator[](size_t index) const
+    {
+        return items_[index];
+    }
+
+    std::vector<std::string>::const_iterator begin() const
+    {
+        return items_.cbegin();
+    }
+
+    std::vector<std::string>::const_iterator end() const
+    {
+        return items_.cend();
+    }
+
+    /**
+     * Gets the items in insertion order.
+     *
+     * @return Returns the items.
+     */
+    const std::vector<std::string> &items() const
+    {
+        return items_;
+    }
+
+private:
+    size_t Find(const std::string &item, size_t hash) const;
+    void InsertIndex(size_t position);
+    void RebuildIndex();
+
+private:
+    std::vector<std::string> items_;
+    std::vector<size_t> hashes_;
+    // open-addressing slots holding position + 1, empty while the set is small
+    std::vector<uint32_t> slots_;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_KITS_NATIVE_INCLUDE_MATCHING_SKILLS_SET_H
@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_ABILITY_MANAGER_HELPER_H
 #define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_ABILITY_MANAGER_HELPER_H
 
+#include <functional>
+
 #include "ability_connect_callback_interface.h"
 #include "ability_manager_interface.h"
 #include "common_event_data.h"
@@ -43,6 +45,26 @@ public:
     int ConnectAbility(const AAFwk::Want &want, const CommonEventData &event,
         const sptr<IRemoteObject> &callerToken, const int32_t &userId);
 
+    using ConnectCallback = std::function<void(int result, size_t droppedCount)>;
+
+    /**
+     * Connects ability without waiting for the ability manager.
+     *
+     * The event is queued on the connection at once, so events to one subscriber keep their order. The connect
+     * call itself runs on a bounded concurrent queue where priority requests run ahead of bulk ones.
+     *
+     * @param want Indicates ability inofmation.
+     * @param event Indicates the common event
+     * @param callerToken Indicates the token of caller.
+     * @param userId Indicates the ID of user.
+     * @param isPriority Indicates whether the request runs ahead of bulk requests such as boot events.
+     * @param callback Indicates the callback to receive the result code and the number of events queued on the
+     *                 connection that are dropped because the connect failed, it may be called before returning.
+     */
+    void ConnectAbilityAsync(const AAFwk::Want &want, const CommonEventData &event,
+        const sptr<IRemoteObject> &callerToken, const int32_t &userId, bool isPriority,
+        const ConnectCallback &callback = nullptr);
+
     /**
      * @brief Disconnect ability delay.
      * @param connection Indicates the connection want to disconnect.
@@ -54,10 +76,15 @@ public:
 private:
     sptr<AAFwk::IAbilityManager> GetAbilityMgrProxy();
     void DisconnectAbility(const sptr<StaticSubscriberConnection> &connection, const std::string &action);
+    int AttachConnection(const AAFwk::Want &want, const CommonEventData &event, const int32_t &userId,
+        sptr<StaticSubscriberConnection> &connection);
+    int DoConnectAbility(const AAFwk::Want &want, const sptr<StaticSubscriberConnection> &connection,
+        const sptr<IRemoteObject> &callerToken, const int32_t &userId, size_t &droppedCount);
 
     ffrt::mutex mutex_;
     std::map<std::string, sptr<StaticSubscriberConnection>> subscriberConnection_;
     std::shared_ptr<ffrt::queue> ffrt_ = nullptr;
+    std::shared_ptr<ffrt::queue> connectQueue_ = nullptr;
 };
 }  // namespace EventFwk
 }  // namespace OHOS
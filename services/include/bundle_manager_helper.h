@@ -101,6 +101,17 @@ public:
     bool GetApplicationInfos(const AppExecFwk::ApplicationFlag &flag,
         std::vector<AppExecFwk::ApplicationInfo> &appInfos);
 
+    /**
+     * @brief Obtains information about all installed applications of a user.
+     * @param flag Indicates the flag used to specify information contained
+     *             in the ApplicationInfo objects that will be returned.
+     * @param userId Indicates the ID of user.
+     * @param appInfos Indicates all of the obtained ApplicationInfo objects.
+     * @return Returns true if the application is successfully obtained; returns false otherwise.
+     */
+    bool GetApplicationInfos(const AppExecFwk::ApplicationFlag &flag, const int32_t &userId,
+        std::vector<AppExecFwk::ApplicationInfo> &appInfos);
+
     int32_t GetDefaultUidByBundleName(const std::string &bundle, const int32_t userId);
 
     bool GetApiTargetVersionByUid(const uid_t uid, int32_t &apiTargetVersion);
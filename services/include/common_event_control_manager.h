@@ -16,8 +16,12 @@
 #ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_COMMON_EVENT_CONTROL_MANAGER_H
 #define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_COMMON_EVENT_CONTROL_MANAGER_H
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include "common_event_permission_manager.h"
 #include "common_event_subscriber_manager.h"
+#include "event_log_limiter.h"
 #include "history_event_record.h"
 #include "ievent_receive.h"
 #include "ordered_event_record.h"
@@ -71,6 +75,13 @@ public:
     bool FinishReceiverAction(std::shared_ptr<OrderedEventRecord> recordPtr, const int32_t &code,
         const std::string &receiverData, const bool &abortEvent);
 
+    /**
+     * Skips the pending ordered receivers of a dead process and finishes the one being waited for.
+     *
+     * @param pid Indicates the pid of the dead process.
+     */
+    void RemoveProcessReceivers(pid_t pid);
+
     /**
      * Processes the current ordered event when it is timeout.
      *
@@ -107,6 +118,28 @@ public:
      * @return Returns true if success; false otherwise.
      */
     bool PublishAllFreezeCommonEvents();
+
+    /**
+     * Sets the events whose pending unordered broadcasts are replaced by newer publishes.
+     *
+     * @param events Indicates the names of the events carrying state snapshots.
+     */
+    void SetCoalescingEvents(const std::unordered_set<std::string> &events);
+
+    /**
+     * Sets the credit limit and overflow policy of subscribers that acknowledge their events.
+     *
+     * @param config Indicates the flow control configuration.
+     */
+    void SetFlowControlConfig(const SubscriberFlowControl::Config &config);
+
+    /**
+     * Returns delivery credit of a subscriber and sends the deferred events that fit in it.
+     *
+     * @param subscriberRecord Indicates the subscriber record.
+     * @param count Indicates the number of events the subscriber has handled.
+     */
+    void AckEvents(const std::shared_ptr<EventSubscriberRecord> &subscriberRecord, uint32_t count);
 #ifdef CEM_SUPPORT_DUMP
     /**
      * Dumps state of common event service.
@@ -116,6 +149,15 @@ public:
      * @param state Indicates the state of common event service.
      */
     void DumpState(const std::string &event, const int32_t &userId, std::vector<std::string> &state);
+
+    /**
+     * Dumps the pending events in structured form.
+     *
+     * @param event Specifies the information for the common event. Set null string ("") if you want to dump all.
+     * @param userId Indicates the user ID.
+     * @param root Indicates the output, "pending" is filled in.
+     */
+    void DumpStructured(const std::string &event, const int32_t &userId, nlohmann::json &root);
 #endif
 private:
     bool ProcessUnorderedEvent(
@@ -134,6 +176,12 @@ private:
 
     bool EnqueueUnorderedRecord(const std::shared_ptr<OrderedEventRecord> &eventRecordPtr);
 
+    bool CoalesceUnorderedRecord(const std::shared_ptr<OrderedEventRecord> &eventRecordPtr);
+
+    bool IsSupersedingEvent(const CommonEventRecord &eventRecord);
+
+    void ClaimUnorderedRecord(const std::shared_ptr<OrderedEventRecord> &eventRecordPtr);
+
     bool ScheduleOrderedCommonEvent();
 
     bool NotifyOrderedEvent(std::shared_ptr<OrderedEventRecord> &eventRecordPtr, size_t index);
@@ -183,6 +231,10 @@ private:
 
     bool NotifyFreezeEvents(const EventSubscriberRecord &subscriberRecord, const CommonEventRecord &eventRecord);
 
+    void NotifyDeferredEvents(const std::shared_ptr<EventSubscriberRecord> &subscriberRecord);
+
+    void StartAckTimer(const std::shared_ptr<EventSubscriberRecord> &subscriberRecord);
+
     void GetOrderedEventRecords(
         const std::string &event, const int32_t &userId, std::vector<std::shared_ptr<OrderedEventRecord>> &records);
 
@@ -193,7 +245,9 @@ private:
 
     void DumpStateBySubscriberRecord(const std::shared_ptr<OrderedEventRecord> &record, std::string &dumpInfo);
 #endif
-    void PublishFrozenEventsInner(const FrozenRecords &frozenEventRecords);
+    void PublishFrozenEventsInner(FrozenRecords frozenEventRecords);
+
+    size_t NotifyFrozenEventsBatch(const FrozenRecords &frozenEventRecords);
 
     void SendOrderedEventProcTimeoutHiSysEvent(const std::shared_ptr<EventSubscriberRecord> &subscriberRecord,
         const std::string &eventName);
@@ -202,31 +256,20 @@ private:
 
     bool CanLogUnorderedEvent(const std::string &event);
 
-private:
-struct EventLogCache {
-    uint32_t missingCount_;
-    std::string event_;
-    std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds> lastTime_;
-    EventLogCache(std::string event,
-        std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds> time,
-        uint32_t count)
-    {
-        event_ = event;
-        lastTime_ = time;
-        missingCount_ = count;
-    }
-};
-
 private:
     std::vector<std::shared_ptr<OrderedEventRecord>> orderedEventQueue_;
-    std::vector<std::shared_ptr<OrderedEventRecord>> unorderedEventQueue_;
+    OrderedEventRecordList unorderedEventQueue_;
     bool pendingTimeoutMessage_;
     bool scheduled_;
     const int64_t TIMEOUT = 10000;  // How long we allow a receiver to run before giving up on it. Unit: ms
     ffrt::mutex orderedMutex_;
     ffrt::mutex unorderedMutex_;
-    ffrt::mutex logCacheMutex_;
-    std::vector<std::shared_ptr<EventLogCache>> unorderedEventLogCache_;
+    EventLogLimiter unorderedEventLogLimiter_;
+    std::unordered_set<std::string> coalescingEvents_;
+    // undispatched unordered records of coalescing events, keyed by event, user, publisher and publish info
+    std::unordered_map<std::string, std::shared_ptr<OrderedEventRecord>> pendingCoalescedRecords_;
+    std::shared_ptr<const SubscriberFlowControl::Config> flowControlConfig_ =
+        std::make_shared<const SubscriberFlowControl::Config>();
 
     std::shared_ptr<ffrt::queue> orderedQueue_ = nullptr;
     std::shared_ptr<ffrt::queue> unorderedQueue_ = nullptr;
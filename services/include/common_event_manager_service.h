@@ -182,6 +182,24 @@ public:
     * @return Returns true if successful; false otherwise.
     */
     ErrCode SetFreezeStatus(const std::set<int32_t>& pidList, bool isFreeze, bool& funcResult) override;
+
+    /**
+     * Negotiates the wire format of common event parcelables with the calling process.
+     *
+     * @param version Indicates the highest wire format version supported by the caller.
+     * @param funcResult Indicates the wire format version both sides agree on.
+     * @return Returns ERR_OK.
+     */
+    ErrCode NegotiateWireFormat(int32_t version, int32_t& funcResult) override;
+
+    /**
+     * Acknowledges events handled by a subscriber, returning its delivery credit.
+     *
+     * @param commonEventListener Indicates the common event listener of the subscriber.
+     * @param count Indicates the number of events handled since the last acknowledgement.
+     * @return Returns ERR_OK.
+     */
+    ErrCode AckEvents(const sptr<IRemoteObject>& commonEventListener, uint32_t count) override;
 #ifdef CEM_SUPPORT_DUMP
     int Dump(int fd, const std::vector<std::u16string> &args) override;
 #endif
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_COMMON_EVENT_MATCH_PERMISSION_H
 #define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_COMMON_EVENT_MATCH_PERMISSION_H
 
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -45,7 +46,7 @@ public:
     ~CommonEventPermissionManager() = default;
 
     /**
-     * Inits.
+     * Inits the permission table, called on the first GetEventPermission so it stays off the start path.
      *
      */
     void Init();
@@ -62,6 +63,7 @@ public:
 private:
     static bool IsSensitiveEvent(const std::string &event);
     std::unordered_map<std::string, Permission> eventMap_;
+    std::once_flag initFlag_;
 };
 }  // namespace EventFwk
 }  // namespace OHOS
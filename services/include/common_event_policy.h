@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_COMMON_EVENT_POLICY_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_COMMON_EVENT_POLICY_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+#include "subscriber_flow_control.h"
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Publish policy compiled from common_event_config.json.
+ *
+ * A policy is immutable once compiled, a config reload compiles a new one and swaps it in whole, so publishing
+ * only does hashed lookups and never touches the json documents.
+ */
+class CommonEventPolicy {
+public:
+    /**
+     * Compiles the policy from the config documents, each section is taken from the first document holding it.
+     *
+     * @param configs Indicates the parsed config documents.
+     * @return Returns the compiled policy.
+     */
+    static std::shared_ptr<const CommonEventPolicy> Compile(const std::vector<nlohmann::json> &configs);
+
+    /**
+     * Checks whether a uid may publish an event.
+     *
+     * @param event Indicates the event name.
+     * @param uid Indicates the uid of the publisher.
+     * @return Returns true if the event is not controlled or the uid is listed for it; false otherwise.
+     */
+    bool IsPublishAllowed(const std::string &event, int32_t uid) const;
+
+    const std::unordered_set<std::string> &GetCoalescingEvents() const
+    {
+        return coalescingEvents_;
+    }
+
+    const SubscriberFlowControl::Config &GetFlowControlConfig() const
+    {
+        return flowControlConfig_;
+    }
+
+private:
+    static const nlohmann::json *FindSection(const std::vector<nlohmann::json> &configs, const std::string &key);
+    void CompilePublishControl(const nlohmann::json &publishControl);
+    void CompileCoalescingEvents(const nlohmann::json &coalescingEvents);
+    void CompileBackpressure(const nlohmann::json &backpressure);
+
+    // key is the event name, value is the uids allowed to publish it
+    std::unordered_map<std::string, std::unordered_set<int32_t>> publishControl_;
+    std::unordered_set<std::string> coalescingEvents_;
+    SubscriberFlowControl::Config flowControlConfig_;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_COMMON_EVENT_POLICY_H
@@ -43,12 +43,14 @@ struct CommonEventRecord {
     std::shared_ptr<CommonEventPublishInfo> publishInfo;
     struct tm recordTime {};
     EventRecordInfo eventRecordInfo;
+    int64_t publishTime;  // publish IPC arrival from SystemTime::GetNowSysTimeUs, 0 if unknown
 
     CommonEventRecord()
         : isSystemEvent(false),
           userId(UNDEFINED_USER),
           commonEventData(nullptr),
-          publishInfo(nullptr)
+          publishInfo(nullptr),
+          publishTime(0)
     {}
 };
 }  // namespace EventFwk
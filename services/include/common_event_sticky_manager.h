@@ -22,6 +22,7 @@
 #include "common_event_record.h"
 #include "common_event_subscribe_info.h"
 #include "ffrt.h"
+#include "nlohmann/json.hpp"
 #include "singleton.h"
 
 namespace OHOS {
@@ -68,6 +69,15 @@ public:
      * @param state Indicates the state of common event service.
      */
     void DumpState(const std::string &event, const int32_t &userId, std::vector<std::string> &state);
+
+    /**
+     * Dumps the sticky events in structured form.
+     *
+     * @param event Specifies the information for the common event. Set null string ("") if you want to dump all.
+     * @param userId Indicates the user ID.
+     * @param root Indicates the output, "sticky" is filled in.
+     */
+    void DumpStructured(const std::string &event, const int32_t &userId, nlohmann::json &root);
 #endif
     /**
      * Remove sticky common event.
@@ -16,17 +16,26 @@
 #ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_COMMON_EVENT_SUBSCRIBER_MANAGER_H
 #define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_COMMON_EVENT_SUBSCRIBER_MANAGER_H
 
+#include <atomic>
+#include <functional>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "common_event_constant.h"
 #include "common_event_record.h"
 #include "common_event_subscribe_info.h"
+#include "dump_writer.h"
 #include "event_log_wrapper.h"
+#include "event_prefix_index.h"
 #include "ffrt.h"
 #include "iremote_object.h"
+#include "nlohmann/json.hpp"
 #include "singleton.h"
+#include "slab_allocator.h"
+#include "subscriber_flow_control.h"
+#include "subscriber_quota.h"
 
 namespace OHOS {
 namespace EventFwk {
@@ -37,12 +46,14 @@ struct EventSubscriberRecord {
     std::shared_ptr<CommonEventSubscribeInfo> eventSubscribeInfo;
     sptr<IRemoteObject> commonEventListener;
     EventRecordInfo eventRecordInfo;
+    std::shared_ptr<SubscriberFlowControl> flowControl;
 
     EventSubscriberRecord()
         : isFreeze(false),
           freezeTime(0),
           eventSubscribeInfo(nullptr),
-          commonEventListener(nullptr)
+          commonEventListener(nullptr),
+          flowControl(nullptr)
     {}
 
     bool operator<(const EventSubscriberRecord &other) const
@@ -72,6 +83,9 @@ using SubscriberRecordPtr = std::shared_ptr<EventSubscriberRecord>;
 using SubscribeInfoPtr = std::shared_ptr<CommonEventSubscribeInfo>;
 using EventRecordPtr = std::shared_ptr<CommonEventRecord>;
 using FrozenRecords = std::map<EventSubscriberRecord, std::vector<EventRecordPtr>>;
+// pid and uid of the frozen subscribers, proxy subscribers of all uids share the undefined pid
+using FrozenProcessKey = std::pair<pid_t, uid_t>;
+using FrozenProcessRecords = std::map<FrozenProcessKey, FrozenRecords>;
 
 class CommonEventSubscriberManager : public DelayedSingleton<CommonEventSubscriberManager> {
 public:
@@ -100,6 +114,23 @@ public:
      */
     int RemoveSubscriber(const sptr<IRemoteObject> &commonEventListener);
 
+    /**
+     * Removes the dead listener together with every other dead listener of the same pid and uid in one pass. The
+     * listeners of a process die together, so the deaths reported after the first one find nothing left to remove,
+     * while a live process that reused the pid keeps its subscribers.
+     *
+     * @param commonEventListener Indicates the dead subscriber object.
+     * @return Returns the number of subscribers removed.
+     */
+    size_t RemoveSubscribersOnDeath(const sptr<IRemoteObject> &commonEventListener);
+
+    /**
+     * Sets the callback told the pid and uid of a process whose subscribers were removed on death.
+     *
+     * @param callback Indicates the callback.
+     */
+    void SetProcessDiedCallback(const std::function<void(pid_t, uid_t)> &callback);
+
     /**
      * Gets subscriber records.
      *
@@ -108,6 +139,14 @@ public:
      */
     std::vector<SubscriberRecordPtr> GetSubscriberRecords(const CommonEventRecord &eventRecord);
 
+    /**
+     * Gets subscriber records into a caller owned vector, so a recycled vector is filled without reallocating.
+     *
+     * @param eventRecord Indicates the event record.
+     * @param records Indicates the subscriber records, cleared before filling.
+     */
+    void GetSubscriberRecords(const CommonEventRecord &eventRecord, std::vector<SubscriberRecordPtr> &records);
+
     /**
      * @brief Get the subscribe record by subscriber object.
      *
@@ -147,46 +186,45 @@ public:
      *
      * @param eventListener Indicates the subscriber object.
      * @param eventRecord Indicates the event record.
+     * @param superseding Indicates whether the event replaces the earlier frozen event of its action.
      */
-    void InsertFrozenEvents(const SubscriberRecordPtr &eventListener, const CommonEventRecord &eventRecord);
+    void InsertFrozenEvents(const SubscriberRecordPtr &eventListener, const CommonEventRecord &eventRecord,
+        bool superseding = false);
 
     /**
-     * Gets the frozen events.
+     * Takes the frozen events of an application out of the store.
      *
      * @param uid Indicates the uid of the application.
-     * @return Returns the frozen events.
+     * @return Returns the frozen events of each process of the application.
      */
-    FrozenRecords GetFrozenEvents(const uid_t &uid);
+    std::unordered_map<pid_t, FrozenRecords> GetFrozenEvents(const uid_t &uid);
 
     /**
-     * Gets all frozen events.
+     * Gets all frozen events, the store is left unchanged.
      *
-     * @return Returns all frozen events.
+     * @return Returns all frozen events by uid.
      */
     std::unordered_map<uid_t, FrozenRecords> GetAllFrozenEvents();
 
     /**
-    * Inserts freeze events.
-    *
-    * @param eventListener Indicates the subscriber object.
-    * @param eventRecord Indicates the event record.
-    */
-    void InsertFrozenEventsMap(const SubscriberRecordPtr &eventListener, const CommonEventRecord &eventRecord);
+     * Takes the frozen events of a process out of the store.
+     *
+     * @param pid Indicates the process id.
+     * @return Returns the frozen events.
+     */
+    FrozenRecords GetFrozenEventsByPid(const pid_t &pid);
 
     /**
-    * Gets the frozen events.
-    *
-    * @param pid Indicates the process id.
-    * @return Returns the frozen events.
-    */
-    FrozenRecords GetFrozenEventsMapByPid(const pid_t &pid);
+     * Takes all frozen events out of the store.
+     *
+     * @return Returns the frozen events of each process.
+     */
+    FrozenProcessRecords TakeAllFrozenEvents();
 
     /**
-    * Gets all frozen events.
-    *
-    * @return Returns all frozen events.
-    */
-    std::unordered_map<pid_t, FrozenRecords> GetAllFrozenEventsMap();
+     * Reads the subscriber limit and the per-uid quota from the system parameters again.
+     */
+    void ReloadSubscriberLimits();
 #ifdef CEM_SUPPORT_DUMP
     /**
      * Dumps detailed information for specific subscriber record info.
@@ -206,6 +244,33 @@ public:
      * @param state Indicates the output information.
      */
     void DumpState(const std::string &event, const int32_t &userId, std::vector<std::string> &state);
+
+    /**
+     * Dumps the subscribers matching a filter straight into a writer, the subscriber lock is only held to copy
+     * the record pointers.
+     *
+     * @param event Specifies the information for the common event. Set null string ("") if you want to dump all.
+     * @param userId Indicates the user ID.
+     * @param filter Indicates the subscriber conditions and page.
+     * @param writer Indicates the output writer.
+     */
+    void DumpState(const std::string &event, const int32_t &userId, const DumpFilter &filter, DumpWriter &writer);
+
+    /**
+     * Dumps the subscribers and their frozen events in structured form.
+     *
+     * @param event Specifies the information for the common event. Set null string ("") if you want to dump all.
+     * @param userId Indicates the user ID.
+     * @param root Indicates the output, "subscribers" and "frozen" are filled in.
+     */
+    void DumpStructured(const std::string &event, const int32_t &userId, nlohmann::json &root);
+
+    /**
+     * Dumps the estimated memory held by the subscriber records and indexes.
+     *
+     * @param state Indicates the output information.
+     */
+    void DumpMemory(std::vector<std::string> &state);
 #endif
 private:
     bool CheckPublisherWhetherMatched(const SubscriberRecordPtr &subscriberRecord,
@@ -222,6 +287,8 @@ private:
     bool UpdateSubscriberRecordLocked(const SubscribeInfoPtr &eventSubscribeInfo,
         const struct tm &recordTime, const EventRecordInfo &eventRecordInfo, SubscriberRecordPtr record);
     int RemoveSubscriberRecordLocked(const sptr<IRemoteObject> &commonEventListener);
+    void RemoveSubscriberRecordsLocked(const std::function<bool(const SubscriberRecordPtr &)> &match,
+        std::vector<SubscriberRecordPtr> &removed);
 
     bool CheckSubscriberByUserId(const int32_t &subscriberUserId, const bool &isSystemApp, const int32_t &userId);
 
@@ -239,16 +306,23 @@ private:
     void GetSubscriberRecordsByWantLocked(const CommonEventRecord &eventRecord,
         std::vector<SubscriberRecordPtr> &records);
 
+    void CollectSubscriberRecord(const SubscriberRecordPtr &subscriberRecord, const CommonEventRecord &eventRecord,
+        bool isSystemApp, std::vector<SubscriberRecordPtr> &records);
+
+    bool CheckPrefixSubscriberPermission(const SubscriberRecordPtr &subscriberRecord,
+        const CommonEventRecord &eventRecord);
+
     void GetSubscriberRecordsByEvent(
         const std::string &event, const int32_t &userId, std::vector<SubscriberRecordPtr> &records);
+#ifdef CEM_SUPPORT_DUMP
+    void GetDumpEntries(const std::string &event, const int32_t &userId, std::vector<EventSubscriberRecord> &entries);
 
-    void RemoveFrozenEventsBySubscriber(const SubscriberRecordPtr &subscriberRecord);
-
-    void RemoveFrozenEvents(const uid_t &uid);
+    static void DumpDetailed(const EventSubscriberRecord &record, const std::string &format, DumpWriter &writer);
+#endif
 
-    void RemoveFrozenEventsMapBySubscriber(const SubscriberRecordPtr &subscriberRecord);
+    void RemoveFrozenEventsBySubscriber(const SubscriberRecordPtr &subscriberRecord);
 
-    void RemoveFrozenEventsMapByPid(const pid_t &pid);
+    FrozenRecords TakeFrozenProcessLocked(FrozenProcessRecords::iterator item);
 
     void SendSubscriberExceedMaximumHiSysEvent(int32_t userId, const std::string &eventName, uint32_t subscriberNum);
 
@@ -256,6 +330,9 @@ private:
 
     std::vector<std::pair<pid_t, uint32_t>> GetTopSubscriberCounts(size_t topNum = 10);
 
+    void KillTopSubscriber(pid_t killedPid, const std::map<pid_t, SubscriberRecordPtr> &topRecordsMap,
+        const std::string &bundleName);
+
     void PrintSubscriberCounts(std::vector<std::pair<pid_t, uint32_t>> vtSubscriberCounts);
 
     void SubscribeScreenEventToBlackListApp(const CommonEventRecord &eventRecord, std::string subscribeBundleName,
@@ -263,8 +340,32 @@ private:
 
     void InsertEventSubscribers(const std::vector<std::string> &events, const SubscriberRecordPtr &record);
     void RemoveEventSubscribers(const std::vector<std::string> &events, const SubscriberRecordPtr &record);
+    void InsertPrefixSubscribers(const std::vector<std::string> &prefixes, const SubscriberRecordPtr &record);
+    void RemovePrefixSubscribers(const std::vector<std::string> &prefixes, const SubscriberRecordPtr &record);
+
+    struct FragmentationStats {
+        size_t vectorSlack = 0;  // capacity beyond size of the subscriber list and the per-event vectors
+        size_t emptyEvents = 0;
+        size_t idleBuckets = 0;
+
+        size_t GetSlackBytes() const;
+    };
+
+    FragmentationStats MeasureFragmentationLocked() const;
 
-    void CompactSubscriberDataStructures();
+    /**
+     * Posts a compaction check to the background queue unless one is pending.
+     */
+    void ScheduleCompaction();
+
+    void RunCompaction();
+
+    /**
+     * Compacts one bounded slice of the subscriber tables.
+     *
+     * @return Returns true if the compaction has more slices to run; false if it finished or was not needed.
+     */
+    bool CompactStep();
 
     std::map<pid_t, SubscriberRecordPtr> GetTopSubscriberRecordsMap(
         const std::vector<std::pair<pid_t, uint32_t>> &topSubscriberCounts);
@@ -283,12 +384,26 @@ private:
     ffrt::mutex mutex_;
     sptr<IRemoteObject::DeathRecipient> death_;
     std::unordered_map<std::string, std::vector<SubscriberRecordPtr>> eventSubscribers_;
+    EventPrefixIndex<SubscriberRecordPtr> prefixSubscribers_;
     std::vector<SubscriberRecordPtr> subscribers_;
-    std::unordered_map<uid_t, FrozenRecords> frozenEvents_;
+    // resolves acks and resubscriptions without scanning the flat list
+    std::unordered_map<IRemoteObject *, SubscriberRecordPtr> listenerIndex_;
+    // frozen events are stored once per process and replayed per process, the uid index serves uid unfreezing
+    FrozenProcessRecords frozenEvents_;
+    std::unordered_map<uid_t, std::unordered_set<pid_t>> frozenPids_;
+    // the frozen copy of the last event, shared by the frozen subscribers it was dispatched to
+    std::weak_ptr<CommonEventRecord> lastFrozenRecord_;
     const time_t FREEZE_EVENT_TIMEOUT = 30;
-    std::unordered_map<pid_t, uint32_t> subscriberCounts_;
-    std::unordered_map<pid_t, FrozenRecords> frozenEventsMap_;
-    bool hasCompacted_ = false;
+    SubscriberQuota subscriberQuota_;
+    std::function<void(pid_t, uid_t)> processDiedCallback_;
+    bool compacting_ = false;
+    std::vector<std::string> compactEvents_;
+    FragmentationStats compactBefore_;
+    FragmentationStats compactAfter_;
+    uint32_t compactRuns_ = 0;
+    std::atomic<bool> compactScheduled_ {false};
+    ffrt::mutex compactMutex_;
+    std::shared_ptr<ffrt::queue> compactQueue_;
 };
 }  // namespace EventFwk
 }  // namespace OHOS
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_DUMP_WRITER_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_DUMP_WRITER_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Subscriber conditions and page of a dump, a field left unset matches every subscriber.
+ */
+struct DumpFilter {
+    std::optional<int32_t> pid;
+    std::optional<int32_t> uid;
+    std::string bundleName;
+    size_t page = 0;
+    // 0 dumps every matching subscriber in one page
+    size_t pageSize = 0;
+
+    bool Match(int32_t recordPid, int32_t recordUid, const std::string &recordBundleName) const
+    {
+        return (!pid.has_value() || pid.value() == recordPid) && (!uid.has_value() || uid.value() == recordUid) &&
+            (bundleName.empty() || bundleName == recordBundleName);
+    }
+};
+
+/**
+ * Appends dump text to a string or streams it to a file descriptor through a small buffer, so a large dump is
+ * never held in memory as a whole.
+ */
+class DumpWriter {
+public:
+    explicit DumpWriter(int fd);
+
+    explicit DumpWriter(std::string &output);
+
+    ~DumpWriter();
+
+    DumpWriter &Append(std::string_view text);
+
+    DumpWriter &Append(int64_t value);
+
+    /**
+     * Writes out the buffered text.
+     *
+     * @return Returns true if everything appended so far was written; false otherwise.
+     */
+    bool Flush();
+
+private:
+    DumpWriter(const DumpWriter &) = delete;
+    DumpWriter &operator=(const DumpWriter &) = delete;
+
+    int fd_ = -1;
+    std::string *output_ = nullptr;
+    std::string buffer_;
+    bool failed_ = false;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_DUMP_WRITER_H
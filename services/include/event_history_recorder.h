@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_EVENT_HISTORY_RECORDER_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_EVENT_HISTORY_RECORDER_H
+
+#include <atomic>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "ordered_event_record.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Ring buffer of the most recently finished publishes.
+ *
+ * Entries are fixed-size and refer to event and bundle names through an interning table, so recording is a
+ * handful of word stores. Each slot is guarded by a sequence number: writers claim a slot with a CAS and
+ * readers drop entries that changed while being copied, neither side takes a lock.
+ */
+class EventHistoryRecorder : public DelayedSingleton<EventHistoryRecorder> {
+public:
+    EventHistoryRecorder();
+
+    ~EventHistoryRecorder();
+
+    /**
+     * Records a publish whose dispatch has finished.
+     *
+     * @param record Indicates the event record with its receivers and delivery states.
+     */
+    void Record(const OrderedEventRecord &record);
+
+#ifdef CEM_SUPPORT_DUMP
+    /**
+     * Dumps the recorded publishes, newest first.
+     *
+     * @param event Indicates the event name. Set null string ("") if you want to dump all.
+     * @param userId Indicates the user ID. Set ALL_USER if you want to dump all.
+     * @param state Indicates the output information.
+     */
+    void DumpState(const std::string &event, const int32_t &userId, std::vector<std::string> &state) const;
+#endif
+
+private:
+    static constexpr size_t CAPACITY = 128;
+    static constexpr size_t MAX_RECEIVER_NUM = 8;
+    static constexpr size_t MAX_STRING_NUM = 256;
+    static constexpr size_t STRING_PROBE_NUM = 8;
+    static constexpr size_t STRING_WORD_NUM = 16;
+    // one byte of the string words holds the length, longer strings are kept truncated
+    static constexpr size_t MAX_STRING_LENGTH = STRING_WORD_NUM * sizeof(uint64_t) - 1;
+
+    enum Flag : uint8_t {
+        STICKY = 1 << 0,
+        ORDERED = 1 << 1,
+        SYSTEM_APP = 1 << 2,
+        SYSTEM_EVENT = 1 << 3,
+        RESULT_ABORT = 1 << 4,
+        HAS_LAST_SUBSCRIBER = 1 << 5,
+    };
+
+    struct ReceiverEntry {
+        uint32_t bundleName;
+        int32_t pid;
+        uint32_t costUs;
+        uint8_t state;
+    };
+
+    struct Entry {
+        int64_t finishTime;  // wall clock in milliseconds
+        uint32_t event;
+        uint32_t bundleName;
+        int32_t pid;
+        int32_t uid;
+        int32_t userId;
+        int32_t code;
+        uint32_t costUs;  // publish arrival to finish, 0 if unknown
+        uint32_t fanOut;
+        uint16_t stateCount[OrderedEventRecord::TIMEOUT + 1];
+        uint8_t flags;
+        uint8_t receiverNum;
+        ReceiverEntry receivers[MAX_RECEIVER_NUM];
+    };
+    static_assert(std::is_trivially_copyable<Entry>::value, "history entries are copied word by word");
+
+    static constexpr size_t WORD_NUM = (sizeof(Entry) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    struct Slot {
+        // 2 * index + 1 while being written, 2 * index + 2 once entry index is complete
+        std::atomic<uint64_t> sequence {0};
+        std::atomic<uint64_t> words[WORD_NUM] {};
+    };
+
+    struct StringSlot {
+        // 2 * generation + 1 while being written, 2 * generation + 2 once the string is complete, 0 if unused
+        std::atomic<uint64_t> sequence {0};
+        std::atomic<uint64_t> hash {0};
+        std::atomic<uint64_t> words[STRING_WORD_NUM] {};
+    };
+
+    uint32_t Intern(const std::string &value);
+    bool StoreString(StringSlot &slot, uint64_t sequence, uint64_t hash, const uint64_t *words);
+    std::string GetString(uint32_t id) const;
+    bool Load(uint64_t index, Entry &entry) const;
+    static uint32_t ToCostUs(int64_t costUs);
+#ifdef CEM_SUPPORT_DUMP
+    std::string DumpEntry(size_t num, const Entry &entry) const;
+#endif
+
+    std::atomic<uint64_t> next_ {0};
+    Slot slots_[CAPACITY];
+    // interned strings, a slot whose probe window is full is overwritten under a new generation. The id is
+    // generation * MAX_STRING_NUM + position + 1 so entries of an evicted string read back as unknown, and 0
+    // stands for a string that could not be stored
+    StringSlot strings_[MAX_STRING_NUM];
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_EVENT_HISTORY_RECORDER_H
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_EVENT_LATENCY_METRICS_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_EVENT_LATENCY_METRICS_H
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "singleton.h"
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Per event latency histograms of the publish path.
+ *
+ * Each event owns one log-linear histogram per stage, eight sub-buckets per power of two, so percentiles are
+ * within 12.5% of the recorded value. Slots are claimed with a CAS in a fixed table and buckets are bumped with
+ * relaxed atomics, recording never takes a lock. Events that find no free slot within a few probes share one
+ * overflow slot.
+ */
+class EventLatencyMetrics : public DelayedSingleton<EventLatencyMetrics> {
+public:
+    enum Stage : uint8_t {
+        ARRIVAL_TO_QUEUE = 0,  // publish IPC arrival to the record being queued for dispatch
+        QUEUE_WAIT,            // queued for dispatch to the first receiver being notified
+        MATCH,                 // subscriber matching
+        RECEIVER_IPC,          // one NotifyEvent call to a receiver
+        ORDERED_FINISH,        // ordered event dispatch to the last receiver finishing
+        STAGE_MAX,
+    };
+
+    EventLatencyMetrics();
+
+    ~EventLatencyMetrics();
+
+    /**
+     * Records one sample.
+     *
+     * @param event Indicates the event name.
+     * @param stage Indicates the stage of the publish path.
+     * @param costUs Indicates the elapsed time in microseconds.
+     */
+    void Record(const std::string &event, Stage stage, int64_t costUs);
+
+    /**
+     * Records the time elapsed since a start point.
+     *
+     * @param event Indicates the event name.
+     * @param stage Indicates the stage of the publish path.
+     * @param startUs Indicates the start point from SystemTime::GetNowSysTimeUs, ignored if not positive.
+     */
+    void RecordSince(const std::string &event, Stage stage, int64_t startUs);
+
+#ifdef CEM_SUPPORT_DUMP
+    /**
+     * Dumps count, p50, p99 and max of every stage.
+     *
+     * @param event Indicates the event name. Set null string ("") if you want to dump all.
+     * @param state Indicates the output information.
+     */
+    void DumpState(const std::string &event, std::vector<std::string> &state) const;
+#endif
+
+private:
+    static constexpr size_t SUB_BUCKET_BITS = 3;
+    static constexpr size_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static constexpr size_t MAX_VALUE_BITS = 32;
+    static constexpr size_t BUCKET_NUM = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+    static constexpr size_t MAX_EVENT_NUM = 256;
+    static constexpr size_t PROBE_NUM = 8;
+
+    struct Histogram {
+        std::atomic<uint32_t> buckets[BUCKET_NUM] {};
+        std::atomic<uint64_t> count {0};
+        std::atomic<uint64_t> max {0};
+    };
+
+    struct EventSlot {
+        explicit EventSlot(const std::string &name) : event(name) {}
+        const std::string event;
+        Histogram stages[STAGE_MAX];
+    };
+
+    EventSlot *GetSlot(const std::string &event);
+    static size_t GetBucketIndex(uint64_t value);
+    static uint64_t GetBucketUpperBound(size_t index);
+    static uint64_t GetPercentile(const Histogram &histogram, uint64_t count, uint32_t percent);
+
+    std::atomic<EventSlot *> slots_[MAX_EVENT_NUM] {};
+    EventSlot overflow_;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_EVENT_LATENCY_METRICS_H
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_EVENT_LOG_LIMITER_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_EVENT_LOG_LIMITER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Lets one log line per event through in each interval and counts the suppressed ones. Events are kept in a fixed
+ * table of atomic slots indexed by the hash of the event name, so a check neither locks nor allocates.
+ */
+class EventLogLimiter {
+public:
+    explicit EventLogLimiter(int64_t interval);
+
+    /**
+     * Checks whether the event may be logged now.
+     *
+     * @param event Indicates the event name.
+     * @param now Indicates the current time, in the unit of the interval.
+     * @param suppressed Indicates the output number of lines suppressed since the event was last logged.
+     * @return Returns true if the event may be logged; false if the line is suppressed.
+     */
+    bool CanLog(const std::string &event, int64_t now, uint32_t &suppressed);
+
+private:
+    static constexpr size_t SLOT_NUM = 512;
+    static constexpr size_t PROBE_NUM = 8;
+
+    struct Slot {
+        std::atomic<size_t> key {0};
+        std::atomic<int64_t> windowStart {0};
+        std::atomic<uint32_t> suppressed {0};
+    };
+
+    static size_t GetKey(const std::string &event);
+
+    bool Claim(Slot &slot, size_t current, size_t key, int64_t now);
+
+    int64_t interval_;
+    std::array<Slot, SLOT_NUM> slots_;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_EVENT_LOG_LIMITER_H
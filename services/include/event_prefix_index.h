@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_EVENT_PREFIX_INDEX_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_EVENT_PREFIX_INDEX_H
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Character trie mapping event prefixes to values.
+ *
+ * Lookups walk the event name once and visit the values of every prefix on the way, so the cost depends on
+ * the length of the event name rather than on the number of prefix subscriptions.
+ */
+template <typename T>
+class EventPrefixIndex {
+public:
+    /**
+     * Adds a value under a prefix.
+     *
+     * @param prefix Indicates the event prefix.
+     * @param value Indicates the value.
+     * @return Returns true if the value is added; false if it already exists under the prefix.
+     */
+    bool Insert(const std::string &prefix, const T &value)
+    {
+        Node *node = &root_;
+        for (char ch : prefix) {
+            auto &child = node->children[ch];
+            if (child == nullptr) {
+                child = std::make_unique<Node>();
+            }
+            node = child.get();
+        }
+        if (std::find(node->values.begin(), node->values.end(), value) != node->values.end()) {
+            return false;
+        }
+        node->values.emplace_back(value);
+        ++size_;
+        return true;
+    }
+
+    /**
+     * Removes a value from a prefix and prunes the nodes left empty.
+     *
+     * @param prefix Indicates the event prefix.
+     * @param value Indicates the value.
+     * @return Returns true if the value is removed; false if it does not exist.
+     */
+    bool Remove(const std::string &prefix, const T &value)
+    {
+        std::vector<Node *> path;
+        path.reserve(prefix.size() + 1);
+        Node *node = &root_;
+        path.emplace_back(node);
+        for (char ch : prefix) {
+            auto it = node->children.find(ch);
+            if (it == node->children.end()) {
+                return false;
+            }
+            node = it->second.get();
+            path.emplace_back(node);
+        }
+        auto it = std::find(node->values.begin(), node->values.end(), value);
+        if (it == node->values.end()) {
+            return false;
+        }
+        node->values.erase(it);
+        --size_;
+        for (size_t depth = prefix.size(); depth > 0; --depth) {
+            Node *current = path[depth];
+            if (!current->values.empty() || !current->children.empty()) {
+                break;
+            }
+            path[depth - 1]->children.erase(prefix[depth - 1]);
+        }
+        return true;
+    }
+
+    /**
+     * Visits every value whose prefix matches the event, shortest prefix first.
+     *
+     * @param event Indicates the event name.
+     * @param visitor Indicates the callable invoked with each matched value.
+     */
+    template <typename Visitor>
+    void ForEachMatch(const std::string &event, Visitor &&visitor) const
+    {
+        const Node *node = &root_;
+        for (size_t depth = 0; depth < event.size(); ++depth) {
+            auto it = node->children.find(event[depth]);
+            if (it == node->children.end()) {
+                return;
+            }
+            node = it->second.get();
+            for (const auto &value : node->values) {
+                visitor(value);
+            }
+        }
+    }
+
+    /**
+     * Gets the number of prefix and value pairs.
+     *
+     * @return Returns the number of pairs.
+     */
+    size_t Size() const
+    {
+        return size_;
+    }
+
+    bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+    void Clear()
+    {
+        root_.values.clear();
+        root_.children.clear();
+        size_ = 0;
+    }
+
+private:
+    struct Node {
+        std::vector<T> values;
+        std::unordered_map<char, std::unique_ptr<Node>> children;
+    };
+
+    Node root_;
+    size_t size_ = 0;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_EVENT_PREFIX_INDEX_H
@@ -18,6 +18,8 @@
 
 #include "access_token_helper.h"
 #include "common_event_control_manager.h"
+#include "common_event_policy.h"
+#include "dump_writer.h"
 #include "icommon_event.h"
 #include "static_subscriber_manager.h"
 #include "nlohmann/json.hpp"
@@ -55,7 +57,7 @@ public:
     bool PublishCommonEvent(const CommonEventData &data, const CommonEventPublishInfo &publishinfo,
         const sptr<IRemoteObject> &commonEventListener, const struct tm &recordTime, const pid_t &pid, const uid_t &uid,
         const Security::AccessToken::AccessTokenID &callerToken, const int32_t &userId, const std::string &bundleName,
-        const sptr<IRemoteObject> &service = nullptr);
+        const sptr<IRemoteObject> &service = nullptr, const int64_t publishTime = 0);
 
     /**
      * Subscribes to common events.
@@ -101,6 +103,16 @@ public:
      */
     void DumpState(const uint8_t &dumpType, const std::string &event, const int32_t &userId,
         std::vector<std::string> &state);
+
+    /**
+     * Dumps subscribers, sticky events, pending and frozen events with aggregate counters in structured form.
+     *
+     * @param event Specifies the information for the common event. Set null string ("") if you want to dump all.
+     * @param userId Indicates the user ID.
+     * @param binary Indicates whether to encode as CBOR instead of compact JSON text.
+     * @param result Indicates the serialized dump.
+     */
+    void DumpStructured(const std::string &event, const int32_t &userId, bool binary, std::string &result);
 #endif
     /**
      * Finishes Receiver.
@@ -113,6 +125,15 @@ public:
     void FinishReceiver(
         const sptr<IRemoteObject> &proxy, const int32_t &code, const std::string &receiverData, const bool &abortEvent);
 
+    /**
+     * Acknowledges events handled by a subscriber.
+     *
+     * @param commonEventListener Indicates the common event listener of the subscriber.
+     * @param count Indicates the number of handled events.
+     * @param pid Indicates the process id of the caller.
+     */
+    void AckEvents(const sptr<IRemoteObject> &commonEventListener, uint32_t count, pid_t pid);
+
     /**
      * Freezes application.
      *
@@ -139,6 +160,14 @@ public:
      * @param result the result of dump
      */
     void HiDump(const std::vector<std::u16string> &args, std::string &result);
+
+    /**
+     * dump event for hidumper into a writer, subscribers are streamed without building the whole result.
+     *
+     * @param args Indicates the dump options.
+     * @param writer Indicates the output writer.
+     */
+    void HiDump(const std::vector<std::u16string> &args, DumpWriter &writer);
 #endif
     /**
      * Remove sticky common event.
@@ -175,6 +204,14 @@ public:
     */
     bool SetFreezeStatus(std::set<int> pidList, bool isFreeze);
 
+    /**
+     * Reloads common_event_config.json and swaps in the compiled policy, publishes in progress keep the old one.
+     * The subscriber limits are read from the system parameters again as well.
+     *
+     * @return Returns true if a config file was read; false if the defaults are used.
+     */
+    bool ReloadConfig();
+
 private:
     bool ProcessStickyEvent(const CommonEventRecord &record);
     bool PublishStickyEvent(const std::shared_ptr<CommonEventSubscribeInfo> &sp,
@@ -187,10 +224,9 @@ private:
     void SendPublishHiSysEvent(int32_t userId, const std::string &publisherName, int32_t pid, int32_t uid,
         const std::string &events, bool succeed);
     void SetSystemUserId(const uid_t &uid, EventComeFrom &comeFrom, int32_t &userId);
+    bool LoadConfig();
     bool GetJsonFromFile(const char *path, nlohmann::json &root);
     bool GetJsonByFilePath(const char *filePath, std::vector<nlohmann::json> &roots);
-    bool GetConfigJson(const std::string &keyCheck, nlohmann::json &configJson) const;
-    void getCcmPublishControl();
     bool IsPublishAllowed(const std::string &event, int32_t uid);
 
 private:
@@ -199,8 +235,9 @@ private:
     DISALLOW_COPY_AND_MOVE(InnerCommonEventManager);
     std::string supportCheckSaPermission_ = "false";
     std::atomic<int> subCount = 0;
-    std::unordered_map<std::string, std::vector<int32_t>> publishControlMap_;
-    std::vector<nlohmann::json> eventConfigJson_;
+    // swapped whole with std::atomic_store on every load, readers take their own reference
+    std::shared_ptr<const CommonEventPolicy> policy_;
+    std::once_flag configFlag_;
 };
 }  // namespace EventFwk
 }  // namespace OHOS
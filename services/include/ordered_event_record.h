@@ -17,12 +17,15 @@
 #define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_ORDERED_EVENT_RECORD_H
 
 #include <atomic>
+#include <iterator>
 #include "common_event_record.h"
 #include "common_event_subscriber_manager.h"
 #include "ffrt.h"
 
 namespace OHOS {
 namespace EventFwk {
+class OrderedEventRecordList;
+
 struct OrderedEventRecord : public CommonEventRecord {
     enum EventState {
         IDLE = 0,
@@ -44,12 +47,20 @@ struct OrderedEventRecord : public CommonEventRecord {
     int64_t dispatchTime;
     int64_t receiverTime;
     int64_t finishTime;
+    int64_t enqueueTime;
     sptr<IRemoteObject> resultTo;
     sptr<IRemoteObject> curReceiver;
     std::vector<uint8_t> deliveryState;
+    std::vector<uint32_t> deliveryCost;  // per receiver notify or processing time in microseconds
     std::vector<std::shared_ptr<EventSubscriberRecord>> receivers;
     ffrt::mutex recordMutex_;
 
+    // links of the OrderedEventRecordList the record is queued in, the list holds the record through queueRef
+    OrderedEventRecordList *queueList = nullptr;
+    OrderedEventRecord *queuePrev = nullptr;
+    OrderedEventRecord *queueNext = nullptr;
+    std::shared_ptr<OrderedEventRecord> queueRef;
+
     OrderedEventRecord()
         : resultAbort(false),
           state(0),
@@ -58,18 +69,209 @@ struct OrderedEventRecord : public CommonEventRecord {
           dispatchTime(0),
           receiverTime(0),
           finishTime(0),
+          enqueueTime(0),
           resultTo(nullptr),
           curReceiver(nullptr)
     {}
 
     inline void FillCommonEventRecord(const CommonEventRecord &commonEventRecord)
     {
+        isSystemEvent = commonEventRecord.isSystemEvent;
         commonEventData = commonEventRecord.commonEventData;
         publishInfo = commonEventRecord.publishInfo;
         recordTime = commonEventRecord.recordTime;
         userId = commonEventRecord.userId;
         eventRecordInfo = commonEventRecord.eventRecordInfo;
+        publishTime = commonEventRecord.publishTime;
+    }
+
+    /**
+     * Sets the delivery state of every receiver to PENDING, reusing the arrays of a recycled record.
+     */
+    inline void ResetDeliveryState()
+    {
+        deliveryState.assign(receivers.size(), PENDING);
+        deliveryCost.assign(receivers.size(), 0);
+    }
+
+    /**
+     * Drops the references of the last dispatch so the record can be recycled, the capacity of the arrays is kept.
+     */
+    void Reset()
+    {
+        isSystemEvent = false;
+        userId = UNDEFINED_USER;
+        commonEventData = nullptr;
+        publishInfo = nullptr;
+        recordTime = {};
+        eventRecordInfo.isSubsystem = false;
+        eventRecordInfo.isSystemApp = false;
+        eventRecordInfo.isProxy = false;
+        eventRecordInfo.pid = 0;
+        eventRecordInfo.uid = 0;
+        eventRecordInfo.callerToken = 0;
+        eventRecordInfo.bundleName.clear();
+        eventRecordInfo.subId.clear();
+        publishTime = 0;
+        resultAbort = false;
+        state.store(IDLE);
+        nextReceiver = 0;
+        enqueueClockTime = 0;
+        dispatchTime = 0;
+        receiverTime = 0;
+        finishTime = 0;
+        enqueueTime = 0;
+        resultTo = nullptr;
+        curReceiver = nullptr;
+        deliveryState.clear();
+        deliveryCost.clear();
+        receivers.clear();
+    }
+};
+
+/**
+ * FIFO of records linked through the records themselves, so a record is appended and removed in O(1) without a
+ * node allocation. A record is in at most one list and the list keeps it alive until it is erased.
+ */
+class OrderedEventRecordList {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::shared_ptr<OrderedEventRecord>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+
+        explicit Iterator(OrderedEventRecord *record) : record_(record)
+        {}
+
+        const std::shared_ptr<OrderedEventRecord> &operator*() const
+        {
+            return record_->queueRef;
+        }
+
+        Iterator &operator++()
+        {
+            record_ = record_->queueNext;
+            return *this;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return record_ == other.record_;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return record_ != other.record_;
+        }
+
+    private:
+        OrderedEventRecord *record_;
+    };
+
+    OrderedEventRecordList() = default;
+
+    ~OrderedEventRecordList()
+    {
+        clear();
+    }
+
+    /**
+     * Appends a record, a record that is already in a list is left where it is.
+     *
+     * @param record Indicates the record.
+     * @return Returns true if the record is appended; false otherwise.
+     */
+    bool emplace_back(const std::shared_ptr<OrderedEventRecord> &record)
+    {
+        if (record == nullptr || record->queueList != nullptr) {
+            return false;
+        }
+        record->queueList = this;
+        record->queuePrev = tail_;
+        record->queueNext = nullptr;
+        record->queueRef = record;
+        if (tail_ != nullptr) {
+            tail_->queueNext = record.get();
+        } else {
+            head_ = record.get();
+        }
+        tail_ = record.get();
+        size_++;
+        return true;
+    }
+
+    /**
+     * Removes a record.
+     *
+     * @param record Indicates the record.
+     * @return Returns true if the record was in the list; false otherwise.
+     */
+    bool erase(const std::shared_ptr<OrderedEventRecord> &record)
+    {
+        if (record == nullptr || record->queueList != this) {
+            return false;
+        }
+        Unlink(record.get());
+        return true;
+    }
+
+    void clear()
+    {
+        while (head_ != nullptr) {
+            Unlink(head_);
+        }
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    Iterator begin() const
+    {
+        return Iterator(head_);
+    }
+
+    Iterator end() const
+    {
+        return Iterator(nullptr);
+    }
+
+private:
+    OrderedEventRecordList(const OrderedEventRecordList &) = delete;
+    OrderedEventRecordList &operator=(const OrderedEventRecordList &) = delete;
+
+    void Unlink(OrderedEventRecord *record)
+    {
+        if (record->queuePrev != nullptr) {
+            record->queuePrev->queueNext = record->queueNext;
+        } else {
+            head_ = record->queueNext;
+        }
+        if (record->queueNext != nullptr) {
+            record->queueNext->queuePrev = record->queuePrev;
+        } else {
+            tail_ = record->queuePrev;
+        }
+        record->queueList = nullptr;
+        record->queuePrev = nullptr;
+        record->queueNext = nullptr;
+        size_--;
+        // may release the last reference, nothing of the record is touched after this
+        std::shared_ptr<OrderedEventRecord> ref = std::move(record->queueRef);
     }
+
+    OrderedEventRecord *head_ = nullptr;
+    OrderedEventRecord *tail_ = nullptr;
+    size_t size_ = 0;
 };
 }  // namespace EventFwk
 }  // namespace OHOS
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_ORDERED_EVENT_RECORD_POOL_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_ORDERED_EVENT_RECORD_POOL_H
+
+#include <memory>
+#include <vector>
+
+#include "ffrt.h"
+#include "ordered_event_record.h"
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Recycles the dispatch records of published events. A released record keeps the capacity of its receiver and
+ * delivery arrays, so a steady stream of publishes stops allocating once the pool is warm.
+ */
+class OrderedEventRecordPool {
+public:
+    struct Stats {
+        size_t idle = 0;
+        size_t created = 0;
+        size_t reused = 0;
+    };
+
+    static OrderedEventRecordPool &GetInstance();
+
+    /**
+     * Gets a reset record, it goes back to the pool when the last reference is released.
+     *
+     * @return Returns the record.
+     */
+    std::shared_ptr<OrderedEventRecord> Acquire();
+
+    Stats GetStats() const;
+
+private:
+    OrderedEventRecordPool() = default;
+    OrderedEventRecordPool(const OrderedEventRecordPool &) = delete;
+    OrderedEventRecordPool &operator=(const OrderedEventRecordPool &) = delete;
+
+    void Release(OrderedEventRecord *record);
+
+    mutable ffrt::mutex mutex_;
+    std::vector<std::unique_ptr<OrderedEventRecord>> idle_;
+    size_t created_ = 0;
+    size_t reused_ = 0;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_ORDERED_EVENT_RECORD_POOL_H
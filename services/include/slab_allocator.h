@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_SLAB_ALLOCATOR_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_SLAB_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+
+#include "ffrt.h"
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Hands out blocks of one size carved out of larger slabs. A freed block goes on the free list of its slab and is
+ * reused by the next allocation, so many small long lived objects share a few slabs instead of each paying the
+ * malloc header and spreading over the heap. Allocations fill the lowest slab first and slabs that become fully
+ * free are returned to the heap, except for one kept to absorb churn.
+ */
+class SlabPool {
+public:
+    struct Stats {
+        size_t blockSize = 0;
+        size_t slabs = 0;
+        size_t inUse = 0;
+        size_t reservedBytes = 0;
+    };
+
+    SlabPool() = default;
+
+    /**
+     * Allocates a block, the size of the first allocation fixes the block size of the pool.
+     *
+     * @param size Indicates the size of the block.
+     * @return Returns the block, or nullptr if the size differs from the block size of the pool.
+     */
+    void *Allocate(size_t size);
+
+    /**
+     * Gives a block back to the pool.
+     *
+     * @param block Indicates the block.
+     * @param size Indicates the size the block was allocated with.
+     * @return Returns true if the block belongs to the pool; false if it has to be freed by the caller.
+     */
+    bool Deallocate(void *block, size_t size);
+
+    Stats GetStats() const;
+
+private:
+    SlabPool(const SlabPool &) = delete;
+    SlabPool &operator=(const SlabPool &) = delete;
+
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    struct Slab {
+        std::unique_ptr<uint8_t[]> memory;
+        FreeBlock *freeList = nullptr;
+        size_t freeCount = 0;
+    };
+
+    static size_t GetBlockSize(size_t size);
+    bool AddSlabLocked();
+
+    mutable ffrt::mutex mutex_;
+    size_t blockSize_ = 0;
+    // keyed by the slab address, a freed block finds its slab with one lookup
+    std::map<uintptr_t, Slab> slabs_;
+    // slabs with free blocks, lowest address first so the others can drain
+    std::set<uintptr_t> availableSlabs_;
+    size_t emptySlabs_ = 0;
+    size_t inUse_ = 0;
+};
+
+/**
+ * Gets the pool shared by every allocator with the tag.
+ */
+template<typename Tag>
+SlabPool &GetSlabPool()
+{
+    // never destroyed, pooled objects may be released during static destruction
+    static SlabPool *pool = new SlabPool();
+    return *pool;
+}
+
+/**
+ * Allocator of single objects from the SlabPool of a tag, meant for std::allocate_shared so the control block and
+ * the object take one pooled block. Anything else falls back to operator new.
+ */
+template<typename T, typename Tag = T>
+class SlabAllocator {
+public:
+    using value_type = T;
+
+    SlabAllocator() = default;
+
+    template<typename U>
+    SlabAllocator(const SlabAllocator<U, Tag> &) noexcept
+    {}
+
+    T *allocate(size_t n)
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+        if (n == 1) {
+            void *block = GetSlabPool<Tag>().Allocate(sizeof(T));
+            if (block != nullptr) {
+                return static_cast<T *>(block);
+            }
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T *p, size_t n) noexcept
+    {
+        if (n == 1 && GetSlabPool<Tag>().Deallocate(p, sizeof(T))) {
+            return;
+        }
+        ::operator delete(p);
+    }
+
+    template<typename U>
+    bool operator==(const SlabAllocator<U, Tag> &) const noexcept
+    {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const SlabAllocator<U, Tag> &) const noexcept
+    {
+        return false;
+    }
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_SLAB_ALLOCATOR_H
@@ -58,6 +58,12 @@ public:
     void OnAbilityDisconnectDone(const AppExecFwk::ElementName &element, int resultCode) override;
 
     void NotifyEvent(const CommonEventData &event);
+    /**
+     * Takes the events cached before the ability is connected, used when the connect fails.
+     *
+     * @return Returns the cached events.
+     */
+    std::vector<CommonEventData> TakeEvents();
     void RemoveEvent(const std::string &action);
     bool IsEmptyAction()
     {
@@ -67,10 +73,16 @@ public:
 
 private:
     void InitProxy(const sptr<IRemoteObject> &remoteObject);
+    void ScheduleFlush(const std::string &action);
+    void FlushEvents(const std::string &action);
     sptr<IStaticSubscriber> proxy_ = nullptr;
     sptr<RemoteDeathRecipient> deathRecipient_ = nullptr;
     ffrt::recursive_mutex mutex_;
+    // events received before the ability is connected
     std::vector<CommonEventData> events_;
+    // events waiting to be sent in the next batch
+    std::vector<CommonEventData> pendingEvents_;
+    bool flushScheduled_ = false;
     std::vector<std::string> action_;
     std::shared_ptr<ffrt::queue> staticNotifyQueue_ = nullptr;
     std::string connectionKey_ = "";
@@ -16,9 +16,11 @@
 #ifndef BASE_NOTIFICATION_COMMON_EVENT_SERVICE_INCLUDE_STATIC_SUBSCRIBER_DATA_MANAGER_H
 #define BASE_NOTIFICATION_COMMON_EVENT_SERVICE_INCLUDE_STATIC_SUBSCRIBER_DATA_MANAGER_H
 
+#include <map>
 #include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "distributed_kv_data_manager.h"
 #include "ffrt.h"
@@ -39,7 +41,31 @@ public:
 
     int32_t DeleteDisableEventElementByBundleName(const std::string &bundleName);
 
+    /**
+     * Journals the disabled events of one bundle and queues them to be written by a background flush, a later change
+     * of the same bundle before the flush replaces them. The journal entry is synced before returning, so an accepted
+     * change survives a crash that happens before the flush.
+     *
+     * @param key Indicates the bundle as userId_bundleName.
+     * @param events Indicates the disabled events of the bundle, empty to remove the bundle.
+     * @return Returns ERR_OK if the change is journaled; otherwise ERR_INVALID_OPERATION.
+     */
+    int32_t UpdateStaticSubscriberStateAsync(const std::string &key, const std::vector<std::string> &events);
+
+    /**
+     * Writes the queued changes to the kv store. The journal is removed once the kv store is updated and nothing
+     * newer is queued, so changes not written before a crash are replayed by the next flush.
+     *
+     * @return Returns ERR_OK if nothing is left to write; otherwise the kv store error.
+     */
+    int32_t FlushStaticSubscriberState();
+
 private:
+    void ScheduleFlush(uint64_t delayMs);
+    int32_t ApplyStaticSubscriberState(const std::map<std::string, std::vector<std::string>> &changes);
+    bool AppendJournal(const std::string &key, const std::vector<std::string> &events);
+    bool ReadJournal(std::map<std::string, std::vector<std::string>> &changes);
+    void RemoveJournal();
     DistributedKv::Status GetKvStore();
     bool CheckKvStore();
     DistributedKv::Value ConvertEventsToValue(const std::vector<std::string> &events);
@@ -54,6 +80,14 @@ private:
     DistributedKv::DistributedKvDataManager dataManager_;
     std::shared_ptr<DistributedKv::SingleKvStore> kvStorePtr_;
     mutable ffrt::mutex kvStorePtrMutex_;
+    // journaled changes not yet handed to a flush, an empty event list removes the bundle
+    std::map<std::string, std::vector<std::string>> pendingChanges_;
+    bool flushScheduled_ = false;
+    uint32_t flushRetryCount_ = 0;
+    ffrt::mutex pendingMutex_;
+    // serializes flushes, taken before pendingMutex_
+    ffrt::mutex flushMutex_;
+    std::shared_ptr<ffrt::queue> flushQueue_ = nullptr;
 };
 } // namespace EventFwk
 } // namespace OHOS
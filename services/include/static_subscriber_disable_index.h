@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STATIC_SUBSCRIBER_DISABLE_INDEX_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STATIC_SUBSCRIBER_DISABLE_INDEX_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Lookup index of the events disabled through SetStaticSubscriberState.
+ *
+ * Event names are interned to dense ids and each bundle keeps a bitset over them, hashed by user and bundle name,
+ * so checking a subscriber on publish needs no key concatenation or list scan.
+ */
+class StaticSubscriberDisableIndex {
+public:
+    /**
+     * Replaces the index with the disabled events.
+     *
+     * @param disableEvents Indicates the disabled events keyed by userId_bundleName.
+     */
+    void Rebuild(const std::map<std::string, std::vector<std::string>> &disableEvents);
+
+    /**
+     * Replaces the disabled events of a bundle, an empty list removes the bundle.
+     *
+     * @param key Indicates the bundle key, userId_bundleName.
+     * @param events Indicates the disabled events.
+     */
+    void Set(const std::string &key, const std::vector<std::string> &events);
+
+    bool Contains(int32_t userId, const std::string &bundleName, const std::string &event) const;
+
+    void Clear();
+
+private:
+    static bool ParseKey(const std::string &key, int32_t &userId, std::string &bundleName);
+    uint32_t GetEventId(const std::string &event);
+
+    std::unordered_map<std::string, uint32_t> eventIds_;
+    // key is userId, then bundleName, value is a bitset indexed by event id
+    std::unordered_map<int32_t, std::unordered_map<std::string, std::vector<uint64_t>>> bundles_;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STATIC_SUBSCRIBER_DISABLE_INDEX_H
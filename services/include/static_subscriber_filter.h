@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STATIC_SUBSCRIBER_FILTER_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STATIC_SUBSCRIBER_FILTER_H
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "common_event_data.h"
+#include "want_params.h"
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Filter conditions of a static subscriber compiled into a flat program when the subscriber is registered.
+ *
+ * Parameter names are interned in a KeyTable shared by all subscribers and the program refers to them by slot,
+ * so a ParameterCache reads each want parameter at most once per publish however many subscribers test it.
+ */
+class StaticSubscriberFilter {
+public:
+    using ParameterType = std::variant<bool, int32_t, double, std::string>;
+
+    class KeyTable {
+    public:
+        /**
+         * Gets the slot of a parameter name, a new name is appended.
+         *
+         * @param key Indicates the parameter name.
+         * @return Returns the slot.
+         */
+        uint32_t GetSlot(const std::string &key);
+
+        const std::string &GetKey(uint32_t slot) const;
+
+        size_t GetSize() const;
+
+        /**
+         * Drops all names, only valid once every filter compiled against the table is dropped.
+         */
+        void Clear();
+
+    private:
+        std::vector<std::string> keys_;
+        std::unordered_map<std::string, uint32_t> slots_;
+    };
+
+    class ParameterCache {
+    public:
+        ParameterCache(const KeyTable &keys, const AAFwk::WantParams &params);
+
+        /**
+         * Gets the want parameter of a slot, reading it on first use.
+         *
+         * @param slot Indicates the slot from the key table.
+         * @return Returns the value, or nullptr if it is missing or not a bool, number or string.
+         */
+        const ParameterType *Get(uint32_t slot);
+
+        const std::string &GetKey(uint32_t slot) const
+        {
+            return keys_.GetKey(slot);
+        }
+
+    private:
+        const KeyTable &keys_;
+        const AAFwk::WantParams &params_;
+        std::vector<bool> loaded_;
+        std::vector<std::optional<ParameterType>> values_;
+    };
+
+    /**
+     * Compiles the filter conditions of a subscriber.
+     *
+     * @param code Indicates the required event code.
+     * @param data Indicates the required event data.
+     * @param parameters Indicates the required want parameters.
+     * @param keys Indicates the key table the parameter names are interned in.
+     * @return Returns the compiled filter.
+     */
+    static std::shared_ptr<const StaticSubscriberFilter> Compile(const std::optional<int32_t> &code,
+        const std::optional<std::string> &data, const std::map<std::string, ParameterType> &parameters,
+        KeyTable &keys);
+
+    /**
+     * Checks whether an event passes the filter.
+     *
+     * @param data Indicates the common event data.
+     * @param cache Indicates the parameters of the event want, built on the key table used by Compile.
+     * @return Returns true if every condition is met; false otherwise.
+     */
+    bool Match(const CommonEventData &data, ParameterCache &cache) const;
+
+    bool IsEmpty() const
+    {
+        return program_.empty();
+    }
+
+private:
+    enum class Opcode : uint8_t {
+        CODE_EQUAL,
+        DATA_EQUAL,
+        PARAMETER_EQUAL,
+    };
+
+    struct Instruction {
+        Opcode opcode;
+        uint32_t slot = 0;
+        ParameterType operand;
+    };
+
+    std::vector<Instruction> program_;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STATIC_SUBSCRIBER_FILTER_H
@@ -17,6 +17,7 @@
 #define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STATIC_SUBSCRIBER_MANAGER_H
 
 #include <map>
+#include <memory>
 #include <string>
 #include <set>
 #include <vector>
@@ -28,6 +29,9 @@
 #include "common_event_data.h"
 #include "common_event_publish_info.h"
 #include "singleton.h"
+#include "static_subscriber_disable_index.h"
+#include "static_subscriber_filter.h"
+#include "static_subscriber_snapshot.h"
 #include "ffrt.h"
 
 namespace OHOS {
@@ -70,6 +74,13 @@ public:
     using ParameterType = std::variant<bool, int32_t, double, std::string>;
 
 private:
+    // bundle attributes needed by publisher filters, resolved once per bundle and user
+    struct SubscriberIdentity {
+        int32_t uid = -1;
+        bool isSystemApp = false;
+        Security::AccessToken::AccessTokenID tokenId = 0;
+    };
+
     struct StaticSubscriberInfo {
         int32_t userId = -1;
         std::string name;
@@ -78,6 +89,9 @@ private:
         std::optional<int32_t> filterCode;
         std::optional<std::string> filterData;
         std::map<std::string, ParameterType> filterParameters;
+        std::shared_ptr<const SubscriberIdentity> identity;
+        // compiled from the filter fields above when added to validSubscribers_
+        std::shared_ptr<const StaticSubscriberFilter> filter;
 
         bool operator==(const StaticSubscriberInfo &that) const
         {
@@ -92,15 +106,30 @@ private:
 
     bool InitAllowList();
     bool InitValidSubscribers();
+    bool UpdateForegroundUsers();
+    bool AddUserSubscribers(const int32_t &userId);
+    void RemoveUserSubscribers(const int32_t &userId);
+    void AddToAllowList(const std::vector<AppExecFwk::ApplicationInfo> &appInfos);
+    void AddValidExtensions(const std::vector<AppExecFwk::ExtensionAbilityInfo> &extensions,
+        std::set<std::string> &profileKeys);
     void UpdateSubscriber(const CommonEventData &data);
     void ParseEvents(const std::string &extensionName, const std::string &extensionBundleName,
         const int32_t &extensionUid, const std::string &profile, bool enable = true);
+    void ParseProfile(const std::string &extensionName, const std::string &profile,
+        std::vector<StaticSubscriberSnapshot::Subscriber> &subscribers);
+    void AddParsedSubscribers(const std::string &extensionName, const std::string &extensionBundleName,
+        const int32_t &extensionUserId, const std::vector<StaticSubscriberSnapshot::Subscriber> &subscribers);
     void AddSubscriber(const AppExecFwk::ExtensionAbilityInfo &extension);
+    StaticSubscriberSnapshot &GetSnapshot();
     void AddToValidSubscribers(const std::string &eventName, const StaticSubscriberInfo &extension);
     void AddSubscriberWithBundleName(const std::string &bundleName, const int32_t &userId);
     void RemoveSubscriberWithBundleName(const std::string &bundleName, const int32_t &userId);
     bool VerifySubscriberPermission(const std::string &bundleName, const int32_t &userId,
         const std::vector<std::string> &permissions);
+    bool VerifySubscriberPermission(const Security::AccessToken::AccessTokenID &tokenId,
+        const std::vector<std::string> &permissions);
+    std::shared_ptr<const SubscriberIdentity> GetSubscriberIdentity(const std::string &bundleName,
+        const int32_t &userId);
     bool VerifyPublisherPermission(const Security::AccessToken::AccessTokenID &callerToken,
         const std::string &permission);
     void SendStaticEventProcErrHiSysEvent(int32_t userId, const std::string &publisherName,
@@ -132,9 +161,19 @@ private:
     bool CheckSubscriberBySpecifiedUids(const int32_t &subscriberUid,
         const std::vector<int32_t> &specifiedSubscriberUids);
     std::map<std::string, std::vector<StaticSubscriberInfo>> validSubscribers_;
+    // parameter names of the compiled filters in validSubscribers_
+    StaticSubscriberFilter::KeyTable filterKeys_;
     std::map<std::string, StaticSubscriber> staticSubscribers_;
+    // key is userId_bundleName, dropped on package events so the next registration resolves again
+    std::map<std::string, std::shared_ptr<const SubscriberIdentity>> subscriberIdentities_;
     // key is bundle, value is eventNames
     std::map<std::string, std::vector<std::string>> disableEvents_;
+    // lookup index of disableEvents_ for the publish path, guarded by disableEventsMutex_
+    StaticSubscriberDisableIndex disableIndex_;
+    // foreground users whose subscribers are in validSubscribers_
+    std::set<int32_t> loadedUsers_;
+    // parsed profiles reused across user switches and restarts, loaded on first use
+    std::unique_ptr<StaticSubscriberSnapshot> snapshot_;
     bool hasInitAllowList_ = false;
     bool hasInitValidSubscribers_ = false;
     ffrt::recursive_mutex subscriberMutex_;
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STATIC_SUBSCRIBER_SNAPSHOT_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STATIC_SUBSCRIBER_SNAPSHOT_H
+
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Parsed static subscriber profiles kept across user switches and service restarts.
+ *
+ * Each extension's parsed profile is stored with a fingerprint of the installed package, so a registry rebuild
+ * reuses it instead of fetching and parsing the JSON profile again. The file is a length-prefixed binary image
+ * written to a temporary file, synced and renamed into place, a missing or corrupt file only costs a full parse.
+ * Integers and doubles are stored in host byte order, so the file is device-local: it is only read back by the
+ * service that wrote it and must not be copied to another device.
+ */
+class StaticSubscriberSnapshot {
+public:
+    using ParameterType = std::variant<bool, int32_t, double, std::string>;
+
+    struct Subscriber {
+        std::string event;
+        std::string permission;
+        std::optional<int32_t> filterCode;
+        std::optional<std::string> filterData;
+        std::map<std::string, ParameterType> filterParameters;
+    };
+
+    struct Profile {
+        std::string fingerprint;
+        std::vector<Subscriber> subscribers;
+    };
+
+    explicit StaticSubscriberSnapshot(const std::string &path);
+
+    /**
+     * Loads the snapshot file, an unreadable file leaves the snapshot empty.
+     *
+     * @return Returns true if the file was loaded; false otherwise.
+     */
+    bool Load();
+
+    /**
+     * Writes the snapshot file if anything changed since the last load or save.
+     *
+     * @return Returns true if the file is up to date; false otherwise.
+     */
+    bool Save();
+
+    /**
+     * Finds the parsed profile of an extension.
+     *
+     * @param key Indicates the extension key from GetKey.
+     * @param fingerprint Indicates the fingerprint of the installed package.
+     * @return Returns the profile, or nullptr if it is missing or was parsed from another package.
+     */
+    const Profile *Find(const std::string &key, const std::string &fingerprint) const;
+
+    void Put(const std::string &key, Profile profile);
+
+    /**
+     * Erases the profiles whose key starts with a prefix.
+     *
+     * @param prefix Indicates the key prefix from GetUserPrefix or GetBundlePrefix.
+     * @param kept Indicates the keys to keep.
+     */
+    void Erase(const std::string &prefix, const std::set<std::string> &kept = {});
+
+    static std::string GetKey(int32_t userId, const std::string &bundleName, const std::string &extensionName);
+
+    static std::string GetUserPrefix(int32_t userId);
+
+    static std::string GetBundlePrefix(int32_t userId, const std::string &bundleName);
+
+private:
+    bool Parse(const std::string &buffer);
+    std::string Serialize() const;
+
+    std::string path_;
+    // key is userId_bundleName/extensionName
+    std::map<std::string, Profile> profiles_;
+    bool dirty_ = false;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STATIC_SUBSCRIBER_SNAPSHOT_H
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STRUCTURED_DUMP_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STRUCTURED_DUMP_H
+
+#include <string>
+
+#include "common_event_record.h"
+#include "common_event_subscriber_manager.h"
+#include "nlohmann/json.hpp"
+#include "ordered_event_record.h"
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Builds the machine readable form of the service state for hidumper -j/-b and cem stats.
+ *
+ * Field names are stable across releases, a field is only ever added, and the schema version is bumped whenever
+ * the meaning of an existing field changes.
+ */
+class StructuredDump {
+public:
+    static constexpr int32_t SCHEMA_VERSION = 1;
+
+    static nlohmann::json FromEventRecord(const CommonEventRecord &record);
+
+    static nlohmann::json FromOrderedEventRecord(const OrderedEventRecord &record);
+
+    static nlohmann::json FromSubscriberRecord(const EventSubscriberRecord &record, bool isFreeze, int64_t freezeTime);
+
+    /**
+     * Serializes a structured dump.
+     *
+     * @param root Indicates the dump.
+     * @param binary Indicates whether to encode as CBOR instead of compact JSON text.
+     * @return Returns the serialized dump.
+     */
+    static std::string Serialize(const nlohmann::json &root, bool binary);
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_STRUCTURED_DUMP_H
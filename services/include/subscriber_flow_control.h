@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_SUBSCRIBER_FLOW_CONTROL_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_SUBSCRIBER_FLOW_CONTROL_H
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common_event_record.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Credit based flow control of one dynamic subscriber.
+ *
+ * Every event sent to the subscriber is counted, and the subscriber process acknowledges handled events in
+ * batches. Once the events in flight reach the credit limit, further unordered events wait in a bounded backlog
+ * which is drained as acknowledgements come back. Credit that is not acknowledged within the ack timeout, e.g.
+ * for events the subscriber process dropped, is reclaimed so the subscriber is never throttled forever.
+ * Subscribers that never acknowledge are only counted.
+ */
+class SubscriberFlowControl {
+public:
+    enum Policy : uint8_t {
+        DEFER = 0,    // keep the backlog in order and drop new events once it is full
+        DROP_OLDEST,  // drop the oldest backlog event to make room for a new one
+        COALESCE,     // keep only the latest backlog event of each action
+    };
+
+    struct Config {
+        Policy policy = DEFER;
+        uint32_t maxInFlight = 256;
+        uint32_t maxBacklog = 64;
+        uint32_t ackTimeoutMs = 10000;
+    };
+
+    /**
+     * Takes one credit for an unordered event.
+     *
+     * @param config Indicates the flow control configuration.
+     * @param eventRecord Indicates the event to be sent.
+     * @return Returns true if the event can be sent now; false if it was moved to the backlog or dropped.
+     */
+    bool TryAcquire(const Config &config, const CommonEventRecord &eventRecord);
+
+    /**
+     * Counts an event delivered to the subscriber.
+     *
+     * @param acquired Indicates whether the credit was taken by TryAcquire or TakeDeferred. Events sent without
+     * a credit check, such as ordered events and frozen event replays, take their credit here.
+     */
+    void OnSent(bool acquired);
+
+    /**
+     * Gives back the credit of an event taken by TryAcquire or TakeDeferred whose delivery failed.
+     */
+    void Release();
+
+    /**
+     * Handles an acknowledgement from the subscriber and turns on credit checks.
+     *
+     * @param config Indicates the flow control configuration.
+     * @param count Indicates the number of acknowledged events.
+     * @return Returns true if the caller must start draining the backlog with TakeDeferred; false if there is
+     * nothing to send or a drain is already running.
+     */
+    bool Acknowledge(const Config &config, uint32_t count);
+
+    /**
+     * Takes the oldest backlog event while credit is left. New events wait behind the backlog until the drain
+     * ends, so deferred events are always sent in order.
+     *
+     * @param config Indicates the flow control configuration.
+     * @return Returns the event counted as sent, or nullptr once the drain ends.
+     */
+    std::shared_ptr<CommonEventRecord> TakeDeferred(const Config &config);
+
+    /**
+     * Arms the ack timer of a subscriber with a backlog.
+     *
+     * @return Returns true if the caller must call OnAckTimeout after the ack timeout; false if there is no
+     * backlog or a timer is already pending.
+     */
+    bool StartAckTimer();
+
+    /**
+     * Reclaims the credit in flight if the subscriber acknowledged nothing within the ack timeout.
+     *
+     * @param config Indicates the flow control configuration.
+     * @return Returns true if the caller must start draining the backlog with TakeDeferred; false otherwise.
+     */
+    bool OnAckTimeout(const Config &config);
+
+    /**
+     * Drops the backlog and the credit in flight of a subscriber whose listener died.
+     */
+    void Close();
+
+    /**
+     * Gets the counters as a single dump line.
+     *
+     * @return Returns the dump line, or an empty string for a subscriber that never acknowledged.
+     */
+    std::string Dump() const;
+
+private:
+    bool StartDrainLocked(const Config &config);
+    void DeferLocked(const Config &config, const CommonEventRecord &eventRecord);
+
+    mutable ffrt::mutex mutex_;
+    std::atomic<bool> tracked_ {false};
+    // sent_, acked_ and reclaimed_ only grow, the credit in use is kept apart in inFlight_
+    std::atomic<uint64_t> sent_ {0};
+    uint64_t acked_ = 0;
+    uint64_t reclaimed_ = 0;
+    uint64_t inFlight_ = 0;
+    uint64_t deferred_ = 0;
+    uint64_t dropped_ = 0;
+    uint64_t coalesced_ = 0;
+    bool draining_ = false;
+    bool ackTimerPending_ = false;
+    std::chrono::steady_clock::time_point lastAckTime_;
+    std::deque<std::shared_ptr<CommonEventRecord>> backlog_;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_SUBSCRIBER_FLOW_CONTROL_H
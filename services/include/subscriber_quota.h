@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_SUBSCRIBER_QUOTA_H
+#define FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_SUBSCRIBER_QUOTA_H
+
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <sys/types.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace EventFwk {
+/**
+ * Subscriber counts per pid and per uid, kept ranked as subscribers come and go so the heaviest processes are
+ * known without a scan, together with the cached service-wide limit and the soft per-uid quota.
+ *
+ * Not thread safe, it is guarded by the lock of the subscriber manager.
+ */
+class SubscriberQuota {
+public:
+    enum Result : uint8_t {
+        ALLOWED = 0,
+        WARNING,             // the total reaches the alarm threshold
+        LIMIT_REACHED,       // the total reaches the service-wide limit
+        UID_QUOTA_EXCEEDED,  // the uid already holds its quota of subscribers
+    };
+
+    /**
+     * Sets the limits, 0 disables the per-uid quota.
+     *
+     * @param maxTotal Indicates the service-wide subscriber limit.
+     * @param maxPerUid Indicates the soft subscriber quota of a uid.
+     */
+    void SetLimits(uint32_t maxTotal, uint32_t maxPerUid);
+
+    /**
+     * Checks whether one more subscriber can be added, in O(1).
+     *
+     * @param uid Indicates the uid of the new subscriber.
+     * @param checkUidQuota Indicates whether the per-uid quota applies to the uid.
+     * @return Returns the result of the check.
+     */
+    Result Check(uid_t uid, bool checkUidQuota) const;
+
+    void Add(pid_t pid, uid_t uid);
+
+    void Remove(pid_t pid, uid_t uid);
+
+    void Clear();
+
+    uint32_t GetTotal() const
+    {
+        return total_;
+    }
+
+    uint32_t GetMaxTotal() const
+    {
+        return maxTotal_;
+    }
+
+    uint32_t GetMaxPerUid() const
+    {
+        return maxPerUid_;
+    }
+
+    uint32_t GetUidCount(uid_t uid) const;
+
+    /**
+     * Gets the pids with the most subscribers in O(topNum).
+     *
+     * @param topNum Indicates the number of pids.
+     * @return Returns the pids and their counts in descending order of count.
+     */
+    std::vector<std::pair<pid_t, uint32_t>> GetTopPids(size_t topNum) const;
+
+private:
+    uint32_t maxTotal_ = 0;
+    uint32_t maxPerUid_ = 0;
+    uint32_t warningTotal_ = 0;
+    uint32_t total_ = 0;
+    std::unordered_map<pid_t, uint32_t> pidCounts_;
+    // ordered by count then pid, both descending, an update is one erase and one insert
+    std::set<std::pair<uint32_t, pid_t>, std::greater<std::pair<uint32_t, pid_t>>> pidRanking_;
+    // uids are only looked up, they need no ranking
+    std::unordered_map<uid_t, uint32_t> uidCounts_;
+};
+}  // namespace EventFwk
+}  // namespace OHOS
+
+#endif  // FOUNDATION_EVENT_CESFWK_SERVICES_INCLUDE_SUBSCRIBER_QUOTA_H
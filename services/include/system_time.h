@@ -28,6 +28,13 @@ public:
      * @return Returns he now time of system.
      */
     static int64_t GetNowSysTime();
+
+    /**
+     * Gets the now time of system in microseconds.
+     *
+     * @return Returns the now time of system in microseconds.
+     */
+    static int64_t GetNowSysTimeUs();
 };
 }  // namespace EventFwk
 }  // namespace OHOS
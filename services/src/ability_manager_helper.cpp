@@ -28,11 +28,14 @@ namespace EventFwk {
 namespace {
 constexpr int32_t DISCONNECT_DELAY_TIME = 15000; // ms
 constexpr int32_t TIME_UNIT_SIZE = 1000;
+constexpr int32_t MAX_CONNECTING_COUNT = 8;
 }
 
 AbilityManagerHelper::AbilityManagerHelper()
 {
     ffrt_ = std::make_shared<ffrt::queue>("AbilityManagerHelper");
+    connectQueue_ = std::make_shared<ffrt::queue>(ffrt::queue_concurrent, "AbilityManagerHelperConnect",
+        ffrt::queue_attr().max_concurrency(MAX_CONNECTING_COUNT));
 }
 
 int AbilityManagerHelper::ConnectAbility(
@@ -40,42 +43,95 @@ int AbilityManagerHelper::ConnectAbility(
 {
     NOTIFICATION_HITRACE(HITRACE_TAG_NOTIFICATION);
     EVENT_LOGD(LOG_TAG_CES, "enter, target bundle = %{public}s", want.GetBundle().c_str());
-    int result = -1;
-    ffrt::task_handle handle = ffrt_->submit_h([&]() {
-        std::string connectionKey =
-            want.GetBundle() + "_" + want.GetElement().GetAbilityName() + "_" + std::to_string(userId);
-        sptr<AAFwk::IAbilityManager> abilityMgr = GetAbilityMgrProxy();
-        if (abilityMgr == nullptr) {
-            EVENT_LOGE(LOG_TAG_CES, "Failed to get system ability manager services ability");
-            return;
+    sptr<StaticSubscriberConnection> connection = nullptr;
+    int result = AttachConnection(want, event, userId, connection);
+    if (result != ERR_OK || connection == nullptr) {
+        return result;
+    }
+    size_t droppedCount = 0;
+    return DoConnectAbility(want, connection, callerToken, userId, droppedCount);
+}
+
+void AbilityManagerHelper::ConnectAbilityAsync(const Want &want, const CommonEventData &event,
+    const sptr<IRemoteObject> &callerToken, const int32_t &userId, bool isPriority, const ConnectCallback &callback)
+{
+    NOTIFICATION_HITRACE(HITRACE_TAG_NOTIFICATION);
+    EVENT_LOGD(LOG_TAG_CES, "enter, target bundle = %{public}s", want.GetBundle().c_str());
+    sptr<StaticSubscriberConnection> connection = nullptr;
+    int result = AttachConnection(want, event, userId, connection);
+    if (result != ERR_OK || connection == nullptr) {
+        if (callback) {
+            callback(result, result != ERR_OK ? 1 : 0);
         }
-        std::lock_guard<ffrt::mutex> lock(mutex_);
-        auto it = subscriberConnection_.find(connectionKey);
-        if (it != subscriberConnection_.end()) {
-            it->second->NotifyEvent(event);
-            EVENT_LOGD(LOG_TAG_CES, "Static cache sends events!");
-            result = ERR_OK;
-            return;
+        return;
+    }
+    std::function<void()> task = [this, want, connection, callerToken, userId, callback]() {
+        size_t droppedCount = 0;
+        int result = DoConnectAbility(want, connection, callerToken, userId, droppedCount);
+        if (callback) {
+            callback(result, droppedCount);
         }
+    };
+    connectQueue_->submit(task,
+        ffrt::task_attr().priority(isPriority ? ffrt_queue_priority_high : ffrt_queue_priority_low));
+}
 
-        sptr<StaticSubscriberConnection> connection =
-            new (std::nothrow) StaticSubscriberConnection(event, connectionKey);
-        if (connection == nullptr) {
-            EVENT_LOGE(LOG_TAG_CES, "failed to create obj!");
-            result = -1;
-            return;
-        }
+int AbilityManagerHelper::AttachConnection(const Want &want, const CommonEventData &event, const int32_t &userId,
+    sptr<StaticSubscriberConnection> &connection)
+{
+    std::string connectionKey =
+        want.GetBundle() + "_" + want.GetElement().GetAbilityName() + "_" + std::to_string(userId);
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto it = subscriberConnection_.find(connectionKey);
+    if (it != subscriberConnection_.end()) {
+        // the connection caches the event if it is still connecting
+        it->second->NotifyEvent(event);
+        EVENT_LOGD(LOG_TAG_CES, "Static cache sends events!");
+        return ERR_OK;
+    }
+
+    connection = new (std::nothrow) StaticSubscriberConnection(event, connectionKey);
+    if (connection == nullptr) {
+        EVENT_LOGE(LOG_TAG_CES, "failed to create obj!");
+        return -1;
+    }
+    subscriberConnection_[connectionKey] = connection;
+    return ERR_OK;
+}
+
+int AbilityManagerHelper::DoConnectAbility(const Want &want, const sptr<StaticSubscriberConnection> &connection,
+    const sptr<IRemoteObject> &callerToken, const int32_t &userId, size_t &droppedCount)
+{
+    int result = -1;
+    sptr<AAFwk::IAbilityManager> abilityMgr = GetAbilityMgrProxy();
+    if (abilityMgr == nullptr) {
+        EVENT_LOGE(LOG_TAG_CES, "Failed to get system ability manager services ability");
+    } else {
         result = abilityMgr->ConnectAbility(want, connection, callerToken, userId);
-        if (result != ERR_OK) {
-            EVENT_LOGE(LOG_TAG_CES, "Connect failed, result=%{public}d", result);
-            return;
+    }
+    if (result != ERR_OK) {
+        std::vector<CommonEventData> events;
+        {
+            std::lock_guard<ffrt::mutex> lock(mutex_);
+            auto it = std::find_if(subscriberConnection_.begin(), subscriberConnection_.end(),
+                [&connection](const auto &pair) { return pair.second == connection; });
+            if (it != subscriberConnection_.end()) {
+                subscriberConnection_.erase(it);
+            }
+            // publishes attach events to a registered connection under mutex_, none arrive once it is erased
+            events = connection->TakeEvents();
+        }
+        droppedCount = events.size();
+        EVENT_LOGE(LOG_TAG_CES, "Connect failed, result=%{public}d, %{public}zu events dropped",
+            result, droppedCount);
+        for (const auto &event : events) {
+            EVENT_LOGW(LOG_TAG_CES, "Dropped event %{public}s", event.GetWant().GetAction().c_str());
         }
-        subscriberConnection_[connectionKey] = connection;
-        DisconnectServiceAbilityDelay(connection, "");
-        EVENT_LOGD(LOG_TAG_CES, "Connect success");
-    });
-    ffrt_->wait(handle);
-    return result;
+        return result;
+    }
+    DisconnectServiceAbilityDelay(connection, "");
+    EVENT_LOGD(LOG_TAG_CES, "Connect success");
+    return ERR_OK;
 }
 
 sptr<AAFwk::IAbilityManager> AbilityManagerHelper::GetAbilityMgrProxy()
@@ -245,6 +245,18 @@ bool BundleManagerHelper::GetApplicationInfos(const AppExecFwk::ApplicationFlag
     return result;
 }
 
+bool BundleManagerHelper::GetApplicationInfos(const AppExecFwk::ApplicationFlag &flag, const int32_t &userId,
+    std::vector<AppExecFwk::ApplicationInfo> &appInfos)
+{
+    EVENT_LOGD(LOG_TAG_CES, "enter, userId = %{public}d", userId);
+
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!GetBundleMgrProxy()) {
+        return false;
+    }
+    return sptrBundleMgr_->GetApplicationInfos(flag, userId, appInfos);
+}
+
 int32_t BundleManagerHelper::GetDefaultUidByBundleName(const std::string &bundle, const int32_t userId)
 {
     int32_t uid = -1;
@@ -15,16 +15,22 @@
 
 #include "common_event_control_manager.h"
 
+#include <algorithm>
 #include <cinttypes>
 
 #include "access_token_helper.h"
 #include "bundle_manager_helper.h"
 #include "common_event_constant.h"
+#include "common_event_wire_format.h"
+#include "event_history_recorder.h"
+#include "event_latency_metrics.h"
 #include "event_log_wrapper.h"
 #include "event_trace_wrapper.h"
 #include "event_report.h"
 #include "hitrace_meter_adapter.h"
 #include "ievent_receive.h"
+#include "ordered_event_record_pool.h"
+#include "structured_dump.h"
 #include "system_time.h"
 #include "xcollie/watchdog.h"
 namespace OHOS {
@@ -33,8 +39,36 @@ constexpr int32_t LENGTH = 80;
 constexpr int32_t DOUBLE = 2;
 static const int32_t TIME_UNIT_SIZE = 1000;
 
+static std::string GetCoalescingKey(const OrderedEventRecord &record)
+{
+    // receivers are matched against the publisher and its publish info, only publishes matching alike may fold
+    std::string key = record.commonEventData->GetWant().GetAction() + "#" + std::to_string(record.userId) + "#" +
+        std::to_string(record.eventRecordInfo.uid);
+    if (record.publishInfo == nullptr) {
+        return key;
+    }
+    const CommonEventPublishInfo &publishInfo = *record.publishInfo;
+    key.append(publishInfo.IsSticky() ? "#1#" : "#0#").append(publishInfo.GetBundleName())
+        .append("#").append(std::to_string(publishInfo.GetSubscriberType()))
+        .append("#").append(std::to_string(static_cast<int32_t>(publishInfo.GetValidationRule())));
+    for (const auto &permission : publishInfo.GetSubscriberPermissions()) {
+        key.append("#p").append(permission);
+    }
+    for (int32_t uid : publishInfo.GetSubscriberUid()) {
+        key.append("#u").append(std::to_string(uid));
+    }
+    return key;
+}
+
+static void SetDeliveryCost(OrderedEventRecord &record, size_t index, int64_t costUs)
+{
+    if (index < record.deliveryCost.size()) {
+        record.deliveryCost[index] = costUs > 0 ? static_cast<uint32_t>(std::min<int64_t>(costUs, UINT32_MAX)) : 0;
+    }
+}
+
 CommonEventControlManager::CommonEventControlManager()
-    : pendingTimeoutMessage_(false), scheduled_(false)
+    : pendingTimeoutMessage_(false), scheduled_(false), unorderedEventLogLimiter_(EVENT_LOG_EVENT_LIMIT_INTERVALS)
 {
     EVENT_LOGD(LOG_TAG_CES, "enter");
 }
@@ -83,7 +117,11 @@ bool CommonEventControlManager::PublishFreezeCommonEvent(const uid_t &uid)
         EVENT_LOGE(LOG_TAG_FREEZED, "failed to get eventhandler");
         return false;
     }
-    PublishFrozenEventsInner(DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->GetFrozenEvents(uid));
+    std::unordered_map<pid_t, FrozenRecords> frozenEvents =
+        DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->GetFrozenEvents(uid);
+    for (auto &[pid, frozenRecords] : frozenEvents) {
+        PublishFrozenEventsInner(std::move(frozenRecords));
+    }
     return true;
 }
 
@@ -98,7 +136,7 @@ bool CommonEventControlManager::PublishFreezeCommonEvent(std::set<int> pidList)
     }
     for (auto it = pidList.begin(); it != pidList.end(); it++) {
         PublishFrozenEventsInner(
-            DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->GetFrozenEventsMapByPid(*it));
+            DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->GetFrozenEventsByPid(*it));
     }
     return true;
 }
@@ -113,43 +151,62 @@ bool CommonEventControlManager::PublishAllFreezeCommonEvents()
         return false;
     }
 
-    std::unordered_map<uid_t, FrozenRecords> frozenEventRecords =
-        DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->GetAllFrozenEvents();
-    for (auto record : frozenEventRecords) {
-        PublishFrozenEventsInner(record.second);
+    FrozenProcessRecords frozenEvents =
+        DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->TakeAllFrozenEvents();
+    for (auto &[key, frozenRecords] : frozenEvents) {
+        PublishFrozenEventsInner(std::move(frozenRecords));
     }
+    return true;
+}
 
-    std::unordered_map<pid_t, FrozenRecords> frozenEventRecordsMap =
-        DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->GetAllFrozenEventsMap();
-    for (auto record : frozenEventRecordsMap) {
-        PublishFrozenEventsInner(record.second);
+void CommonEventControlManager::PublishFrozenEventsInner(FrozenRecords frozenRecords)
+{
+    if (frozenRecords.empty()) {
+        return;
     }
-    return true;
+    if (unorderedImmediateQueue_ == nullptr) {
+        EVENT_LOGE(LOG_TAG_FREEZED, "failed to get eventhandler");
+        return;
+    }
+    // one task replays the whole process, the records are moved in rather than copied per event
+    auto batch = std::make_shared<FrozenRecords>(std::move(frozenRecords));
+    std::weak_ptr<CommonEventControlManager> weak = shared_from_this();
+    auto innerCallback = [weak, batch]() {
+        auto control = weak.lock();
+        if (control == nullptr) {
+            EVENT_LOGE(LOG_TAG_FREEZED, "CommonEventControlManager is null");
+            return;
+        }
+        control->NotifyFrozenEventsBatch(*batch);
+    };
+    unorderedImmediateQueue_->submit(innerCallback);
 }
 
-void CommonEventControlManager::PublishFrozenEventsInner(const FrozenRecords &frozenRecords)
+size_t CommonEventControlManager::NotifyFrozenEventsBatch(const FrozenRecords &frozenRecords)
 {
-    for (auto record : frozenRecords) {
-        for (auto vec : record.second) {
-            if (!vec) {
+    std::vector<std::pair<const EventSubscriberRecord *, const CommonEventRecord *>> batch;
+    for (const auto &[subscriberRecord, eventRecords] : frozenRecords) {
+        for (const auto &eventRecord : eventRecords) {
+            if (!eventRecord) {
                 EVENT_LOGW(LOG_TAG_FREEZED, "failed to find record");
                 continue;
             }
+            batch.emplace_back(&subscriberRecord, eventRecord.get());
+        }
+    }
+    // the events of the process are replayed in publish order, each subscriber's own order is kept on ties
+    std::stable_sort(batch.begin(), batch.end(), [](const auto &left, const auto &right) {
+        return left.second->publishTime < right.second->publishTime;
+    });
 
-            EventSubscriberRecord subscriberRecord = record.first;
-            CommonEventRecord eventRecord = *vec;
-            std::weak_ptr<CommonEventControlManager> weak = shared_from_this();
-            auto innerCallback = [weak, subscriberRecord, eventRecord]() {
-                auto control = weak.lock();
-                if (control == nullptr) {
-                    EVENT_LOGE(LOG_TAG_FREEZED, "CommonEventControlManager is null");
-                    return;
-                }
-                control->NotifyFreezeEvents(subscriberRecord, eventRecord);
-            };
-            unorderedImmediateQueue_->submit(innerCallback);
+    size_t notified = 0;
+    for (const auto &[subscriberRecord, eventRecord] : batch) {
+        if (NotifyFreezeEvents(*subscriberRecord, *eventRecord)) {
+            notified++;
         }
     }
+    EVENT_LOGD(LOG_TAG_FREEZED, "replay %{public}zu of %{public}zu frozen events", notified, batch.size());
+    return notified;
 }
 
 bool CommonEventControlManager::NotifyFreezeEvents(
@@ -167,13 +224,102 @@ bool CommonEventControlManager::NotifyFreezeEvents(
         EVENT_LOGE(LOG_TAG_FREEZED, "commonEventData == nullptr");
         return false;
     }
+    CommonEventWireFormat::Scope wireFormat(CommonEventWireFormat::GetClientVersion(
+        subscriberRecord.eventRecordInfo.pid, subscriberRecord.eventRecordInfo.uid));
     commonEventListenerProxy->NotifyEvent(*(eventRecord.commonEventData),
         false, eventRecord.publishInfo->IsSticky());
+    if (subscriberRecord.flowControl != nullptr) {
+        subscriberRecord.flowControl->OnSent(false);
+    }
     AccessTokenHelper::RecordSensitivePermissionUsage(subscriberRecord.eventRecordInfo.callerToken,
         eventRecord.commonEventData->GetWant().GetAction());
     return true;
 }
 
+void CommonEventControlManager::SetFlowControlConfig(const SubscriberFlowControl::Config &config)
+{
+    // a reload may run while events are dispatched, so the config is replaced whole
+    std::atomic_store(&flowControlConfig_, std::make_shared<const SubscriberFlowControl::Config>(config));
+}
+
+void CommonEventControlManager::AckEvents(
+    const std::shared_ptr<EventSubscriberRecord> &subscriberRecord, uint32_t count)
+{
+    if (subscriberRecord == nullptr || subscriberRecord->flowControl == nullptr || !GetUnorderedEventHandler()) {
+        return;
+    }
+    if (!subscriberRecord->flowControl->Acknowledge(*std::atomic_load(&flowControlConfig_), count)) {
+        return;
+    }
+    std::weak_ptr<CommonEventControlManager> weak = shared_from_this();
+    unorderedQueue_->submit([weak, subscriberRecord]() {
+        auto control = weak.lock();
+        if (control == nullptr) {
+            EVENT_LOGE(LOG_TAG_UNORDERED, "CommonEventControlManager is null");
+            return;
+        }
+        control->NotifyDeferredEvents(subscriberRecord);
+    });
+}
+
+void CommonEventControlManager::StartAckTimer(const std::shared_ptr<EventSubscriberRecord> &subscriberRecord)
+{
+    if (!subscriberRecord->flowControl->StartAckTimer() || !GetUnorderedEventHandler()) {
+        return;
+    }
+    uint64_t delay = static_cast<uint64_t>(std::atomic_load(&flowControlConfig_)->ackTimeoutMs) * TIME_UNIT_SIZE;
+    std::weak_ptr<CommonEventControlManager> weak = shared_from_this();
+    std::weak_ptr<EventSubscriberRecord> weakRecord = subscriberRecord;
+    unorderedQueue_->submit([weak, weakRecord]() {
+        auto control = weak.lock();
+        auto record = weakRecord.lock();
+        if (control == nullptr || record == nullptr) {
+            return;
+        }
+        if (record->flowControl->OnAckTimeout(*std::atomic_load(&control->flowControlConfig_))) {
+            EVENT_LOGW(LOG_TAG_UNORDERED, "Ack timeout, credit reclaimed, subId = %{public}s",
+                record->eventRecordInfo.subId.c_str());
+            control->NotifyDeferredEvents(record);
+        } else {
+            control->StartAckTimer(record);
+        }
+    }, ffrt::task_attr().delay(delay));
+}
+
+void CommonEventControlManager::NotifyDeferredEvents(const std::shared_ptr<EventSubscriberRecord> &subscriberRecord)
+{
+    sptr<IEventReceive> commonEventListenerProxy = iface_cast<IEventReceive>(subscriberRecord->commonEventListener);
+    CommonEventWireFormat::Scope wireFormat(CommonEventWireFormat::GetClientVersion(
+        subscriberRecord->eventRecordInfo.pid, subscriberRecord->eventRecordInfo.uid));
+    size_t notified = 0;
+    // the drain only ends once TakeDeferred returns nullptr, so every taken event is sent, stored or released
+    while (auto record = subscriberRecord->flowControl->TakeDeferred(*std::atomic_load(&flowControlConfig_))) {
+        if (!commonEventListenerProxy || record->commonEventData == nullptr || record->publishInfo == nullptr) {
+            subscriberRecord->flowControl->Release();
+            continue;
+        }
+        if (subscriberRecord->isFreeze) {
+            subscriberRecord->flowControl->Release();
+            DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->InsertFrozenEvents(
+                subscriberRecord, *record, IsSupersedingEvent(*record));
+            continue;
+        }
+        if (commonEventListenerProxy->NotifyEvent(*(record->commonEventData), false,
+            record->publishInfo->IsSticky()) != ERR_OK) {
+            subscriberRecord->flowControl->Release();
+            continue;
+        }
+        subscriberRecord->flowControl->OnSent(true);
+        notified++;
+        AccessTokenHelper::RecordSensitivePermissionUsage(subscriberRecord->eventRecordInfo.callerToken,
+            record->commonEventData->GetWant().GetAction());
+    }
+    EVENT_LOGD(LOG_TAG_UNORDERED, "Notify %{public}zu deferred events, subId = %{public}s",
+        notified, subscriberRecord->eventRecordInfo.subId.c_str());
+    // the drain stopped out of credit, the rest waits for acknowledgements or the ack timeout
+    StartAckTimer(subscriberRecord);
+}
+
 bool CommonEventControlManager::GetUnorderedEventHandler()
 {
     if (!unorderedQueue_) {
@@ -225,17 +371,38 @@ bool CommonEventControlManager::NotifySingleUnorderedSubscriber(
         failCnt++;
         return false;
     }
+    if (vec->flowControl != nullptr &&
+        !vec->flowControl->TryAcquire(*std::atomic_load(&flowControlConfig_), *eventRecord)) {
+        eventRecord->deliveryState[index] = OrderedEventRecord::SKIPPED;
+        EVENT_LOGD(LOG_TAG_UNORDERED, "Notify %{public}s deferred, subscriber out of credit, subId = %{public}s",
+            eventRecord->commonEventData->GetWant().GetAction().c_str(), vec->eventRecordInfo.subId.c_str());
+        StartAckTimer(vec);
+        return true;
+    }
     eventRecord->deliveryState[index] = OrderedEventRecord::DELIVERED;
     eventRecord->state.store(OrderedEventRecord::RECEIVING);
+    CommonEventWireFormat::Scope wireFormat(
+        CommonEventWireFormat::GetClientVersion(vec->eventRecordInfo.pid, vec->eventRecordInfo.uid));
+    int64_t notifyTime = SystemTime::GetNowSysTimeUs();
     int32_t result = commonEventListenerProxy->NotifyEvent(*(eventRecord->commonEventData), false,
         eventRecord->publishInfo->IsSticky());
+    int64_t costUs = SystemTime::GetNowSysTimeUs() - notifyTime;
+    DelayedSingleton<EventLatencyMetrics>::GetInstance()->Record(
+        eventRecord->commonEventData->GetWant().GetAction(), EventLatencyMetrics::RECEIVER_IPC, costUs);
+    SetDeliveryCost(*eventRecord, index, costUs);
     if (result != ERR_OK) {
+        if (vec->flowControl != nullptr) {
+            vec->flowControl->Release();
+        }
         eventRecord->state.store(OrderedEventRecord::SKIPPED);
         failCnt++;
         EVENT_LOGE(LOG_TAG_UNORDERED, "Notify %{public}s fail, subId = %{public}s",
             eventRecord->commonEventData->GetWant().GetAction().c_str(), vec->eventRecordInfo.subId.c_str());
         return false;
     }
+    if (vec->flowControl != nullptr) {
+        vec->flowControl->OnSent(true);
+    }
     eventRecord->state.store(OrderedEventRecord::RECEIVED);
     succCnt++;
     AccessTokenHelper::RecordSensitivePermissionUsage(vec->eventRecordInfo.callerToken,
@@ -248,8 +415,8 @@ void CommonEventControlManager::HandleFrozenUnorderedSubscriber(
     size_t index, int32_t &freezeCnt, std::string &freezedPidsLogger)
 {
     eventRecord->deliveryState[index] = OrderedEventRecord::SKIPPED;
-    DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->InsertFrozenEvents(vec, *eventRecord);
-    DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->InsertFrozenEventsMap(vec, *eventRecord);
+    DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->InsertFrozenEvents(
+        vec, *eventRecord, IsSupersedingEvent(*eventRecord));
     if (freezedPidsLogger.empty()) {
         freezedPidsLogger.append(" freezePid[");
     }
@@ -273,41 +440,10 @@ void CommonEventControlManager::LogUnorderedEventResult(std::shared_ptr<OrderedE
 
 bool CommonEventControlManager::CanLogUnorderedEvent(const std::string &event)
 {
-    std::lock_guard<ffrt::mutex> lock(logCacheMutex_);
-    auto now = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now());
-    auto item = unorderedEventLogCache_.begin();
-    bool canPrint = false;
-    bool findEvent = false;
-    while (item != unorderedEventLogCache_.end()) {
-        auto last = (*item)->lastTime_;
-        auto supressed = (*item)->missingCount_;
-        auto duration = now - last;
-        if (duration.count() >= EVENT_LOG_EVENT_LIMIT_INTERVALS) {
-            if (supressed != 0) {
-                EVENT_LOGI(LOG_TAG_UNORDERED, "event %{public}s at %{public}lld log suppressed cnt %{public}u",
-                    (*item)->event_.c_str(), last.time_since_epoch().count(), supressed);
-            }
-            if ((*item)->event_ == event) {
-                findEvent = true;
-                canPrint = true;
-                (*item) = std::make_shared<EventLogCache>(event, now, 0);
-                item++;
-            } else {
-                item = unorderedEventLogCache_.erase(item);
-            }
-            continue;
-        }
-        if ((*item)->event_ != event) {
-            item++;
-            continue;
-        }
-        ((*item)->missingCount_)++;
-        item++;
-        findEvent = true;
-    }
-    if (!findEvent) {
-        unorderedEventLogCache_.emplace_back(std::make_shared<EventLogCache>(event, now, 0));
-        canPrint = true;
+    uint32_t suppressed = 0;
+    bool canPrint = unorderedEventLogLimiter_.CanLog(event, SystemTime::GetNowSysTime(), suppressed);
+    if (suppressed != 0) {
+        EVENT_LOGI(LOG_TAG_UNORDERED, "event %{public}s log suppressed cnt %{public}u", event.c_str(), suppressed);
     }
     return canPrint;
 }
@@ -319,14 +455,15 @@ bool CommonEventControlManager::NotifyUnorderedEvent(std::shared_ptr<OrderedEven
         EVENT_LOGD(LOG_TAG_UNORDERED, "Invalid event record.");
         return false;
     }
-    
+    ClaimUnorderedRecord(eventRecord);
+    DelayedSingleton<EventLatencyMetrics>::GetInstance()->RecordSince(
+        eventRecord->commonEventData->GetWant().GetAction(), EventLatencyMetrics::QUEUE_WAIT, eventRecord->enqueueTime);
+
     NotifyUnorderedEventLocked(eventRecord);
+    DelayedSingleton<EventHistoryRecorder>::GetInstance()->Record(*eventRecord);
 
     std::lock_guard<ffrt::mutex> lock(unorderedMutex_);
-    auto it = std::find(unorderedEventQueue_.begin(), unorderedEventQueue_.end(), eventRecord);
-    if (it != unorderedEventQueue_.end()) {
-        unorderedEventQueue_.erase(it);
-    }
+    unorderedEventQueue_.erase(eventRecord);
     return true;
 }
 
@@ -343,7 +480,7 @@ bool CommonEventControlManager::ProcessUnorderedEvent(
         return ret;
     }
 
-    std::shared_ptr<OrderedEventRecord> eventRecordPtr = std::make_shared<OrderedEventRecord>();
+    std::shared_ptr<OrderedEventRecord> eventRecordPtr = OrderedEventRecordPool::GetInstance().Acquire();
     if (eventRecordPtr == nullptr) {
         EVENT_LOGE(LOG_TAG_UNORDERED, "eventRecordPtr is null");
         return ret;
@@ -352,18 +489,29 @@ bool CommonEventControlManager::ProcessUnorderedEvent(
     std::shared_ptr<CommonEventSubscriberManager> spinstance =
         DelayedSingleton<CommonEventSubscriberManager>::GetInstance();
 
+    std::shared_ptr<EventLatencyMetrics> metrics = DelayedSingleton<EventLatencyMetrics>::GetInstance();
+    std::string action = eventRecord.commonEventData->GetWant().GetAction();
     eventRecordPtr->FillCommonEventRecord(eventRecord);
     if (subscriberRecord) {
         eventRecordPtr->receivers.emplace_back(subscriberRecord);
     } else {
-        eventRecordPtr->receivers = spinstance->GetSubscriberRecords(eventRecord);
+        int64_t matchTime = SystemTime::GetNowSysTimeUs();
+        spinstance->GetSubscriberRecords(eventRecord, eventRecordPtr->receivers);
+        metrics->RecordSince(action, EventLatencyMetrics::MATCH, matchTime);
     }
+    eventRecordPtr->ResetDeliveryState();
 
-    for (auto vec : eventRecordPtr->receivers) {
-        eventRecordPtr->deliveryState.emplace_back(OrderedEventRecord::PENDING);
+    eventRecordPtr->enqueueTime = SystemTime::GetNowSysTimeUs();
+    // replays to a single subscriber are never folded into a broadcast
+    if (!subscriberRecord && CoalesceUnorderedRecord(eventRecordPtr)) {
+        metrics->RecordSince(action, EventLatencyMetrics::ARRIVAL_TO_QUEUE, eventRecord.publishTime);
+        return ret;
     }
-
     EnqueueUnorderedRecord(eventRecordPtr);
+    // sticky replays carry the time of the original publish
+    if (!subscriberRecord) {
+        metrics->RecordSince(action, EventLatencyMetrics::ARRIVAL_TO_QUEUE, eventRecord.publishTime);
+    }
 
     std::weak_ptr<CommonEventControlManager> weak = shared_from_this();
     auto innerCallback = [weak, eventRecordPtr]() {
@@ -423,7 +571,7 @@ bool CommonEventControlManager::ProcessOrderedEvent(
         return ret;
     }
 
-    std::shared_ptr<OrderedEventRecord> eventRecordPtr = std::make_shared<OrderedEventRecord>();
+    std::shared_ptr<OrderedEventRecord> eventRecordPtr = OrderedEventRecordPool::GetInstance().Acquire();
     if (eventRecordPtr == nullptr) {
         EVENT_LOGE(LOG_TAG_ORDERED, "eventRecordPtr is null");
         return ret;
@@ -431,10 +579,15 @@ bool CommonEventControlManager::ProcessOrderedEvent(
 
     std::shared_ptr<CommonEventSubscriberManager> spinstance =
         DelayedSingleton<CommonEventSubscriberManager>::GetInstance();
-    auto subscribers = spinstance->GetSubscriberRecords(eventRecord);
+    std::shared_ptr<EventLatencyMetrics> metrics = DelayedSingleton<EventLatencyMetrics>::GetInstance();
+    std::string action = eventRecord.commonEventData->GetWant().GetAction();
+    int64_t matchTime = SystemTime::GetNowSysTimeUs();
+    std::vector<std::shared_ptr<EventSubscriberRecord>> &subscribers = eventRecordPtr->receivers;
+    spinstance->GetSubscriberRecords(eventRecord, subscribers);
+    metrics->RecordSince(action, EventLatencyMetrics::MATCH, matchTime);
     auto OrderedSubscriberCompareFunc = [] (
-        std::shared_ptr<EventSubscriberRecord> fist,
-        std::shared_ptr<EventSubscriberRecord> second) {
+        const std::shared_ptr<EventSubscriberRecord> &fist,
+        const std::shared_ptr<EventSubscriberRecord> &second) {
         return fist->eventSubscribeInfo->GetPriority() > second->eventSubscribeInfo->GetPriority();
     };
     std::sort(subscribers.begin(), subscribers.end(), OrderedSubscriberCompareFunc);
@@ -442,12 +595,11 @@ bool CommonEventControlManager::ProcessOrderedEvent(
     eventRecordPtr->resultTo = commonEventListener;
     eventRecordPtr->state.store(OrderedEventRecord::IDLE);
     eventRecordPtr->nextReceiver = 0;
-    eventRecordPtr->receivers = subscribers;
-    for (auto vec : eventRecordPtr->receivers) {
-        eventRecordPtr->deliveryState.emplace_back(OrderedEventRecord::PENDING);
-    }
+    eventRecordPtr->ResetDeliveryState();
 
+    eventRecordPtr->enqueueTime = SystemTime::GetNowSysTimeUs();
     EnqueueOrderedRecord(eventRecordPtr);
+    metrics->RecordSince(action, EventLatencyMetrics::ARRIVAL_TO_QUEUE, eventRecord.publishTime);
 
     ret = ScheduleOrderedCommonEvent();
 
@@ -468,6 +620,62 @@ bool CommonEventControlManager::EnqueueUnorderedRecord(const std::shared_ptr<Ord
     return true;
 }
 
+void CommonEventControlManager::SetCoalescingEvents(const std::unordered_set<std::string> &events)
+{
+    std::lock_guard<ffrt::mutex> lock(unorderedMutex_);
+    coalescingEvents_ = events;
+}
+
+bool CommonEventControlManager::IsSupersedingEvent(const CommonEventRecord &eventRecord)
+{
+    if (eventRecord.commonEventData == nullptr) {
+        return false;
+    }
+    // a sticky event is a state, a coalescing event is declared by policy to carry only the latest value
+    if (eventRecord.publishInfo != nullptr && eventRecord.publishInfo->IsSticky()) {
+        return true;
+    }
+    std::lock_guard<ffrt::mutex> lock(unorderedMutex_);
+    return coalescingEvents_.find(eventRecord.commonEventData->GetWant().GetAction()) != coalescingEvents_.end();
+}
+
+bool CommonEventControlManager::CoalesceUnorderedRecord(const std::shared_ptr<OrderedEventRecord> &eventRecordPtr)
+{
+    std::lock_guard<ffrt::mutex> lock(unorderedMutex_);
+    if (coalescingEvents_.empty() ||
+        coalescingEvents_.find(eventRecordPtr->commonEventData->GetWant().GetAction()) == coalescingEvents_.end()) {
+        return false;
+    }
+    auto result = pendingCoalescedRecords_.emplace(GetCoalescingKey(*eventRecordPtr), eventRecordPtr);
+    if (result.second) {
+        return false;
+    }
+
+    // the pending record has not been claimed for dispatch, so it can take the newest payload in place
+    std::shared_ptr<OrderedEventRecord> &pending = result.first->second;
+    EVENT_LOGD(LOG_TAG_UNORDERED, "Coalesce %{public}s from pid %{public}d into pending pid %{public}d",
+        eventRecordPtr->commonEventData->GetWant().GetAction().c_str(), eventRecordPtr->eventRecordInfo.pid,
+        pending->eventRecordInfo.pid);
+    pending->FillCommonEventRecord(*eventRecordPtr);
+    // swapped, the folded record takes the old arrays back to the pool
+    pending->receivers.swap(eventRecordPtr->receivers);
+    pending->deliveryState.swap(eventRecordPtr->deliveryState);
+    pending->deliveryCost.swap(eventRecordPtr->deliveryCost);
+    return true;
+}
+
+void CommonEventControlManager::ClaimUnorderedRecord(const std::shared_ptr<OrderedEventRecord> &eventRecordPtr)
+{
+    std::lock_guard<ffrt::mutex> lock(unorderedMutex_);
+    if (pendingCoalescedRecords_.empty()) {
+        return;
+    }
+    auto it = pendingCoalescedRecords_.find(GetCoalescingKey(*eventRecordPtr));
+    if (it != pendingCoalescedRecords_.end() && it->second == eventRecordPtr) {
+        pendingCoalescedRecords_.erase(it);
+    }
+}
+
 bool CommonEventControlManager::EnqueueOrderedRecord(const std::shared_ptr<OrderedEventRecord> &eventRecordPtr)
 {
     if (eventRecordPtr == nullptr) {
@@ -518,6 +726,10 @@ bool CommonEventControlManager::NotifyOrderedEvent(std::shared_ptr<OrderedEventR
         return false;
     }
 
+    if (eventRecordPtr->deliveryState[index] == OrderedEventRecord::SKIPPED) {
+        // the receiver died while the event was queued
+        return true;
+    }
     if (eventRecordPtr->receivers[index]->isFreeze) {
         return NotifyFrozenSubscriber(eventRecordPtr, index);
     }
@@ -525,8 +737,18 @@ bool CommonEventControlManager::NotifyOrderedEvent(std::shared_ptr<OrderedEventR
     if (!PrepareOrderedNotify(eventRecordPtr, index, receiver)) {
         return false;
     }
+    const EventRecordInfo &receiverInfo = eventRecordPtr->receivers[index]->eventRecordInfo;
+    CommonEventWireFormat::Scope wireFormat(
+        CommonEventWireFormat::GetClientVersion(receiverInfo.pid, receiverInfo.uid));
+    int64_t notifyTime = SystemTime::GetNowSysTimeUs();
     int32_t result = receiver->NotifyEvent(*(eventRecordPtr->commonEventData), true,
         eventRecordPtr->publishInfo->IsSticky());
+    DelayedSingleton<EventLatencyMetrics>::GetInstance()->RecordSince(
+        eventRecordPtr->commonEventData->GetWant().GetAction(), EventLatencyMetrics::RECEIVER_IPC, notifyTime);
+    auto &flowControl = eventRecordPtr->receivers[index]->flowControl;
+    if (flowControl != nullptr && result == ERR_OK) {
+        flowControl->OnSent(false);
+    }
     if (!HandleOrderedNotifyResult(eventRecordPtr, index, result)) {
         return false;
     }
@@ -539,9 +761,7 @@ bool CommonEventControlManager::NotifyFrozenSubscriber(
 {
     EVENT_LOGD(LOG_TAG_ORDERED, "vec isFreeze: %{public}d", eventRecordPtr->receivers[index]->isFreeze);
     DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->InsertFrozenEvents(
-        eventRecordPtr->receivers[index], *eventRecordPtr);
-    DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->InsertFrozenEventsMap(
-        eventRecordPtr->receivers[index], *eventRecordPtr);
+        eventRecordPtr->receivers[index], *eventRecordPtr, IsSupersedingEvent(*eventRecordPtr));
     {
         std::lock_guard<ffrt::mutex> lock(eventRecordPtr->recordMutex_);
         eventRecordPtr->deliveryState[index] = OrderedEventRecord::SKIPPED;
@@ -607,6 +827,7 @@ void CommonEventControlManager::ProcessNextOrderedEvent(bool isSendMsg)
         sp = ProcessOrderedEventQueueLocked(removedRecords);
     }
     for (auto &removed : removedRecords) {
+        DelayedSingleton<EventHistoryRecorder>::GetInstance()->Record(*removed);
         HandleFinalSubscriber(removed);
     }
     if (sp == nullptr) {
@@ -646,6 +867,11 @@ std::shared_ptr<OrderedEventRecord> CommonEventControlManager::ProcessOrderedEve
                 "%{public}zu)", sp->eventRecordInfo.pid, sp->commonEventData->GetWant().GetAction().c_str(),
                 sp->userId, numReceivers, sp->nextReceiver);
             CancelTimeout();
+            if (sp->dispatchTime > 0) {
+                DelayedSingleton<EventLatencyMetrics>::GetInstance()->Record(
+                    sp->commonEventData->GetWant().GetAction(), EventLatencyMetrics::ORDERED_FINISH,
+                    (SystemTime::GetNowSysTime() - sp->dispatchTime) * TIME_UNIT_SIZE);
+            }
             orderedEventQueue_.erase(orderedEventQueue_.begin());
             removedRecords.emplace_back(sp);
             sp = nullptr;
@@ -685,6 +911,8 @@ bool CommonEventControlManager::HandleFinalSubscriber(std::shared_ptr<OrderedEve
         EVENT_LOGE(LOG_TAG_ORDERED, "Failed to get IEventReceive proxy");
         return false;
     }
+    CommonEventWireFormat::Scope wireFormat(
+        CommonEventWireFormat::GetClientVersion(sp->eventRecordInfo.pid, sp->eventRecordInfo.uid));
     int32_t result = receiver->NotifyEvent(*(sp->commonEventData), true, sp->publishInfo->IsSticky());
     if (result != ERR_OK) {
         EVENT_LOGE(LOG_TAG_ORDERED, "Notify %{public}s fail to final receiver",
@@ -703,6 +931,8 @@ size_t CommonEventControlManager::PrepareNextReceiverRecord(std::shared_ptr<Orde
         sp->receiverTime = SystemTime::GetNowSysTime();
         if (recIdx == 0) {
             sp->dispatchTime = sp->receiverTime;
+            DelayedSingleton<EventLatencyMetrics>::GetInstance()->RecordSince(
+                sp->commonEventData->GetWant().GetAction(), EventLatencyMetrics::QUEUE_WAIT, sp->enqueueTime);
         }
     }
     return recIdx;
@@ -782,14 +1012,15 @@ bool CommonEventControlManager::CheckAndRescheduleTimeout(
 void CommonEventControlManager::HandleTimeoutReceiver(std::shared_ptr<OrderedEventRecord> &sp, int64_t nowSysTime)
 {
     std::lock_guard<ffrt::mutex> recordLock(sp->recordMutex_);
-    sp->receiverTime = nowSysTime;
     if (sp->nextReceiver > 0) {
         std::shared_ptr<EventSubscriberRecord> subscriberRecord = sp->receivers[sp->nextReceiver - 1];
         EVENT_LOGW(LOG_TAG_ORDERED, "Timeout: When %{public}s process %{public}s",
             subscriberRecord->eventRecordInfo.subId.c_str(), sp->commonEventData->GetWant().GetAction().c_str());
         SendOrderedEventProcTimeoutHiSysEvent(subscriberRecord, sp->commonEventData->GetWant().GetAction());
         sp->deliveryState[sp->nextReceiver - 1] = OrderedEventRecord::TIMEOUT;
+        SetDeliveryCost(*sp, sp->nextReceiver - 1, (nowSysTime - sp->receiverTime) * TIME_UNIT_SIZE);
     }
+    sp->receiverTime = nowSysTime;
     int32_t code = sp->commonEventData->GetCode();
     const std::string &strRef = sp->commonEventData->GetData();
     bool abort = sp->resultAbort;
@@ -812,6 +1043,10 @@ bool CommonEventControlManager::FinishReceiver(std::shared_ptr<OrderedEventRecor
     int8_t state = recordPtr->state.load();
     {
         std::lock_guard<ffrt::mutex> lock(recordPtr->recordMutex_);
+        if (recordPtr->curReceiver != nullptr && recordPtr->nextReceiver > 0) {
+            SetDeliveryCost(*recordPtr, recordPtr->nextReceiver - 1,
+                (SystemTime::GetNowSysTime() - recordPtr->receiverTime) * TIME_UNIT_SIZE);
+        }
         recordPtr->state.store(OrderedEventRecord::IDLE);
         recordPtr->curReceiver = nullptr;
         recordPtr->commonEventData->SetCode(code);
@@ -821,6 +1056,34 @@ bool CommonEventControlManager::FinishReceiver(std::shared_ptr<OrderedEventRecor
     return state == OrderedEventRecord::RECEIVED;
 }
 
+void CommonEventControlManager::RemoveProcessReceivers(pid_t pid)
+{
+    EVENT_LOGD(LOG_TAG_ORDERED, "enter");
+
+    std::shared_ptr<OrderedEventRecord> waiting = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(orderedMutex_);
+        for (const auto &record : orderedEventQueue_) {
+            std::lock_guard<ffrt::mutex> recordLock(record->recordMutex_);
+            for (size_t index = record->nextReceiver; index < record->receivers.size(); ++index) {
+                if (record->receivers[index]->eventRecordInfo.pid == pid) {
+                    record->deliveryState[index] = OrderedEventRecord::SKIPPED;
+                }
+            }
+            if (waiting == nullptr && record->curReceiver != nullptr && record->nextReceiver > 0 &&
+                record->receivers[record->nextReceiver - 1]->eventRecordInfo.pid == pid) {
+                waiting = record;
+            }
+        }
+    }
+    if (waiting != nullptr) {
+        EVENT_LOGI(LOG_TAG_ORDERED, "Pid %{public}d died while processing %{public}s", pid,
+            waiting->commonEventData->GetWant().GetAction().c_str());
+        FinishReceiverAction(waiting, waiting->commonEventData->GetCode(), waiting->commonEventData->GetData(),
+            waiting->resultAbort);
+    }
+}
+
 bool CommonEventControlManager::FinishReceiverAction(std::shared_ptr<OrderedEventRecord> recordPtr, const int32_t &code,
     const std::string &receiverData, const bool &abortEvent)
 {
@@ -854,7 +1117,7 @@ void CommonEventControlManager::GetUnorderedEventRecords(
     EVENT_LOGD(LOG_TAG_CES, "enter");
     std::lock_guard<ffrt::mutex> unorderedLock(unorderedMutex_);
     if (event.empty() && userId == ALL_USER) {
-        records = unorderedEventQueue_;
+        records.assign(unorderedEventQueue_.begin(), unorderedEventQueue_.end());
     } else if (event.empty()) {
         for (auto vec : unorderedEventQueue_) {
             if (vec->userId == userId) {
@@ -1097,6 +1360,29 @@ void CommonEventControlManager::DumpState(
         state.emplace_back(stateInfo);
     }
 }
+
+void CommonEventControlManager::DumpStructured(const std::string &event, const int32_t &userId,
+    nlohmann::json &root)
+{
+    EVENT_LOGD(LOG_TAG_CES, "enter");
+    std::vector<std::shared_ptr<OrderedEventRecord>> unorderedRecords;
+    std::vector<std::shared_ptr<OrderedEventRecord>> orderedRecords;
+    GetUnorderedEventRecords(event, userId, unorderedRecords);
+    GetOrderedEventRecords(event, userId, orderedRecords);
+
+    nlohmann::json unordered = nlohmann::json::array();
+    for (const auto &record : unorderedRecords) {
+        unordered.push_back(StructuredDump::FromOrderedEventRecord(*record));
+    }
+    nlohmann::json ordered = nlohmann::json::array();
+    for (const auto &record : orderedRecords) {
+        ordered.push_back(StructuredDump::FromOrderedEventRecord(*record));
+    }
+    root["pending"] = {
+        { "unordered", std::move(unordered) },
+        { "ordered", std::move(ordered) },
+    };
+}
 #endif
 void CommonEventControlManager::SendOrderedEventProcTimeoutHiSysEvent(
     const std::shared_ptr<EventSubscriberRecord> &subscriberRecord, const std::string &eventName)
@@ -20,6 +20,7 @@
 #include "accesstoken_kit.h"
 #include "bundle_manager_helper.h"
 #include "common_event_constant.h"
+#include "common_event_wire_format.h"
 #include "datetime_ex.h"
 #include "event_log_wrapper.h"
 #include "event_trace_wrapper.h"
@@ -188,6 +189,7 @@ int32_t CommonEventManagerService::PublishCommonEventDetailed(const CommonEventD
         return ERR_NOTIFICATION_CES_EVENT_FREQ_TOO_HIGH;
     }
 
+    int64_t publishTime = SystemTime::GetNowSysTimeUs();
     std::weak_ptr<InnerCommonEventManager> wp = innerCommonEventManager_;
     wptr<CommonEventManagerService> weakThis = this;
     std::function<void()> publishCommonEventFunc = [wp,
@@ -199,6 +201,7 @@ int32_t CommonEventManagerService::PublishCommonEventDetailed(const CommonEventD
         uid,
         clientToken,
         userId,
+        publishTime,
         weakThis] () {
         std::shared_ptr<InnerCommonEventManager> innerCommonEventManager = wp.lock();
         if (innerCommonEventManager == nullptr) {
@@ -223,7 +226,8 @@ int32_t CommonEventManagerService::PublishCommonEventDetailed(const CommonEventD
             clientToken,
             userId,
             bundleName,
-            commonEventManagerService);
+            commonEventManagerService,
+            publishTime);
         if (!ret) {
             EVENT_LOGE(LOG_TAG_CES, "failed to publish event %{public}s", event.GetWant().GetAction().c_str());
         }
@@ -561,11 +565,11 @@ int CommonEventManagerService::Dump(int fd, const std::vector<std::u16string> &a
         EVENT_LOGE(LOG_TAG_CES, "CommonEventManagerService not ready");
         return ERR_INVALID_VALUE;
     }
-    std::string result;
-    innerCommonEventManager_->HiDump(args, result);
-    int ret = dprintf(fd, "%s\n", result.c_str());
-    if (ret < 0) {
-        EVENT_LOGE(LOG_TAG_CES, "dprintf error");
+    DumpWriter writer(fd);
+    innerCommonEventManager_->HiDump(args, writer);
+    writer.Append("\n");
+    if (!writer.Flush()) {
+        EVENT_LOGE(LOG_TAG_CES, "write dump error");
         return ERR_INVALID_VALUE;
     }
     return ERR_OK;
@@ -655,6 +659,36 @@ ErrCode CommonEventManagerService::SetFreezeStatus(const std::set<int32_t>& pidL
     return ERR_OK;
 }
 
+ErrCode CommonEventManagerService::NegotiateWireFormat(int32_t version, int32_t& funcResult)
+{
+    funcResult = CommonEventWireFormat::SetClientVersion(
+        IPCSkeleton::GetCallingPid(), IPCSkeleton::GetCallingUid(), version);
+    EVENT_LOGD(LOG_TAG_CES, "pid %{public}d wire format %{public}d", IPCSkeleton::GetCallingPid(), funcResult);
+    return ERR_OK;
+}
+
+ErrCode CommonEventManagerService::AckEvents(const sptr<IRemoteObject>& commonEventListener, uint32_t count)
+{
+    if (!IsReady()) {
+        EVENT_LOGE(LOG_TAG_CES, "CommonEventManagerService not ready");
+        return ERR_OK;
+    }
+
+    pid_t callingPid = IPCSkeleton::GetCallingPid();
+    std::weak_ptr<InnerCommonEventManager> wp = innerCommonEventManager_;
+    std::function<void()> ackEventsFunc = [wp, commonEventListener, count, callingPid] () {
+        std::shared_ptr<InnerCommonEventManager> innerCommonEventManager = wp.lock();
+        if (innerCommonEventManager == nullptr) {
+            EVENT_LOGE(LOG_TAG_CES, "innerCommonEventManager not exist");
+            return;
+        }
+        innerCommonEventManager->AckEvents(commonEventListener, count, callingPid);
+    };
+
+    commonEventSrvQueue_->submit(ackEventsFunc);
+    return ERR_OK;
+}
+
 int32_t CommonEventManagerService::CheckUserIdParams(const int32_t &userId)
 {
     if (userId != ALL_USER && userId != CURRENT_USER && userId != UNDEFINED_USER
@@ -16,6 +16,7 @@
 #include "common_event_permission_manager.h"
 
 #include <algorithm>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -28,195 +29,203 @@ namespace OHOS {
 namespace EventFwk {
 constexpr size_t REVERSE = 3;
 
-static const std::unordered_map<std::string, std::pair<PermissionState, std::vector<std::string>>> COMMON_EVENT_MAP {
-    {CommonEventSupport::COMMON_EVENT_BOOT_COMPLETED,
-        {PermissionState::DEFAULT, {"ohos.permission.RECEIVER_STARTUP_COMPLETED"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_LOCKED_BOOT_COMPLETED,
-        {PermissionState::DEFAULT, {"ohos.permission.RECEIVER_STARTUP_COMPLETED"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_USER_SWITCHED,
-        {PermissionState::OR,
-            {"ohos.permission.MANAGE_LOCAL_ACCOUNTS", "ohos.permission.INTERACT_ACROSS_LOCAL_ACCOUNTS"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_USER_STARTING,
-        {PermissionState::DEFAULT, {"ohos.permission.INTERACT_ACROSS_LOCAL_ACCOUNTS"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_USER_STOPPING,
-        {PermissionState::DEFAULT, {"ohos.permission.INTERACT_ACROSS_LOCAL_ACCOUNTS"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_WIFI_SCAN_FINISHED,
-        {PermissionState::DEFAULT, {"ohos.permission.LOCATION"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_WIFI_RSSI_VALUE,
-        {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_WIFI_AP_STA_JOIN,
-        {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_WIFI_AP_STA_LEAVE,
-        {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_WIFI_MPLINK_STATE_CHANGE,
-        {PermissionState::DEFAULT, {"ohos.permission.MPLINK_CHANGE_STATE"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_WIFI_P2P_CONN_STATE,
-        {PermissionState::AND, {"ohos.permission.GET_WIFI_INFO", "ohos.permission.LOCATION"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_WIFI_P2P_STATE_CHANGED,
-        {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_WIFI_P2P_PEERS_STATE_CHANGED,
-        {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_WIFI_P2P_PEERS_DISCOVERY_STATE_CHANGED,
-        {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_WIFI_P2P_CURRENT_DEVICE_STATE_CHANGED,
-        {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_WIFI_P2P_GROUP_STATE_CHANGED,
-        {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_NFC_ACTION_RF_FIELD_ON_DETECTED,
-        {PermissionState::DEFAULT, {"ohos.permission.MANAGE_SECURE_SETTINGS"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_NFC_ACTION_RF_FIELD_OFF_DETECTED,
-        {PermissionState::DEFAULT, {"ohos.permission.MANAGE_SECURE_SETTINGS"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_USER_ADDED,
-        {PermissionState::DEFAULT, {"ohos.permission.MANAGE_LOCAL_ACCOUNTS"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_USER_REMOVED,
-        {PermissionState::DEFAULT, {"ohos.permission.MANAGE_LOCAL_ACCOUNTS"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_ABILITY_ADDED,
-        {PermissionState::DEFAULT, {"ohos.permission.LISTEN_BUNDLE_CHANGE"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_ABILITY_REMOVED,
-        {PermissionState::DEFAULT, {"ohos.permission.LISTEN_BUNDLE_CHANGE"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_ABILITY_UPDATED,
-        {PermissionState::DEFAULT, {"ohos.permission.LISTEN_BUNDLE_CHANGE"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_DISK_REMOVED,
-        {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_DISK_UNMOUNTED,
-        {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_DISK_MOUNTED,
-        {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_DISK_BAD_REMOVAL,
-        {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_DISK_UNMOUNTABLE,
-        {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_DISK_VOLUME_STATE_CHANGE,
-        {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_DISK_EJECT,
-        {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_VOLUME_REMOVED,
-        {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_VOLUME_UNMOUNTED,
-        {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_VOLUME_MOUNTED,
-        {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_VOLUME_BAD_REMOVAL,
-        {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_VOLUME_EJECT,
-        {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_VISIBLE_ACCOUNTS_UPDATED,
-            {PermissionState::DEFAULT, {"ohos.permission.GET_APP_ACCOUNTS"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_ACCOUNT_DELETED,
-        {PermissionState::DEFAULT, {"ohos.permission.INTERACT_ACROSS_LOCAL_ACCOUNTS"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_FOUNDATION_READY,
-        {PermissionState::DEFAULT, {"ohos.permission.RECEIVER_STARTUP_COMPLETED"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_SLOT_CHANGE,
-        {PermissionState::DEFAULT, {"ohos.permission.NOTIFICATION_CONTROLLER"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_SMS_RECEIVE_COMPLETED,
-        {PermissionState::DEFAULT, {"ohos.permission.RECEIVE_SMS"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_BUNDLE_RESOURCES_CHANGED,
-        {PermissionState::DEFAULT, {"ohos.permission.GET_BUNDLE_RESOURCES"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_VPN_CONNECTION_STATUS_CHANGED,
-        {PermissionState::DEFAULT, {"ohos.permission.GET_NETWORK_INFO"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_RESTORE_START,
-        {PermissionState::DEFAULT, {"ohos.permission.START_RESTORE_NOTIFICATION"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_RESTORE_END,
-        {PermissionState::DEFAULT, {"ohos.permission.RESTORE_END_NOTIFICATION"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_DEFAULT_APPLICATION_CHANGED,
-        {PermissionState::DEFAULT, {"ohos.permission.CHANGE_DEFAULT_APPLICATION"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_SHORTCUT_CHANGED,
-        {PermissionState::DEFAULT, {"ohos.permission.MANAGE_SHORTCUTS"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_TRUSTED_RING_CHECKIN,
-        {PermissionState::DEFAULT, {"ohos.permission.USE_TRUSTED_RING"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_TRUSTED_RING_CHECKOUT,
-        {PermissionState::DEFAULT, {"ohos.permission.USE_TRUSTED_RING"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_TRUSTED_RING_RESET,
-        {PermissionState::DEFAULT, {"ohos.permission.USE_TRUSTED_RING"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_CLOUD_DISK_STATE_CHANGED,
-        {PermissionState::DEFAULT, {"ohos.permission.ACCESS_CLOUD_DISK_INFO"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_VOLUME_ENCRYPTION_POLICY_SET,
-        {PermissionState::DEFAULT, {"ohos.permission.QUERY_VOLUME_ENCRYPTION_STATUS"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_CALL_STATE_CHANGED,
-        {PermissionState::DEFAULT, {"ohos.permission.GET_TELEPHONY_STATE"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_INCOMING_CALL_MISSED,
-        {PermissionState::DEFAULT, {"ohos.permission.GET_TELEPHONY_STATE"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_BLUETOOTH_HOST_SCAN_MODE_CHANGE,
-        {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_BLUETOOTH_HANDSFREE_AG_CONNECT_STATE_CHANGE,
-        {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CONNECT_STATE_CHANGE,
-        {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_BLUETOOTH_A2DPSOURCE_AVRCP_CONNECT_STATE_CHANGE,
-        {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CODEC_VALUE_CHANGE,
-        {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_BLUETOOTH_A2DPSOURCE_PLAY_STATE_CHANGE,
-        {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_BLUETOOTH_SCO_CONNECT_STATE_CHANGE,
-        {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_ACL_STATE_CHANGE,
-        {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
-    },
-    {CommonEventSupport::COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_PAIR_STATE_CHANGE,
-        {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
-    },
-};
+using CommonEventPermissionMap =
+    std::unordered_map<std::string, std::pair<PermissionState, std::vector<std::string>>>;
+
+static const CommonEventPermissionMap &GetCommonEventMap()
+{
+    // constructed on the first permission check instead of when the service library is loaded
+    static const CommonEventPermissionMap commonEventMap {
+        {CommonEventSupport::COMMON_EVENT_BOOT_COMPLETED,
+            {PermissionState::DEFAULT, {"ohos.permission.RECEIVER_STARTUP_COMPLETED"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_LOCKED_BOOT_COMPLETED,
+            {PermissionState::DEFAULT, {"ohos.permission.RECEIVER_STARTUP_COMPLETED"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_USER_SWITCHED,
+            {PermissionState::OR,
+                {"ohos.permission.MANAGE_LOCAL_ACCOUNTS", "ohos.permission.INTERACT_ACROSS_LOCAL_ACCOUNTS"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_USER_STARTING,
+            {PermissionState::DEFAULT, {"ohos.permission.INTERACT_ACROSS_LOCAL_ACCOUNTS"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_USER_STOPPING,
+            {PermissionState::DEFAULT, {"ohos.permission.INTERACT_ACROSS_LOCAL_ACCOUNTS"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_WIFI_SCAN_FINISHED,
+            {PermissionState::DEFAULT, {"ohos.permission.LOCATION"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_WIFI_RSSI_VALUE,
+            {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_WIFI_AP_STA_JOIN,
+            {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_WIFI_AP_STA_LEAVE,
+            {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_WIFI_MPLINK_STATE_CHANGE,
+            {PermissionState::DEFAULT, {"ohos.permission.MPLINK_CHANGE_STATE"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_WIFI_P2P_CONN_STATE,
+            {PermissionState::AND, {"ohos.permission.GET_WIFI_INFO", "ohos.permission.LOCATION"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_WIFI_P2P_STATE_CHANGED,
+            {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_WIFI_P2P_PEERS_STATE_CHANGED,
+            {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_WIFI_P2P_PEERS_DISCOVERY_STATE_CHANGED,
+            {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_WIFI_P2P_CURRENT_DEVICE_STATE_CHANGED,
+            {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_WIFI_P2P_GROUP_STATE_CHANGED,
+            {PermissionState::DEFAULT, {"ohos.permission.GET_WIFI_INFO"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_NFC_ACTION_RF_FIELD_ON_DETECTED,
+            {PermissionState::DEFAULT, {"ohos.permission.MANAGE_SECURE_SETTINGS"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_NFC_ACTION_RF_FIELD_OFF_DETECTED,
+            {PermissionState::DEFAULT, {"ohos.permission.MANAGE_SECURE_SETTINGS"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_USER_ADDED,
+            {PermissionState::DEFAULT, {"ohos.permission.MANAGE_LOCAL_ACCOUNTS"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_USER_REMOVED,
+            {PermissionState::DEFAULT, {"ohos.permission.MANAGE_LOCAL_ACCOUNTS"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_ABILITY_ADDED,
+            {PermissionState::DEFAULT, {"ohos.permission.LISTEN_BUNDLE_CHANGE"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_ABILITY_REMOVED,
+            {PermissionState::DEFAULT, {"ohos.permission.LISTEN_BUNDLE_CHANGE"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_ABILITY_UPDATED,
+            {PermissionState::DEFAULT, {"ohos.permission.LISTEN_BUNDLE_CHANGE"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_DISK_REMOVED,
+            {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_DISK_UNMOUNTED,
+            {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_DISK_MOUNTED,
+            {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_DISK_BAD_REMOVAL,
+            {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_DISK_UNMOUNTABLE,
+            {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_DISK_VOLUME_STATE_CHANGE,
+            {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_DISK_EJECT,
+            {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_VOLUME_REMOVED,
+            {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_VOLUME_UNMOUNTED,
+            {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_VOLUME_MOUNTED,
+            {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_VOLUME_BAD_REMOVAL,
+            {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_VOLUME_EJECT,
+            {PermissionState::DEFAULT, {"ohos.permission.STORAGE_MANAGER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_VISIBLE_ACCOUNTS_UPDATED,
+                {PermissionState::DEFAULT, {"ohos.permission.GET_APP_ACCOUNTS"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_ACCOUNT_DELETED,
+            {PermissionState::DEFAULT, {"ohos.permission.INTERACT_ACROSS_LOCAL_ACCOUNTS"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_FOUNDATION_READY,
+            {PermissionState::DEFAULT, {"ohos.permission.RECEIVER_STARTUP_COMPLETED"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_SLOT_CHANGE,
+            {PermissionState::DEFAULT, {"ohos.permission.NOTIFICATION_CONTROLLER"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_SMS_RECEIVE_COMPLETED,
+            {PermissionState::DEFAULT, {"ohos.permission.RECEIVE_SMS"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_BUNDLE_RESOURCES_CHANGED,
+            {PermissionState::DEFAULT, {"ohos.permission.GET_BUNDLE_RESOURCES"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_VPN_CONNECTION_STATUS_CHANGED,
+            {PermissionState::DEFAULT, {"ohos.permission.GET_NETWORK_INFO"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_RESTORE_START,
+            {PermissionState::DEFAULT, {"ohos.permission.START_RESTORE_NOTIFICATION"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_RESTORE_END,
+            {PermissionState::DEFAULT, {"ohos.permission.RESTORE_END_NOTIFICATION"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_DEFAULT_APPLICATION_CHANGED,
+            {PermissionState::DEFAULT, {"ohos.permission.CHANGE_DEFAULT_APPLICATION"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_SHORTCUT_CHANGED,
+            {PermissionState::DEFAULT, {"ohos.permission.MANAGE_SHORTCUTS"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_TRUSTED_RING_CHECKIN,
+            {PermissionState::DEFAULT, {"ohos.permission.USE_TRUSTED_RING"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_TRUSTED_RING_CHECKOUT,
+            {PermissionState::DEFAULT, {"ohos.permission.USE_TRUSTED_RING"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_TRUSTED_RING_RESET,
+            {PermissionState::DEFAULT, {"ohos.permission.USE_TRUSTED_RING"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_CLOUD_DISK_STATE_CHANGED,
+            {PermissionState::DEFAULT, {"ohos.permission.ACCESS_CLOUD_DISK_INFO"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_VOLUME_ENCRYPTION_POLICY_SET,
+            {PermissionState::DEFAULT, {"ohos.permission.QUERY_VOLUME_ENCRYPTION_STATUS"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_CALL_STATE_CHANGED,
+            {PermissionState::DEFAULT, {"ohos.permission.GET_TELEPHONY_STATE"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_INCOMING_CALL_MISSED,
+            {PermissionState::DEFAULT, {"ohos.permission.GET_TELEPHONY_STATE"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_BLUETOOTH_HOST_SCAN_MODE_CHANGE,
+            {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_BLUETOOTH_HANDSFREE_AG_CONNECT_STATE_CHANGE,
+            {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CONNECT_STATE_CHANGE,
+            {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_BLUETOOTH_A2DPSOURCE_AVRCP_CONNECT_STATE_CHANGE,
+            {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_BLUETOOTH_A2DPSOURCE_CODEC_VALUE_CHANGE,
+            {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_BLUETOOTH_A2DPSOURCE_PLAY_STATE_CHANGE,
+            {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_BLUETOOTH_SCO_CONNECT_STATE_CHANGE,
+            {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_ACL_STATE_CHANGE,
+            {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
+        },
+        {CommonEventSupport::COMMON_EVENT_BLUETOOTH_REMOTEDEVICE_PAIR_STATE_CHANGE,
+            {PermissionState::DEFAULT, {"ohos.permission.ACCESS_BLUETOOTH"}}
+        },
+    };
+    return commonEventMap;
+}
 
 static const std::unordered_set<std::string> SYSTEM_API_COMMON_EVENTS {
     CommonEventSupport::COMMON_EVENT_DOMAIN_ACCOUNT_STATUS_CHANGED,
@@ -257,9 +266,7 @@ static const std::vector<std::string> SENSITIVE_COMMON_EVENTS {
 };
 
 CommonEventPermissionManager::CommonEventPermissionManager()
-{
-    Init();
-}
+{}
 
 void CommonEventPermissionManager::Init()
 {
@@ -267,7 +274,7 @@ void CommonEventPermissionManager::Init()
     Permission per;
     per.names.reserve(REVERSE);
 
-    for (auto &[eventName, permissions] : COMMON_EVENT_MAP) {
+    for (auto &[eventName, permissions] : GetCommonEventMap()) {
         per.state = permissions.first;
         for (auto &permissionName : permissions.second) {
             per.names.emplace_back(permissionName);
@@ -283,6 +290,7 @@ void CommonEventPermissionManager::Init()
 Permission __attribute__((weak)) CommonEventPermissionManager::GetEventPermission(const std::string &event)
 {
     EVENT_LOGD(LOG_TAG_CES, "enter");
+    std::call_once(initFlag_, [this]() { Init(); });
     if (eventMap_.find(event) != eventMap_.end()) {
         return eventMap_.find(event)->second;
     }
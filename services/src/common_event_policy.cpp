@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common_event_policy.h"
+
+#include "event_log_wrapper.h"
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+constexpr const char *JSON_KEY_PUBLISH_CONTROL = "publishControl";
+constexpr const char *JSON_KEY_EVENT_NAME = "eventName";
+constexpr const char *JSON_KEY_UID_LIST = "uidList";
+constexpr const char *JSON_KEY_COALESCING_EVENTS = "coalescingEvents";
+constexpr const char *JSON_KEY_BACKPRESSURE = "backpressure";
+constexpr const char *JSON_KEY_MAX_IN_FLIGHT = "maxInFlight";
+constexpr const char *JSON_KEY_MAX_BACKLOG = "maxBacklog";
+constexpr const char *JSON_KEY_ACK_TIMEOUT = "ackTimeoutMs";
+constexpr const char *JSON_KEY_POLICY = "policy";
+}
+
+std::shared_ptr<const CommonEventPolicy> CommonEventPolicy::Compile(const std::vector<nlohmann::json> &configs)
+{
+    auto policy = std::make_shared<CommonEventPolicy>();
+    const nlohmann::json *section = FindSection(configs, JSON_KEY_PUBLISH_CONTROL);
+    if (section != nullptr) {
+        policy->CompilePublishControl(*section);
+    }
+    section = FindSection(configs, JSON_KEY_COALESCING_EVENTS);
+    if (section != nullptr) {
+        policy->CompileCoalescingEvents(*section);
+    }
+    section = FindSection(configs, JSON_KEY_BACKPRESSURE);
+    if (section != nullptr) {
+        policy->CompileBackpressure(*section);
+    }
+    EVENT_LOGI(LOG_TAG_CES, "Policy of %{public}zu controlled events, %{public}zu coalescing events",
+        policy->publishControl_.size(), policy->coalescingEvents_.size());
+    return policy;
+}
+
+bool CommonEventPolicy::IsPublishAllowed(const std::string &event, int32_t uid) const
+{
+    if (publishControl_.empty()) {
+        return true;
+    }
+    auto it = publishControl_.find(event);
+    if (it == publishControl_.end()) {
+        return true;
+    }
+    return it->second.find(uid) != it->second.end();
+}
+
+const nlohmann::json *CommonEventPolicy::FindSection(const std::vector<nlohmann::json> &configs,
+    const std::string &key)
+{
+    for (const auto &config : configs) {
+        if (config.is_object() && config.contains(key)) {
+            return &config[key];
+        }
+    }
+    EVENT_LOGD(LOG_TAG_CES, "No %{public}s configured.", key.c_str());
+    return nullptr;
+}
+
+void CommonEventPolicy::CompilePublishControl(const nlohmann::json &publishControl)
+{
+    if (!publishControl.is_array() || publishControl.empty()) {
+        EVENT_LOGE(LOG_TAG_CES, "Invalid publishControl json.");
+        return;
+    }
+    for (const auto &item : publishControl) {
+        if (!item.is_object() || !item.contains(JSON_KEY_EVENT_NAME) || !item[JSON_KEY_EVENT_NAME].is_string() ||
+            !item.contains(JSON_KEY_UID_LIST) || !item[JSON_KEY_UID_LIST].is_array()) {
+            EVENT_LOGW(LOG_TAG_CES, "Skip invalid publishControl item.");
+            continue;
+        }
+        // a listed event with no valid uid stays controlled and cannot be published by anyone
+        auto &uids = publishControl_[item[JSON_KEY_EVENT_NAME].get<std::string>()];
+        uids.clear();
+        for (const auto &uid : item[JSON_KEY_UID_LIST]) {
+            if (uid.is_number_integer()) {
+                uids.emplace(uid.get<int32_t>());
+            }
+        }
+    }
+}
+
+void CommonEventPolicy::CompileCoalescingEvents(const nlohmann::json &coalescingEvents)
+{
+    if (!coalescingEvents.is_array()) {
+        EVENT_LOGE(LOG_TAG_CES, "Invalid coalescingEvents json.");
+        return;
+    }
+    for (const auto &item : coalescingEvents) {
+        if (item.is_string()) {
+            coalescingEvents_.emplace(item.get<std::string>());
+        }
+    }
+}
+
+void CommonEventPolicy::CompileBackpressure(const nlohmann::json &backpressure)
+{
+    if (!backpressure.is_object()) {
+        EVENT_LOGE(LOG_TAG_CES, "Invalid backpressure json.");
+        return;
+    }
+    if (backpressure.contains(JSON_KEY_MAX_IN_FLIGHT) && backpressure[JSON_KEY_MAX_IN_FLIGHT].is_number_unsigned()) {
+        flowControlConfig_.maxInFlight = backpressure[JSON_KEY_MAX_IN_FLIGHT].get<uint32_t>();
+    }
+    if (backpressure.contains(JSON_KEY_MAX_BACKLOG) && backpressure[JSON_KEY_MAX_BACKLOG].is_number_unsigned()) {
+        flowControlConfig_.maxBacklog = backpressure[JSON_KEY_MAX_BACKLOG].get<uint32_t>();
+    }
+    if (backpressure.contains(JSON_KEY_ACK_TIMEOUT) && backpressure[JSON_KEY_ACK_TIMEOUT].is_number_unsigned()) {
+        flowControlConfig_.ackTimeoutMs = backpressure[JSON_KEY_ACK_TIMEOUT].get<uint32_t>();
+    }
+    if (backpressure.contains(JSON_KEY_POLICY) && backpressure[JSON_KEY_POLICY].is_string()) {
+        std::string policy = backpressure[JSON_KEY_POLICY].get<std::string>();
+        if (policy == "dropOldest") {
+            flowControlConfig_.policy = SubscriberFlowControl::DROP_OLDEST;
+        } else if (policy == "coalesce") {
+            flowControlConfig_.policy = SubscriberFlowControl::COALESCE;
+        } else if (policy != "defer") {
+            EVENT_LOGW(LOG_TAG_CES, "Unknown backpressure policy %{public}s, defer instead.", policy.c_str());
+        }
+    }
+}
+}  // namespace EventFwk
+}  // namespace OHOS
@@ -16,6 +16,7 @@
 #include "common_event_sticky_manager.h"
 #include "errors.h"
 #include "event_log_wrapper.h"
+#include "structured_dump.h"
 
 namespace OHOS {
 namespace EventFwk {
@@ -31,7 +32,7 @@ int CommonEventStickyManager::FindStickyEvents(
         return ERR_INVALID_VALUE;
     }
 
-    auto events = subscribeInfo->GetMatchingSkills().GetEvents();
+    const auto &events = subscribeInfo->GetMatchingSkills().GetEventsRef();
     if (events.size() == 0) {
         EVENT_LOGW(LOG_TAG_STICKY, "No subscribed events");
         return ERR_INVALID_VALUE;
@@ -167,6 +168,22 @@ void CommonEventStickyManager::DumpState(
         state.emplace_back(dumpInfo);
     }
 }
+
+void CommonEventStickyManager::DumpStructured(const std::string &event, const int32_t &userId, nlohmann::json &root)
+{
+    EVENT_LOGD(LOG_TAG_STICKY, "enter");
+
+    std::vector<CommonEventRecordPtr> records;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        GetStickyCommonEventRecords(event, userId, records);
+    }
+    nlohmann::json sticky = nlohmann::json::array();
+    for (const auto &record : records) {
+        sticky.push_back(StructuredDump::FromEventRecord(*record));
+    }
+    root["sticky"] = std::move(sticky);
+}
 #endif
 void CommonEventStickyManager::FindStickyEventsLocked(
     const std::vector<std::string> &events, std::vector<CommonEventRecordPtr> &commonEventRecords)
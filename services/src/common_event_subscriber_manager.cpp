@@ -14,9 +14,11 @@
  */
 #include "common_event_subscriber_manager.h"
 
+#include <algorithm>
 #include <csignal>
 #include <fstream>
 #include <sstream>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 #include <set>
@@ -31,6 +33,7 @@
 #include "hisysevent.h"
 #include "hitrace_meter_adapter.h"
 #include "parameter.h"
+#include "structured_dump.h"
 #include "subscriber_death_recipient.h"
 #include "bundle_manager_helper.h"
 #ifdef WATCH_CUSTOMIZED_SCREEN_EVENT_TO_OTHER_APP
@@ -44,6 +47,14 @@ namespace EventFwk {
 constexpr int32_t LENGTH = 80;
 constexpr int32_t SIGNAL_KILL = 9;
 static constexpr int32_t SUBSCRIBE_EVENT_MAX_NUM = 512;
+static constexpr uint32_t DEFAULT_MAX_SUBSCRIBER_NUM_PER_UID = 1000;
+static constexpr char SUBSCRIBER_LIMIT_PARAM[] = "hiviewdfx.ces.subscriber_limit";
+static constexpr char SUBSCRIBER_LIMIT_PER_UID_PARAM[] = "hiviewdfx.ces.subscriber_limit_per_uid";
+static constexpr uint64_t COMPACT_DELAY_TIME = 30 * 1000 * 1000;  // microseconds
+static constexpr size_t COMPACT_MIN_SLACK_BYTES = 4 * 1024;
+static constexpr size_t COMPACT_MIN_VECTOR_SLACK = 8;
+static constexpr size_t COMPACT_STEP_EVENTS = 32;
+static constexpr size_t COMPACT_BUCKET_FACTOR = 4;
 static constexpr char CES_REGISTER_EXCEED_LIMIT[] = "Kill Reason: CES Register exceed limit";
 const std::string CONNECTOR = " or ";
 
@@ -58,9 +69,20 @@ FuncSubscriber SubscribeScreenEventToBlackListAppFlag =
 
 CommonEventSubscriberManager::CommonEventSubscriberManager()
     : death_(sptr<IRemoteObject::DeathRecipient>(new (std::nothrow) SubscriberDeathRecipient()))
-{}
+{
+    ReloadSubscriberLimits();
+}
 
-CommonEventSubscriberManager::~CommonEventSubscriberManager() {}
+CommonEventSubscriberManager::~CommonEventSubscriberManager()
+{
+    std::shared_ptr<ffrt::queue> compactQueue;
+    {
+        std::lock_guard<ffrt::mutex> lock(compactMutex_);
+        compactQueue.swap(compactQueue_);
+    }
+    // cancels the compaction tasks that are not started and waits for a running one
+    compactQueue = nullptr;
+}
 
 std::shared_ptr<EventSubscriberRecord> CommonEventSubscriberManager::InsertSubscriber(
     const SubscribeInfoPtr &eventSubscribeInfo, const sptr<IRemoteObject> &commonEventListener,
@@ -77,24 +99,36 @@ std::shared_ptr<EventSubscriberRecord> CommonEventSubscriberManager::InsertSubsc
         EVENT_LOGE(LOG_TAG_SUBSCRIBER, "commonEventListener is null");
         return nullptr;
     }
-    std::vector<std::string> events = eventSubscribeInfo->GetMatchingSkills().GetEvents();
-    if (events.size() == 0 || events.size() > SUBSCRIBE_EVENT_MAX_NUM) {
+    const std::vector<std::string> &events = eventSubscribeInfo->GetMatchingSkills().GetEventsRef();
+    size_t subscribedNum = events.size() + eventSubscribeInfo->GetMatchingSkills().CountEventPrefixes();
+    if (subscribedNum == 0 || subscribedNum > SUBSCRIBE_EVENT_MAX_NUM) {
         EVENT_LOGE(LOG_TAG_SUBSCRIBER, "subscribed events size is error");
         return nullptr;
     }
+    // the prefixes come from the client parcel, a short one would match nearly every event
+    for (const auto &prefix : eventSubscribeInfo->GetMatchingSkills().GetEventPrefixes()) {
+        if (prefix.size() < MatchingSkills::MIN_EVENT_PREFIX_LENGTH) {
+            EVENT_LOGE(LOG_TAG_SUBSCRIBER, "event prefix %{public}s is too short", prefix.c_str());
+            return nullptr;
+        }
+    }
     auto record = GetSubscriberRecord(commonEventListener);
     if (record != nullptr) {
         UpdateSubscriberRecordLocked(eventSubscribeInfo, recordTime, eventRecordInfo, record);
     } else {
-        record = std::make_shared<EventSubscriberRecord>();
+        record = std::allocate_shared<EventSubscriberRecord>(SlabAllocator<EventSubscriberRecord>());
         record->eventSubscribeInfo = eventSubscribeInfo;
         record->commonEventListener = commonEventListener;
         record->recordTime = recordTime;
         record->eventRecordInfo = eventRecordInfo;
+        record->flowControl = std::make_shared<SubscriberFlowControl>();
         if (death_ != nullptr) {
             commonEventListener->AddDeathRecipient(death_);
         }
         if (!InsertSubscriberRecordLocked(events, record)) {
+            if (death_ != nullptr) {
+                commonEventListener->RemoveDeathRecipient(death_);
+            }
             return nullptr;
         }
     }
@@ -129,16 +163,76 @@ int CommonEventSubscriberManager::RemoveSubscriber(const sptr<IRemoteObject> &co
     return res;
 }
 
+size_t CommonEventSubscriberManager::RemoveSubscribersOnDeath(const sptr<IRemoteObject> &commonEventListener)
+{
+    NOTIFICATION_HITRACE(HITRACE_TAG_NOTIFICATION);
+    if (commonEventListener == nullptr) {
+        EVENT_LOGE(LOG_TAG_SUBSCRIBER, "commonEventListener is null");
+        return 0;
+    }
+
+    pid_t pid = 0;
+    uid_t uid = 0;
+    std::vector<SubscriberRecordPtr> removed;
+    std::function<void(pid_t, uid_t)> callback;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        auto it = std::find_if(subscribers_.begin(), subscribers_.end(),
+            [&commonEventListener](const SubscriberRecordPtr &record) {
+                return record != nullptr && record->commonEventListener == commonEventListener;
+            });
+        if (it == subscribers_.end()) {
+            // removed together with an earlier listener of the same process
+            return 0;
+        }
+        pid = (*it)->eventRecordInfo.pid;
+        uid = (*it)->eventRecordInfo.uid;
+        if (pid > 0) {
+            // the notice is handled asynchronously and the pid may already be reused, so a listener of the same
+            // process is only removed together with this one when it is dead as well
+            RemoveSubscriberRecordsLocked([pid, uid, &commonEventListener](const SubscriberRecordPtr &record) {
+                return record->eventRecordInfo.pid == pid && record->eventRecordInfo.uid == uid &&
+                    (record->commonEventListener == commonEventListener ||
+                    record->commonEventListener->IsObjectDead());
+            }, removed);
+        } else {
+            RemoveSubscriberRecordsLocked([&commonEventListener](const SubscriberRecordPtr &record) {
+                return record->commonEventListener == commonEventListener;
+            }, removed);
+        }
+        callback = processDiedCallback_;
+    }
+
+    // the process is gone, the notices still queued for its other listeners are not needed
+    if (death_ != nullptr) {
+        for (const auto &record : removed) {
+            record->commonEventListener->RemoveDeathRecipient(death_);
+        }
+    }
+    // a drain in progress may still hold the records, their backlog will never be sent
+    for (const auto &record : removed) {
+        if (record->flowControl != nullptr) {
+            record->flowControl->Close();
+        }
+    }
+    EVENT_LOGI(LOG_TAG_SUBSCRIBER, "Pid %{public}d died, %{public}zu subscribers removed", pid, removed.size());
+    if (callback != nullptr && pid > 0) {
+        callback(pid, uid);
+    }
+    return removed.size();
+}
+
+void CommonEventSubscriberManager::SetProcessDiedCallback(const std::function<void(pid_t, uid_t)> &callback)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    processDiedCallback_ = callback;
+}
+
 std::vector<std::shared_ptr<EventSubscriberRecord>> CommonEventSubscriberManager::GetSubscriberRecords(
     const CommonEventRecord &eventRecord)
 {
     EVENT_LOGD(LOG_TAG_SUBSCRIBER, "enter");
-    
-    std::string action = eventRecord.commonEventData->GetWant().GetAction();
-    if (!hasCompacted_ && action == CommonEventSupport::COMMON_EVENT_SCREEN_OFF) {
-        CompactSubscriberDataStructures();
-    }
-    
+
     auto records = std::vector<SubscriberRecordPtr>();
 
     GetSubscriberRecordsByWantLocked(eventRecord, records);
@@ -146,101 +240,127 @@ std::vector<std::shared_ptr<EventSubscriberRecord>> CommonEventSubscriberManager
     return records;
 }
 
+void CommonEventSubscriberManager::GetSubscriberRecords(
+    const CommonEventRecord &eventRecord, std::vector<SubscriberRecordPtr> &records)
+{
+    EVENT_LOGD(LOG_TAG_SUBSCRIBER, "enter");
+
+    records.clear();
+    GetSubscriberRecordsByWantLocked(eventRecord, records);
+}
+
 std::shared_ptr<EventSubscriberRecord> CommonEventSubscriberManager::GetSubscriberRecord(
     const sptr<IRemoteObject> &commonEventListener)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
 
-    for (auto it = subscribers_.begin(); it != subscribers_.end(); ++it) {
-        if (commonEventListener == (*it)->commonEventListener) {
-            return *it;
-        }
+    auto it = listenerIndex_.find(commonEventListener.GetRefPtr());
+    if (it == listenerIndex_.end()) {
+        return nullptr;
     }
-
-    return nullptr;
+    return it->second;
 }
 #ifdef CEM_SUPPORT_DUMP
 void CommonEventSubscriberManager::DumpDetailed(
     const std::string &title, const SubscriberRecordPtr &record, const std::string format, std::string &dumpInfo)
 {
-    if (record == nullptr || record->eventSubscribeInfo == nullptr) {
+    if (record == nullptr) {
         EVENT_LOGE(LOG_TAG_SUBSCRIBER, "record or eventSubscribeInfo is null");
         return;
     }
+    EventSubscriberRecord snapshot;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        snapshot = *record;
+    }
+    if (snapshot.eventSubscribeInfo == nullptr) {
+        EVENT_LOGE(LOG_TAG_SUBSCRIBER, "record or eventSubscribeInfo is null");
+        return;
+    }
+    DumpWriter writer(dumpInfo);
+    writer.Append(title);
+    DumpDetailed(snapshot, format, writer);
+}
+
+void CommonEventSubscriberManager::DumpDetailed(
+    const EventSubscriberRecord &record, const std::string &format, DumpWriter &writer)
+{
     char systime[LENGTH];
-    strftime(systime, sizeof(char) * LENGTH, "%Y%m%d %I:%M %p", &record->recordTime);
-
-    std::string recordTime = format + "Time: " + std::string(systime) + "\n";
-    std::string pid = format + "PID: " + std::to_string(record->eventRecordInfo.pid) + "\n";
-    std::string uid = format + "UID: " + std::to_string(record->eventRecordInfo.uid) + "\n";
-    std::string bundleName = format + "BundleName: " + record->eventRecordInfo.bundleName + "\n";
-    std::string priority = format + "Priority: " + std::to_string(record->eventSubscribeInfo->GetPriority()) + "\n";
-    std::string userId;
-    switch (record->eventSubscribeInfo->GetUserId()) {
+    strftime(systime, sizeof(char) * LENGTH, "%Y%m%d %I:%M %p", &record.recordTime);
+
+    writer.Append(format).Append("Time: ").Append(systime).Append("\n");
+    writer.Append(format).Append("PID: ").Append(static_cast<int64_t>(record.eventRecordInfo.pid)).Append("\n");
+    writer.Append(format).Append("UID: ").Append(static_cast<int64_t>(record.eventRecordInfo.uid)).Append("\n");
+    writer.Append(format).Append("BundleName: ").Append(record.eventRecordInfo.bundleName).Append("\n");
+    writer.Append(format).Append("Priority: ")
+        .Append(static_cast<int64_t>(record.eventSubscribeInfo->GetPriority())).Append("\n");
+    writer.Append(format).Append("USERID: ");
+    switch (record.eventSubscribeInfo->GetUserId()) {
         case UNDEFINED_USER:
-            userId = "UNDEFINED_USER";
+            writer.Append("UNDEFINED_USER");
             break;
         case ALL_USER:
-            userId = "ALL_USER";
+            writer.Append("ALL_USER");
             break;
         default:
-            userId = std::to_string(record->eventSubscribeInfo->GetUserId());
+            writer.Append(static_cast<int64_t>(record.eventSubscribeInfo->GetUserId()));
             break;
     }
-    userId = format + "USERID: " + userId + "\n";
-    std::string permission = format + "Permission: " + record->eventSubscribeInfo->GetPermission() + "\n";
-
-    std::string events = format + "\tEvent: ";
-    std::string separator;
-    size_t countSize = record->eventSubscribeInfo->GetMatchingSkills().CountEvent();
-    for (size_t eventNum = 0; eventNum < countSize; ++eventNum) {
-        if (eventNum == 0) {
-            separator = "";
-        } else {
-            separator = ", ";
+    writer.Append("\n");
+    writer.Append(format).Append("Permission: ").Append(record.eventSubscribeInfo->GetPermission()).Append("\n");
+
+    const MatchingSkills &matchingSkills = record.eventSubscribeInfo->GetMatchingSkills();
+    writer.Append(format).Append("MatchingSkills:\n");
+    writer.Append(format).Append("\tEvent: ");
+    for (size_t eventNum = 0; eventNum < matchingSkills.CountEvent(); ++eventNum) {
+        writer.Append(eventNum == 0 ? "" : ", ").Append(matchingSkills.GetEvent(eventNum));
+    }
+    writer.Append("\n");
+    const auto &eventPrefixes = matchingSkills.GetEventPrefixes();
+    if (!eventPrefixes.empty()) {
+        writer.Append(format).Append("\tEventPrefix: ");
+        for (size_t prefixNum = 0; prefixNum < eventPrefixes.size(); ++prefixNum) {
+            writer.Append(prefixNum == 0 ? "" : ", ").Append(eventPrefixes[prefixNum]).Append("*");
         }
-        events = events + separator + record->eventSubscribeInfo->GetMatchingSkills().GetEvent(eventNum);
+        writer.Append("\n");
     }
-    events = events + "\n";
-
-    std::string entities = format + "\tEntity: ";
-    size_t entitySize = record->eventSubscribeInfo->GetMatchingSkills().CountEntities();
-    for (size_t entityNum = 0; entityNum < entitySize; ++entityNum) {
-        if (entityNum == 0) {
-            separator = "";
-        } else {
-            separator = ", ";
-        }
-        entities = entities + separator + record->eventSubscribeInfo->GetMatchingSkills().GetEntity(entityNum);
+    writer.Append(format).Append("\tEntity: ");
+    for (size_t entityNum = 0; entityNum < matchingSkills.CountEntities(); ++entityNum) {
+        writer.Append(entityNum == 0 ? "" : ", ").Append(matchingSkills.GetEntity(entityNum));
     }
-    entities = entities + "\n";
-
-    std::string scheme = format + "\tScheme: ";
-    size_t schemeSize = record->eventSubscribeInfo->GetMatchingSkills().CountSchemes();
-    for (size_t schemeNum = 0; schemeNum < schemeSize; ++schemeNum) {
-        if (schemeNum == 0) {
-            separator = "";
-        } else {
-            separator = ", ";
-        }
-        scheme = scheme + separator + record->eventSubscribeInfo->GetMatchingSkills().GetScheme(schemeNum);
+    writer.Append("\n");
+    writer.Append(format).Append("\tScheme: ");
+    for (size_t schemeNum = 0; schemeNum < matchingSkills.CountSchemes(); ++schemeNum) {
+        writer.Append(schemeNum == 0 ? "" : ", ").Append(matchingSkills.GetScheme(schemeNum));
     }
-    scheme = scheme + "\n";
+    writer.Append("\n");
 
-    std::string matchingSkills = format + "MatchingSkills:\n" + events + entities + scheme;
-
-    std::string isFreeze = record->isFreeze ? "true" : "false";
-    isFreeze = format + "IsFreeze: " + isFreeze + "\n";
-
-    std::string freezeTime;
-    if (record->freezeTime == 0) {
-        freezeTime = format + "FreezeTime:  -\n";
+    writer.Append(format).Append("IsFreeze: ").Append(record.isFreeze ? "true" : "false").Append("\n");
+    if (record.freezeTime == 0) {
+        writer.Append(format).Append("FreezeTime:  -\n");
     } else {
-        freezeTime = format + "FreezeTime: " + std::to_string(record->freezeTime) + "\n";
+        writer.Append(format).Append("FreezeTime: ").Append(record.freezeTime).Append("\n");
+    }
+    if (record.flowControl != nullptr) {
+        std::string counters = record.flowControl->Dump();
+        writer.Append(format).Append("FlowControl: ").Append(counters.empty() ? "-" : counters).Append("\n");
     }
+}
 
-    dumpInfo = title + recordTime + pid + uid + bundleName + priority + userId + permission +
-               matchingSkills + isFreeze + freezeTime;
+void CommonEventSubscriberManager::GetDumpEntries(
+    const std::string &event, const int32_t &userId, std::vector<EventSubscriberRecord> &entries)
+{
+    std::vector<SubscriberRecordPtr> records;
+    // UpdateSubscriberRecordLocked reassigns the info of a live record in place, so formatting only reads copies
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    GetSubscriberRecordsByEvent(event, userId, records);
+    entries.reserve(records.size());
+    for (const auto &record : records) {
+        if (record == nullptr || record->eventSubscribeInfo == nullptr) {
+            continue;
+        }
+        entries.push_back(*record);
+    }
 }
 
 void CommonEventSubscriberManager::DumpState(const std::string &event, const int32_t &userId,
@@ -248,30 +368,194 @@ void CommonEventSubscriberManager::DumpState(const std::string &event, const int
 {
     EVENT_LOGD(LOG_TAG_SUBSCRIBER, "enter");
 
-    std::vector<SubscriberRecordPtr> records;
-
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    GetSubscriberRecordsByEvent(event, userId, records);
+    std::vector<EventSubscriberRecord> entries;
+    GetDumpEntries(event, userId, entries);
 
-    if (records.size() == 0) {
+    if (entries.size() == 0) {
         state.emplace_back("Subscribers:\tNo information");
         return;
     }
 
     size_t num = 0;
-    for (auto record : records) {
+    for (const auto &entry : entries) {
         num++;
-        std::string title = std::to_string(num);
+        std::string dumpInfo;
+        DumpWriter writer(dumpInfo);
         if (num == 1) {
-            title = "Subscribers:\tTotal " + std::to_string(records.size()) + " subscribers\nNO " + title + "\n";
-        } else {
-            title = "NO " + title + "\n";
+            writer.Append("Subscribers:\tTotal ").Append(static_cast<int64_t>(entries.size())).Append(" subscribers\n");
         }
-        std::string dumpInfo;
-        DumpDetailed(title, record, "\t", dumpInfo);
-        state.emplace_back(dumpInfo);
+        writer.Append("NO ").Append(static_cast<int64_t>(num)).Append("\n");
+        DumpDetailed(entry, "\t", writer);
+        state.emplace_back(std::move(dumpInfo));
     }
 }
+
+void CommonEventSubscriberManager::DumpState(const std::string &event, const int32_t &userId,
+    const DumpFilter &filter, DumpWriter &writer)
+{
+    EVENT_LOGD(LOG_TAG_SUBSCRIBER, "enter");
+
+    std::vector<EventSubscriberRecord> entries;
+    GetDumpEntries(event, userId, entries);
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [&filter](const EventSubscriberRecord &entry) {
+        const auto &info = entry.eventRecordInfo;
+        return !filter.Match(info.pid, info.uid, info.bundleName);
+    }), entries.end());
+
+    if (entries.size() == 0) {
+        writer.Append("Subscribers:\tNo information\n");
+        return;
+    }
+    size_t begin = 0;
+    size_t end = entries.size();
+    writer.Append("Subscribers:\tTotal ").Append(static_cast<int64_t>(entries.size())).Append(" subscribers");
+    if (filter.pageSize != 0) {
+        // page and page size come from the command line, nothing here may overflow
+        size_t pages = entries.size() / filter.pageSize + (entries.size() % filter.pageSize != 0 ? 1 : 0);
+        writer.Append(", page ").Append(static_cast<int64_t>(filter.page)).Append(" of ")
+            .Append(static_cast<int64_t>(pages));
+        begin = filter.page < pages ? filter.page * filter.pageSize : entries.size();
+        end = begin + std::min(filter.pageSize, entries.size() - begin);
+    }
+    writer.Append("\n");
+    for (size_t index = begin; index < end; ++index) {
+        writer.Append("NO ").Append(static_cast<int64_t>(index + 1)).Append("\n");
+        DumpDetailed(entries[index], "\t", writer);
+        writer.Append("\n");
+    }
+}
+
+void CommonEventSubscriberManager::DumpStructured(const std::string &event, const int32_t &userId,
+    nlohmann::json &root)
+{
+    EVENT_LOGD(LOG_TAG_SUBSCRIBER, "enter");
+
+    std::vector<EventSubscriberRecord> entries;
+    GetDumpEntries(event, userId, entries);
+    nlohmann::json subscribers = nlohmann::json::array();
+    for (const auto &entry : entries) {
+        subscribers.push_back(StructuredDump::FromSubscriberRecord(entry, entry.isFreeze, entry.freezeTime));
+    }
+    root["subscribers"] = std::move(subscribers);
+
+    nlohmann::json frozen = nlohmann::json::array();
+    auto appendFrozen = [&event, &frozen](const FrozenRecords &records) {
+        for (const auto &[subscriber, eventRecords] : records) {
+            nlohmann::json actions = nlohmann::json::array();
+            for (const auto &eventRecord : eventRecords) {
+                if (eventRecord == nullptr || eventRecord->commonEventData == nullptr) {
+                    continue;
+                }
+                const std::string &action = eventRecord->commonEventData->GetWant().GetAction();
+                if (event.empty() || action == event) {
+                    actions.push_back(action);
+                }
+            }
+            if (actions.empty()) {
+                continue;
+            }
+            frozen.push_back({
+                { "pid", subscriber.eventRecordInfo.pid },
+                { "uid", subscriber.eventRecordInfo.uid },
+                { "bundleName", subscriber.eventRecordInfo.bundleName },
+                { "subId", subscriber.eventRecordInfo.subId },
+                { "events", std::move(actions) },
+            });
+        }
+    };
+    FrozenProcessRecords frozenEvents;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        frozenEvents = frozenEvents_;
+    }
+    for (const auto &[key, records] : frozenEvents) {
+        appendFrozen(records);
+    }
+    root["frozen"] = std::move(frozen);
+}
+
+static size_t GetHeapBytes(const std::string &value)
+{
+    static const size_t inlineCapacity = std::string().capacity();
+    return value.capacity() > inlineCapacity ? value.capacity() + 1 : 0;
+}
+
+static size_t GetHeapBytes(const std::vector<std::string> &values)
+{
+    size_t bytes = values.capacity() * sizeof(std::string);
+    for (const auto &value : values) {
+        bytes += GetHeapBytes(value);
+    }
+    return bytes;
+}
+
+void CommonEventSubscriberManager::DumpMemory(std::vector<std::string> &state)
+{
+    EVENT_LOGD(LOG_TAG_SUBSCRIBER, "enter");
+
+    size_t stringBytes = 0;
+    size_t subscribeInfoBytes = 0;
+    size_t indexEntries = 0;
+    size_t indexBytes = 0;
+    size_t events = 0;
+    size_t prefixes = 0;
+    size_t subscribers = 0;
+    FragmentationStats fragmentation;
+    FragmentationStats compactBefore;
+    FragmentationStats compactAfter;
+    uint32_t compactRuns = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        fragmentation = MeasureFragmentationLocked();
+        compactBefore = compactBefore_;
+        compactAfter = compactAfter_;
+        compactRuns = compactRuns_;
+        subscribers = subscribers_.size();
+        for (const auto &record : subscribers_) {
+            if (record == nullptr) {
+                continue;
+            }
+            stringBytes += GetHeapBytes(record->eventRecordInfo.bundleName) +
+                GetHeapBytes(record->eventRecordInfo.subId);
+            if (record->eventSubscribeInfo == nullptr) {
+                continue;
+            }
+            const MatchingSkills &matchingSkills = record->eventSubscribeInfo->GetMatchingSkills();
+            subscribeInfoBytes += sizeof(CommonEventSubscribeInfo) + GetHeapBytes(matchingSkills.GetEventsRef()) +
+                GetHeapBytes(matchingSkills.GetEventPrefixes()) + GetHeapBytes(matchingSkills.GetEntities()) +
+                GetHeapBytes(matchingSkills.GetSchemes());
+        }
+        events = eventSubscribers_.size();
+        for (const auto &[event, records] : eventSubscribers_) {
+            indexEntries += records.size();
+            indexBytes += sizeof(std::pair<const std::string, std::vector<SubscriberRecordPtr>>) +
+                GetHeapBytes(event) + records.capacity() * sizeof(SubscriberRecordPtr);
+        }
+        prefixes = prefixSubscribers_.Size();
+    }
+    SlabPool::Stats pool = GetSlabPool<EventSubscriberRecord>().GetStats();
+
+    std::string dumpInfo = "Memory:\n";
+    dumpInfo += "\tSubscriber records: " + std::to_string(subscribers) + " records, " +
+        std::to_string(pool.inUse) + " pooled blocks of " + std::to_string(pool.blockSize) + " bytes in " +
+        std::to_string(pool.slabs) + " slabs, " + std::to_string(pool.reservedBytes) + " bytes reserved\n";
+    dumpInfo += "\tSubscriber strings: " + std::to_string(stringBytes) + " bytes\n";
+    dumpInfo += "\tSubscribe infos: " + std::to_string(subscribeInfoBytes) + " bytes\n";
+    dumpInfo += "\tEvent index: " + std::to_string(events) + " events, " + std::to_string(indexEntries) +
+        " entries, " + std::to_string(indexBytes) + " bytes\n";
+    dumpInfo += "\tPrefix index: " + std::to_string(prefixes) + " entries\n";
+    dumpInfo += "\tFragmentation: " + std::to_string(fragmentation.GetSlackBytes()) + " slack bytes, " +
+        std::to_string(fragmentation.emptyEvents) + " empty events\n";
+    dumpInfo += "\tCompaction: " + std::to_string(compactRuns) + " runs";
+    if (compactRuns != 0) {
+        dumpInfo += ", last run " + std::to_string(compactBefore.GetSlackBytes()) + " -> " +
+            std::to_string(compactAfter.GetSlackBytes()) + " slack bytes";
+    }
+    dumpInfo += "\n";
+    dumpInfo += "\tTotal: " + std::to_string(pool.reservedBytes + stringBytes + subscribeInfoBytes + indexBytes) +
+        " bytes";
+    state.emplace_back(dumpInfo);
+}
 #endif
 __attribute__((no_sanitize("cfi"))) bool CommonEventSubscriberManager::InsertSubscriberRecordLocked(
     const std::vector<std::string> &events, const SubscriberRecordPtr &record)
@@ -288,39 +572,59 @@ __attribute__((no_sanitize("cfi"))) bool CommonEventSubscriberManager::InsertSub
         return false;
     }
 
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-
     pid_t pid = record->eventRecordInfo.pid;
-
-    if (CheckSubscriberCountReachedMaxinum()) {
-        std::vector<std::pair<pid_t, uint32_t>> vtSubscriberCounts = GetTopSubscriberCounts(1);
-        pid_t killedPid = (*vtSubscriberCounts.begin()).first;
-        if (pid == killedPid) {
+    uid_t uid = record->eventRecordInfo.uid;
+    pid_t killedPid = 0;
+    std::map<pid_t, SubscriberRecordPtr> topRecordsMap;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        // native services are bound by the service-wide limit only
+        if (subscriberQuota_.Check(uid, !record->eventRecordInfo.isSubsystem) ==
+            SubscriberQuota::UID_QUOTA_EXCEEDED) {
+            EVENT_LOGW(LOG_TAG_SUBSCRIBER, "uid=%{public}d reaches the quota of %{public}u subscribers, "
+                "reject %{public}s", uid, subscriberQuota_.GetMaxPerUid(), record->eventRecordInfo.subId.c_str());
             return false;
         }
-        std::map<pid_t, SubscriberRecordPtr> topRecordsMap = GetTopSubscriberRecordsMap(vtSubscriberCounts);
-        ReportTopSubscribersInfoHiSysEvent(topRecordsMap, killedPid);
-
-        AAFwk::ExitReason reason = { AAFwk::REASON_RESOURCE_CONTROL, "Kill Reason: CES Register exceed limit"};
-        AAFwk::AbilityManagerClient::GetInstance()->RecordProcessExitReason(killedPid, reason);
-        int killResult = kill(killedPid, SIGNAL_KILL);
-        EVENT_LOGW(LOG_TAG_SUBSCRIBER, "kill pid=%{public}d which has the most subscribers %{public}s", killedPid,
-            killResult < 0 ? "failed" : "successfully");
-        int result = HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::FRAMEWORK, "PROCESS_KILL",
-            HiviewDFX::HiSysEvent::EventType::FAULT, "PID", killedPid, "PROCESS_NAME",
-            record->eventRecordInfo.bundleName, "MSG", CES_REGISTER_EXCEED_LIMIT, "REASON", CES_REGISTER_EXCEED_LIMIT);
-        EVENT_LOGW(LOG_TAG_SUBSCRIBER, "hisysevent write result=%{public}d,send[FRAMEWORK,PROCESS_KILL],pid=%{public}d"
-            ",processName=%{public}s,msg=%{public}s", result, killedPid, record->eventRecordInfo.bundleName.c_str(),
-            CES_REGISTER_EXCEED_LIMIT);
-    }
-
-    InsertEventSubscribers(events, record);
-    subscribers_.emplace_back(record);
-    subscriberCounts_[pid]++;
+        if (CheckSubscriberCountReachedMaxinum()) {
+            std::vector<std::pair<pid_t, uint32_t>> vtSubscriberCounts = GetTopSubscriberCounts(1);
+            killedPid = (*vtSubscriberCounts.begin()).first;
+            if (pid == killedPid) {
+                return false;
+            }
+            topRecordsMap = GetTopSubscriberRecordsMap(vtSubscriberCounts);
+        }
+
+        InsertEventSubscribers(events, record);
+        InsertPrefixSubscribers(record->eventSubscribeInfo->GetMatchingSkills().GetEventPrefixes(), record);
+        subscribers_.emplace_back(record);
+        listenerIndex_[record->commonEventListener.GetRefPtr()] = record;
+        subscriberQuota_.Add(pid, uid);
+    }
 
+    // reading /proc and writing hisysevents stays out of the subscriber lock
+    if (killedPid != 0) {
+        KillTopSubscriber(killedPid, topRecordsMap, record->eventRecordInfo.bundleName);
+    }
     return true;
 }
 
+void CommonEventSubscriberManager::KillTopSubscriber(pid_t killedPid,
+    const std::map<pid_t, SubscriberRecordPtr> &topRecordsMap, const std::string &bundleName)
+{
+    ReportTopSubscribersInfoHiSysEvent(topRecordsMap, killedPid);
+
+    AAFwk::ExitReason reason = { AAFwk::REASON_RESOURCE_CONTROL, "Kill Reason: CES Register exceed limit"};
+    AAFwk::AbilityManagerClient::GetInstance()->RecordProcessExitReason(killedPid, reason);
+    int killResult = kill(killedPid, SIGNAL_KILL);
+    EVENT_LOGW(LOG_TAG_SUBSCRIBER, "kill pid=%{public}d which has the most subscribers %{public}s", killedPid,
+        killResult < 0 ? "failed" : "successfully");
+    int result = HiSysEventWrite(HiviewDFX::HiSysEvent::Domain::FRAMEWORK, "PROCESS_KILL",
+        HiviewDFX::HiSysEvent::EventType::FAULT, "PID", killedPid, "PROCESS_NAME",
+        bundleName, "MSG", CES_REGISTER_EXCEED_LIMIT, "REASON", CES_REGISTER_EXCEED_LIMIT);
+    EVENT_LOGW(LOG_TAG_SUBSCRIBER, "hisysevent write result=%{public}d,send[FRAMEWORK,PROCESS_KILL],pid=%{public}d"
+        ",processName=%{public}s,msg=%{public}s", result, killedPid, bundleName.c_str(), CES_REGISTER_EXCEED_LIMIT);
+}
+
 bool CommonEventSubscriberManager::UpdateSubscriberRecordLocked(
     const SubscribeInfoPtr &eventSubscribeInfo, const struct tm &recordTime,
     const EventRecordInfo &eventRecordInfo, SubscriberRecordPtr record)
@@ -334,23 +638,49 @@ bool CommonEventSubscriberManager::UpdateSubscriberRecordLocked(
     
     std::lock_guard<ffrt::mutex> lock(mutex_);
 
-    std::vector<std::string> oldEvents = record->eventSubscribeInfo->GetMatchingSkills().GetEvents();
-    std::vector<std::string> newEvents = eventSubscribeInfo->GetMatchingSkills().GetEvents();
-    std::sort(oldEvents.begin(), oldEvents.end());
-    std::sort(newEvents.begin(), newEvents.end());
+    // keep the old info alive while diffing, HasEvent is a hashed lookup so the diff stays linear
+    SubscribeInfoPtr oldInfo = record->eventSubscribeInfo;
+    const MatchingSkills &oldSkills = oldInfo->GetMatchingSkills();
+    const MatchingSkills &newSkills = eventSubscribeInfo->GetMatchingSkills();
 
     std::vector<std::string> removeEvents;
-    std::set_difference(oldEvents.begin(), oldEvents.end(), newEvents.begin(), newEvents.end(),
-        std::back_inserter(removeEvents));
+    for (const auto &event : oldSkills.GetEventsRef()) {
+        if (!newSkills.HasEvent(event)) {
+            removeEvents.emplace_back(event);
+        }
+    }
     RemoveEventSubscribers(removeEvents, record);
 
     std::vector<std::string> addEvents;
-    std::set_difference(newEvents.begin(), newEvents.end(), oldEvents.begin(), oldEvents.end(),
-        std::back_inserter(addEvents));
+    for (const auto &event : newSkills.GetEventsRef()) {
+        if (!oldSkills.HasEvent(event)) {
+            addEvents.emplace_back(event);
+        }
+    }
+
+    std::vector<std::string> removePrefixes;
+    for (const auto &prefix : oldSkills.GetEventPrefixes()) {
+        if (!newSkills.HasEventPrefix(prefix)) {
+            removePrefixes.emplace_back(prefix);
+        }
+    }
+    RemovePrefixSubscribers(removePrefixes, record);
+
+    std::vector<std::string> addPrefixes;
+    for (const auto &prefix : newSkills.GetEventPrefixes()) {
+        if (!oldSkills.HasEventPrefix(prefix)) {
+            addPrefixes.emplace_back(prefix);
+        }
+    }
     record->eventSubscribeInfo = eventSubscribeInfo;
+    if (record->eventRecordInfo.pid != eventRecordInfo.pid || record->eventRecordInfo.uid != eventRecordInfo.uid) {
+        subscriberQuota_.Remove(record->eventRecordInfo.pid, record->eventRecordInfo.uid);
+        subscriberQuota_.Add(eventRecordInfo.pid, eventRecordInfo.uid);
+    }
     record->eventRecordInfo = eventRecordInfo;
     record->recordTime = recordTime;
     InsertEventSubscribers(addEvents, record);
+    InsertPrefixSubscribers(addPrefixes, record);
 
     return true;
 }
@@ -367,22 +697,25 @@ int CommonEventSubscriberManager::RemoveSubscriberRecordLocked(const sptr<IRemot
     }
 
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    std::vector<std::string> events;
+    SubscriberRecordPtr removed = nullptr;
 
     for (auto it = subscribers_.begin(); it != subscribers_.end(); ++it) {
         if (commonEventListener == (*it)->commonEventListener) {
             RemoveFrozenEventsBySubscriber((*it));
-            RemoveFrozenEventsMapBySubscriber((*it));
-            events = (*it)->eventSubscribeInfo->GetMatchingSkills().GetEvents();
+            removed = *it;
             EVENT_LOGI(LOG_TAG_SUBSCRIBER, "Unsubscribe %{public}s", (*it)->eventRecordInfo.subId.c_str());
-            pid_t pid = (*it)->eventRecordInfo.pid;
-            subscriberCounts_[pid] > 1 ? subscriberCounts_[pid]-- : subscriberCounts_.erase(pid);
+            subscriberQuota_.Remove((*it)->eventRecordInfo.pid, (*it)->eventRecordInfo.uid);
+            listenerIndex_.erase(commonEventListener.GetRefPtr());
             subscribers_.erase(it);
             break;
         }
     }
 
-    for (auto event : events) {
+    if (removed == nullptr) {
+        return ERR_OK;
+    }
+    RemovePrefixSubscribers(removed->eventSubscribeInfo->GetMatchingSkills().GetEventPrefixes(), removed);
+    for (const auto &event : removed->eventSubscribeInfo->GetMatchingSkills().GetEventsRef()) {
         auto& vec = eventSubscribers_[event];
         vec.erase(std::remove_if(vec.begin(), vec.end(),
             [&commonEventListener](const SubscriberRecordPtr& rec) {
@@ -392,10 +725,62 @@ int CommonEventSubscriberManager::RemoveSubscriberRecordLocked(const sptr<IRemot
             eventSubscribers_.erase(event);
         }
     }
+    ScheduleCompaction();
 
     return ERR_OK;
 }
 
+void CommonEventSubscriberManager::RemoveSubscriberRecordsLocked(
+    const std::function<bool(const SubscriberRecordPtr &)> &match, std::vector<SubscriberRecordPtr> &removed)
+{
+    // one pass over the flat list keeps the order of the survivors
+    auto kept = subscribers_.begin();
+    for (auto it = subscribers_.begin(); it != subscribers_.end(); ++it) {
+        if (*it != nullptr && match(*it)) {
+            removed.emplace_back(std::move(*it));
+            continue;
+        }
+        if (kept != it) {
+            *kept = std::move(*it);
+        }
+        ++kept;
+    }
+    subscribers_.erase(kept, subscribers_.end());
+    if (removed.empty()) {
+        return;
+    }
+
+    std::unordered_set<std::string> events;
+    std::unordered_set<const EventSubscriberRecord *> removedRecords;
+    for (const auto &record : removed) {
+        removedRecords.emplace(record.get());
+        RemoveFrozenEventsBySubscriber(record);
+        subscriberQuota_.Remove(record->eventRecordInfo.pid, record->eventRecordInfo.uid);
+        listenerIndex_.erase(record->commonEventListener.GetRefPtr());
+        RemovePrefixSubscribers(record->eventSubscribeInfo->GetMatchingSkills().GetEventPrefixes(), record);
+        for (const auto &event : record->eventSubscribeInfo->GetMatchingSkills().GetEventsRef()) {
+            events.emplace(event);
+        }
+    }
+    // each event list is rewritten once however many of its subscribers are removed, the match is not asked again
+    // since a listener may have died in between
+    for (const auto &event : events) {
+        auto it = eventSubscribers_.find(event);
+        if (it == eventSubscribers_.end()) {
+            continue;
+        }
+        auto &vec = it->second;
+        vec.erase(std::remove_if(vec.begin(), vec.end(), [&removedRecords](const SubscriberRecordPtr &record) {
+            return record == nullptr || record->commonEventListener == nullptr ||
+                removedRecords.count(record.get()) != 0;
+        }), vec.end());
+        if (vec.empty()) {
+            eventSubscribers_.erase(it);
+        }
+    }
+    ScheduleCompaction();
+}
+
 
 void CommonEventSubscriberManager::InsertEventSubscribers(const std::vector<std::string> &events,
     const SubscriberRecordPtr &record)
@@ -438,6 +823,22 @@ void CommonEventSubscriberManager::RemoveEventSubscribers(const std::vector<std:
     }
 }
 
+void CommonEventSubscriberManager::InsertPrefixSubscribers(const std::vector<std::string> &prefixes,
+    const SubscriberRecordPtr &record)
+{
+    for (const auto &prefix : prefixes) {
+        prefixSubscribers_.Insert(prefix, record);
+    }
+}
+
+void CommonEventSubscriberManager::RemovePrefixSubscribers(const std::vector<std::string> &prefixes,
+    const SubscriberRecordPtr &record)
+{
+    for (const auto &prefix : prefixes) {
+        prefixSubscribers_.Remove(prefix, record);
+    }
+}
+
 bool CommonEventSubscriberManager::CheckSubscriberByUserId(
     const int32_t &subscriberUserId, const bool &isSystemApp, const int32_t &userId)
 {
@@ -496,48 +897,96 @@ void CommonEventSubscriberManager::GetSubscriberRecordsByWantLocked(const Common
     std::vector<SubscriberRecordPtr> &records)
 {
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    if (eventSubscribers_.size() <= 0) {
-        return;
-    }
-    auto recordsItem = eventSubscribers_.find(eventRecord.commonEventData->GetWant().GetAction());
-    if (recordsItem == eventSubscribers_.end()) {
+    if (eventSubscribers_.size() <= 0 && prefixSubscribers_.Empty()) {
         return;
     }
+    const std::string &action = eventRecord.commonEventData->GetWant().GetAction();
     bool isSystemApp = (eventRecord.eventRecordInfo.isSystemApp || eventRecord.eventRecordInfo.isSubsystem) &&
         !eventRecord.eventRecordInfo.isProxy;
-    auto bundleName = eventRecord.eventRecordInfo.bundleName;
-    auto uid = eventRecord.eventRecordInfo.uid;
 
-    for (auto it = (recordsItem->second).begin(); it != (recordsItem->second).end(); it++) {
-        SubscriberRecordPtr subscriberRecord = *it;
-        auto subscriberUid = subscriberRecord->eventRecordInfo.uid;
-        auto subscriberUserId = subscriberRecord->eventSubscribeInfo->GetUserId();
-        auto subscriberBundleName = subscriberRecord->eventRecordInfo.bundleName;
-        if (subscriberRecord->eventSubscribeInfo == nullptr) {
-            continue;
-        }
-        if (!subscriberRecord->eventSubscribeInfo->GetMatchingSkills().Match(eventRecord.commonEventData->GetWant())) {
-            continue;
-        }
-        if (!CheckSubscriberByUserId(subscriberUserId, isSystemApp, eventRecord.userId)) {
-            continue;
+    auto recordsItem = eventSubscribers_.find(action);
+    if (recordsItem != eventSubscribers_.end()) {
+        for (const auto &subscriberRecord : recordsItem->second) {
+            CollectSubscriberRecord(subscriberRecord, eventRecord, isSystemApp, records);
         }
-        if (!CheckSubscriberPermission(subscriberRecord, eventRecord)) {
-            continue;
-        }
-        if (!CheckWhetherIsAppIndexSubscribed(subscriberRecord, eventRecord)) {
-            continue;
+    }
+    if (prefixSubscribers_.Empty()) {
+        return;
+    }
+
+    std::vector<SubscriberRecordPtr> prefixRecords;
+    std::unordered_set<const EventSubscriberRecord *> visited;
+    prefixSubscribers_.ForEachMatch(action,
+        [&action, &prefixRecords, &visited](const SubscriberRecordPtr &subscriberRecord) {
+        const MatchingSkills &skills = subscriberRecord->eventSubscribeInfo->GetMatchingSkills();
+        // exact subscriptions are already visited above
+        if (skills.HasEvent(action)) {
+            return;
         }
-        if (!CheckPublisherWhetherMatched(subscriberRecord, eventRecord)) {
-            continue;
+        // a record is visited once for each of its prefixes matching the action
+        if (skills.CountEventPrefixes() > 1 && !visited.insert(subscriberRecord.get()).second) {
+            return;
         }
-        if (!CheckSubscriberWhetherMatched(subscriberRecord, eventRecord)) {
+        prefixRecords.emplace_back(subscriberRecord);
+    });
+    for (const auto &subscriberRecord : prefixRecords) {
+        if (!CheckPrefixSubscriberPermission(subscriberRecord, eventRecord)) {
             continue;
         }
-        SubscribeScreenEventToBlackListApp(eventRecord, subscriberBundleName, subscriberUid, records, subscriberRecord);
+        CollectSubscriberRecord(subscriberRecord, eventRecord, isSystemApp, records);
     }
 }
 
+void CommonEventSubscriberManager::CollectSubscriberRecord(const SubscriberRecordPtr &subscriberRecord,
+    const CommonEventRecord &eventRecord, bool isSystemApp, std::vector<SubscriberRecordPtr> &records)
+{
+    if (subscriberRecord->eventSubscribeInfo == nullptr) {
+        return;
+    }
+    auto subscriberUid = subscriberRecord->eventRecordInfo.uid;
+    auto subscriberUserId = subscriberRecord->eventSubscribeInfo->GetUserId();
+    auto subscriberBundleName = subscriberRecord->eventRecordInfo.bundleName;
+    if (!subscriberRecord->eventSubscribeInfo->GetMatchingSkills().Match(eventRecord.commonEventData->GetWant())) {
+        return;
+    }
+    if (!CheckSubscriberByUserId(subscriberUserId, isSystemApp, eventRecord.userId)) {
+        return;
+    }
+    if (!CheckSubscriberPermission(subscriberRecord, eventRecord)) {
+        return;
+    }
+    if (!CheckWhetherIsAppIndexSubscribed(subscriberRecord, eventRecord)) {
+        return;
+    }
+    if (!CheckPublisherWhetherMatched(subscriberRecord, eventRecord)) {
+        return;
+    }
+    if (!CheckSubscriberWhetherMatched(subscriberRecord, eventRecord)) {
+        return;
+    }
+    SubscribeScreenEventToBlackListApp(eventRecord, subscriberBundleName, subscriberUid, records, subscriberRecord);
+}
+
+bool CommonEventSubscriberManager::CheckPrefixSubscriberPermission(const SubscriberRecordPtr &subscriberRecord,
+    const CommonEventRecord &eventRecord)
+{
+    // a prefix subscriber does not know the event names it receives, so custom events of other applications
+    // are only visible to system subscribers
+    if (subscriberRecord->eventRecordInfo.isSystemApp || subscriberRecord->eventRecordInfo.isSubsystem) {
+        return true;
+    }
+    if (subscriberRecord->eventRecordInfo.uid == eventRecord.eventRecordInfo.uid) {
+        return true;
+    }
+    std::string event = eventRecord.commonEventData->GetWant().GetAction();
+    if (DelayedSingleton<CommonEventSupport>::GetInstance()->IsSystemEvent(event)) {
+        return true;
+    }
+    EVENT_LOGD(LOG_TAG_SUBSCRIBER, "%{public}s is not visible to prefix subscriber %{public}s", event.c_str(),
+        subscriberRecord->eventRecordInfo.subId.c_str());
+    return false;
+}
+
 bool CommonEventSubscriberManager::CheckWhetherIsAppIndexSubscribed(const SubscriberRecordPtr &subscriberRecord,
     const CommonEventRecord &eventRecord)
 {
@@ -759,21 +1208,37 @@ void CommonEventSubscriberManager::GetSubscriberRecordsByEvent(
             }
         }
     } else if (userId == ALL_USER) {
+        std::unordered_set<const EventSubscriberRecord *> visited;
         auto infoItem = eventSubscribers_.find(event);
         if (infoItem != eventSubscribers_.end()) {
             for (auto recordPtr : infoItem->second) {
                 records.emplace_back(recordPtr);
+                visited.insert(recordPtr.get());
             }
         }
+        prefixSubscribers_.ForEachMatch(event, [&records, &visited](const SubscriberRecordPtr &recordPtr) {
+            if (visited.insert(recordPtr.get()).second) {
+                records.emplace_back(recordPtr);
+            }
+        });
     } else {
+        std::unordered_set<const EventSubscriberRecord *> visited;
         auto infoItem = eventSubscribers_.find(event);
         if (infoItem != eventSubscribers_.end()) {
             for (auto recordPtr : infoItem->second) {
                 if (CheckSubscriberByUserId(recordPtr->eventSubscribeInfo->GetUserId(), true, userId)) {
                     records.emplace_back(recordPtr);
+                    visited.insert(recordPtr.get());
                 }
             }
         }
+        prefixSubscribers_.ForEachMatch(event,
+            [this, &records, &visited, userId](const SubscriberRecordPtr &recordPtr) {
+            if (CheckSubscriberByUserId(recordPtr->eventSubscribeInfo->GetUserId(), true, userId) &&
+                visited.insert(recordPtr.get()).second) {
+                records.emplace_back(recordPtr);
+            }
+        });
     }
 }
 
@@ -836,7 +1301,7 @@ void CommonEventSubscriberManager::UpdateAllFreezeInfos(const bool &freezeState,
 }
 
 void CommonEventSubscriberManager::InsertFrozenEvents(
-    const SubscriberRecordPtr &subscriberRecord, const CommonEventRecord &eventRecord)
+    const SubscriberRecordPtr &subscriberRecord, const CommonEventRecord &eventRecord, bool superseding)
 {
     EVENT_LOGD(LOG_TAG_FREEZED, "enter");
 
@@ -845,46 +1310,63 @@ void CommonEventSubscriberManager::InsertFrozenEvents(
         return;
     }
 
-    auto record = std::make_shared<CommonEventRecord>(eventRecord);
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    auto frozenRecordsItem = frozenEvents_.find(subscriberRecord->eventRecordInfo.uid);
-    if (frozenRecordsItem != frozenEvents_.end()) {
-        auto eventRecordsItem = frozenRecordsItem->second.find(*subscriberRecord);
-        if (eventRecordsItem != frozenRecordsItem->second.end()) {
-            eventRecordsItem->second.emplace_back(record);
-            time_t backRecordTime = mktime(&eventRecordsItem->second.back()->recordTime);
-            time_t frontRecordTime = mktime(&eventRecordsItem->second.front()->recordTime);
-            time_t timeDiff = backRecordTime - frontRecordTime;
-            if (timeDiff > FREEZE_EVENT_TIMEOUT) {
-                eventRecordsItem->second.erase(eventRecordsItem->second.begin());
-            }
-        } else {
-            std::vector<EventRecordPtr> EventRecords;
-            EventRecords.emplace_back(record);
-            frozenRecordsItem->second[*subscriberRecord] = EventRecords;
+    // proxy subscribers of every uid share the undefined pid, so the uid is part of the key
+    const EventRecordInfo &recordInfo = subscriberRecord->eventRecordInfo;
+    std::vector<EventRecordPtr> &eventRecords =
+        frozenEvents_[FrozenProcessKey(recordInfo.pid, recordInfo.uid)][*subscriberRecord];
+    frozenPids_[recordInfo.uid].emplace(recordInfo.pid);
+    const std::shared_ptr<CommonEventData> &commonEventData = eventRecord.commonEventData;
+    if (commonEventData != nullptr && !eventRecords.empty() &&
+        eventRecords.back()->commonEventData == commonEventData) {
+        EVENT_LOGD(LOG_TAG_FREEZED, "event is frozen already");
+        return;
+    }
+    if (superseding && commonEventData != nullptr) {
+        // at most one frozen event per action is kept, the replay only needs the latest
+        const std::string &action = commonEventData->GetWant().GetAction();
+        auto item = std::find_if(eventRecords.begin(), eventRecords.end(), [&action](const EventRecordPtr &record) {
+            return record->commonEventData != nullptr && record->commonEventData->GetWant().GetAction() == action;
+        });
+        if (item != eventRecords.end()) {
+            eventRecords.erase(item);
+        }
+    }
+
+    EventRecordPtr record = lastFrozenRecord_.lock();
+    if (commonEventData == nullptr || record == nullptr || record->commonEventData != commonEventData) {
+        record = std::make_shared<CommonEventRecord>(eventRecord);
+        lastFrozenRecord_ = record;
+    }
+    eventRecords.emplace_back(std::move(record));
+    if (eventRecords.size() > 1) {
+        time_t backRecordTime = mktime(&eventRecords.back()->recordTime);
+        time_t frontRecordTime = mktime(&eventRecords.front()->recordTime);
+        time_t timeDiff = backRecordTime - frontRecordTime;
+        if (timeDiff > FREEZE_EVENT_TIMEOUT) {
+            eventRecords.erase(eventRecords.begin());
         }
-    } else {
-        std::map<EventSubscriberRecord, std::vector<EventRecordPtr>> frozenRecords;
-        std::vector<EventRecordPtr> EventRecords;
-        EventRecords.emplace_back(record);
-        frozenRecords[*subscriberRecord] = EventRecords;
-        frozenEvents_[subscriberRecord->eventRecordInfo.uid] = frozenRecords;
     }
 }
 
-std::map<EventSubscriberRecord, std::vector<EventRecordPtr>> CommonEventSubscriberManager::GetFrozenEvents(
-    const uid_t &uid)
+std::unordered_map<pid_t, FrozenRecords> CommonEventSubscriberManager::GetFrozenEvents(const uid_t &uid)
 {
     EVENT_LOGD(LOG_TAG_FREEZED, "enter");
 
-    std::map<EventSubscriberRecord, std::vector<EventRecordPtr>> frozenEvents;
+    std::unordered_map<pid_t, FrozenRecords> frozenEvents;
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    auto infoItem = frozenEvents_.find(uid);
-    if (infoItem != frozenEvents_.end()) {
-        frozenEvents = infoItem->second;
+    auto pidsItem = frozenPids_.find(uid);
+    if (pidsItem == frozenPids_.end()) {
+        return frozenEvents;
+    }
+    for (pid_t pid : pidsItem->second) {
+        auto infoItem = frozenEvents_.find(FrozenProcessKey(pid, uid));
+        if (infoItem != frozenEvents_.end()) {
+            frozenEvents.emplace(pid, std::move(infoItem->second));
+            frozenEvents_.erase(infoItem);
+        }
     }
-
-    RemoveFrozenEvents(uid);
+    frozenPids_.erase(pidsItem);
 
     return frozenEvents;
 }
@@ -892,112 +1374,71 @@ std::map<EventSubscriberRecord, std::vector<EventRecordPtr>> CommonEventSubscrib
 std::unordered_map<uid_t, FrozenRecords> CommonEventSubscriberManager::GetAllFrozenEvents()
 {
     EVENT_LOGD(LOG_TAG_FREEZED, "enter");
+    std::unordered_map<uid_t, FrozenRecords> frozenEvents;
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    return frozenEvents_;
-}
-
-void CommonEventSubscriberManager::RemoveFrozenEvents(const uid_t &uid)
-{
-    EVENT_LOGD(LOG_TAG_FREEZED, "enter");
-    auto infoItem = frozenEvents_.find(uid);
-    if (infoItem != frozenEvents_.end()) {
-        frozenEvents_.erase(uid);
-    }
-}
-
-void CommonEventSubscriberManager::RemoveFrozenEventsBySubscriber(const SubscriberRecordPtr &subscriberRecord)
-{
-    EVENT_LOGD(LOG_TAG_FREEZED, "enter");
-
-    auto frozenRecordsItem = frozenEvents_.find(subscriberRecord->eventRecordInfo.uid);
-    if (frozenRecordsItem != frozenEvents_.end()) {
-        auto eventRecordsItems = frozenRecordsItem->second.find(*subscriberRecord);
-        if (eventRecordsItems != frozenRecordsItem->second.end()) {
-            frozenRecordsItem->second.erase(*subscriberRecord);
-        }
+    for (const auto &[key, frozenRecords] : frozenEvents_) {
+        frozenEvents[key.second].insert(frozenRecords.begin(), frozenRecords.end());
     }
+    return frozenEvents;
 }
 
-void CommonEventSubscriberManager::InsertFrozenEventsMap(
-    const SubscriberRecordPtr &subscriberRecord, const CommonEventRecord &eventRecord)
+FrozenRecords CommonEventSubscriberManager::GetFrozenEventsByPid(const pid_t &pid)
 {
     EVENT_LOGD(LOG_TAG_FREEZED, "enter");
 
-    if (subscriberRecord == nullptr) {
-        EVENT_LOGE(LOG_TAG_FREEZED, "subscriberRecord is null");
-        return;
+    FrozenRecords frozenRecords;
+    if (pid <= 0) {
+        // proxy subscribers have no process of their own, they are unfrozen with their uid
+        return frozenRecords;
     }
-
-    auto record = std::make_shared<CommonEventRecord>(eventRecord);
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    auto frozenRecordsItem = frozenEventsMap_.find(subscriberRecord->eventRecordInfo.pid);
-    if (frozenRecordsItem != frozenEventsMap_.end()) {
-        auto eventRecordsItem = frozenRecordsItem->second.find(*subscriberRecord);
-        if (eventRecordsItem != frozenRecordsItem->second.end()) {
-            eventRecordsItem->second.emplace_back(record);
-            time_t backRecordTime = mktime(&eventRecordsItem->second.back()->recordTime);
-            time_t frontRecordTime = mktime(&eventRecordsItem->second.front()->recordTime);
-            time_t timeDiff = backRecordTime - frontRecordTime;
-            if (timeDiff > FREEZE_EVENT_TIMEOUT) {
-                eventRecordsItem->second.erase(eventRecordsItem->second.begin());
-            }
-        } else {
-            std::vector<EventRecordPtr> EventRecords;
-            EventRecords.emplace_back(record);
-            frozenRecordsItem->second[*subscriberRecord] = EventRecords;
-        }
-    } else {
-        std::map<EventSubscriberRecord, std::vector<EventRecordPtr>> frozenRecords;
-        std::vector<EventRecordPtr> EventRecords;
-        EventRecords.emplace_back(record);
-        frozenRecords[*subscriberRecord] = EventRecords;
-        frozenEventsMap_[subscriberRecord->eventRecordInfo.pid] = frozenRecords;
+    auto infoItem = frozenEvents_.lower_bound(FrozenProcessKey(pid, 0));
+    while (infoItem != frozenEvents_.end() && infoItem->first.first == pid) {
+        FrozenRecords records = TakeFrozenProcessLocked(infoItem++);
+        frozenRecords.merge(records);
     }
+    return frozenRecords;
 }
 
-std::map<EventSubscriberRecord, std::vector<EventRecordPtr>> CommonEventSubscriberManager::GetFrozenEventsMapByPid(
-    const pid_t &pid)
+FrozenProcessRecords CommonEventSubscriberManager::TakeAllFrozenEvents()
 {
     EVENT_LOGD(LOG_TAG_FREEZED, "enter");
 
-    std::map<EventSubscriberRecord, std::vector<EventRecordPtr>> frozenEvents;
+    FrozenProcessRecords frozenEvents;
     std::lock_guard<ffrt::mutex> lock(mutex_);
-    auto infoItem = frozenEventsMap_.find(pid);
-    if (infoItem != frozenEventsMap_.end()) {
-        frozenEvents = infoItem->second;
-    }
-
-    RemoveFrozenEventsMapByPid(pid);
-
+    frozenEvents.swap(frozenEvents_);
+    frozenPids_.clear();
     return frozenEvents;
 }
 
-std::unordered_map<pid_t, FrozenRecords> CommonEventSubscriberManager::GetAllFrozenEventsMap()
+FrozenRecords CommonEventSubscriberManager::TakeFrozenProcessLocked(FrozenProcessRecords::iterator item)
 {
-    EVENT_LOGD(LOG_TAG_FREEZED, "enter");
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    return frozenEventsMap_;
-}
-
-void CommonEventSubscriberManager::RemoveFrozenEventsMapByPid(const pid_t &pid)
-{
-    EVENT_LOGD(LOG_TAG_FREEZED, "enter");
-    auto infoItem = frozenEventsMap_.find(pid);
-    if (infoItem != frozenEventsMap_.end()) {
-        frozenEventsMap_.erase(pid);
+    auto [pid, uid] = item->first;
+    FrozenRecords frozenRecords = std::move(item->second);
+    frozenEvents_.erase(item);
+
+    auto pidsItem = frozenPids_.find(uid);
+    if (pidsItem != frozenPids_.end()) {
+        pidsItem->second.erase(pid);
+        if (pidsItem->second.empty()) {
+            frozenPids_.erase(pidsItem);
+        }
     }
+    return frozenRecords;
 }
 
-void CommonEventSubscriberManager::RemoveFrozenEventsMapBySubscriber(const SubscriberRecordPtr &subscriberRecord)
+void CommonEventSubscriberManager::RemoveFrozenEventsBySubscriber(const SubscriberRecordPtr &subscriberRecord)
 {
     EVENT_LOGD(LOG_TAG_FREEZED, "enter");
 
-    auto frozenRecordsItem = frozenEventsMap_.find(subscriberRecord->eventRecordInfo.pid);
-    if (frozenRecordsItem != frozenEventsMap_.end()) {
-        auto eventRecordsItems = frozenRecordsItem->second.find(*subscriberRecord);
-        if (eventRecordsItems != frozenRecordsItem->second.end()) {
-            frozenRecordsItem->second.erase(*subscriberRecord);
-        }
+    const EventRecordInfo &recordInfo = subscriberRecord->eventRecordInfo;
+    auto frozenRecordsItem = frozenEvents_.find(FrozenProcessKey(recordInfo.pid, recordInfo.uid));
+    if (frozenRecordsItem == frozenEvents_.end()) {
+        return;
+    }
+    frozenRecordsItem->second.erase(*subscriberRecord);
+    if (frozenRecordsItem->second.empty()) {
+        TakeFrozenProcessLocked(frozenRecordsItem);
     }
 }
 
@@ -1011,17 +1452,27 @@ void CommonEventSubscriberManager::SendSubscriberExceedMaximumHiSysEvent(int32_t
     EventReport::SendHiSysEvent(SUBSCRIBER_EXCEED_MAXIMUM, eventInfo);
 }
 
+void CommonEventSubscriberManager::ReloadSubscriberLimits()
+{
+    uint32_t maxSubscriberNum = GetUintParameter(SUBSCRIBER_LIMIT_PARAM, DEFAULT_MAX_SUBSCRIBER_NUM_ALL_APP);
+    uint32_t maxSubscriberNumPerUid = GetUintParameter(SUBSCRIBER_LIMIT_PER_UID_PARAM,
+        DEFAULT_MAX_SUBSCRIBER_NUM_PER_UID);
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    subscriberQuota_.SetLimits(maxSubscriberNum, maxSubscriberNumPerUid);
+    EVENT_LOGI(LOG_TAG_SUBSCRIBER, "subscriber limit %{public}u, per uid %{public}u", maxSubscriberNum,
+        maxSubscriberNumPerUid);
+}
+
 bool CommonEventSubscriberManager::CheckSubscriberCountReachedMaxinum()
 {
-    uint32_t subscriberCount = subscribers_.size();
-    uint32_t maxSubscriberNum = GetUintParameter("hiviewdfx.ces.subscriber_limit",
-        DEFAULT_MAX_SUBSCRIBER_NUM_ALL_APP);
-    if (subscriberCount == (uint32_t)(maxSubscriberNum * WARNING_REPORT_PERCENTAGE)) {
+    // the uid quota was checked by the caller
+    SubscriberQuota::Result result = subscriberQuota_.Check(0, false);
+    if (result == SubscriberQuota::WARNING) {
         EVENT_LOGW(LOG_TAG_SUBSCRIBER, "subscribers reaches the alarm threshold");
         PrintSubscriberCounts(GetTopSubscriberCounts());
         return false;
     }
-    if (subscriberCount == maxSubscriberNum) {
+    if (result == SubscriberQuota::LIMIT_REACHED) {
         EVENT_LOGE(LOG_TAG_SUBSCRIBER, "subscribers reaches the maxinum");
         PrintSubscriberCounts(GetTopSubscriberCounts());
         return true;
@@ -1031,24 +1482,7 @@ bool CommonEventSubscriberManager::CheckSubscriberCountReachedMaxinum()
 
 std::vector<std::pair<pid_t, uint32_t>> CommonEventSubscriberManager::GetTopSubscriberCounts(size_t topNum)
 {
-    if (subscriberCounts_.empty()) {
-        return {};
-    }
-
-    std::vector<std::pair<pid_t, uint32_t>> items;
-    items.reserve(subscriberCounts_.size());
-    for (const auto& [pid, count] : subscriberCounts_) {
-        items.emplace_back(pid, count);
-    }
-
-    size_t k = std::min(topNum, items.size());
-    std::partial_sort(items.begin(), items.begin() + k, items.end(),
-        [](const auto& a, const auto& b) {
-            return a.second > b.second;
-        });
-
-    items.resize(k);
-    return items;
+    return subscriberQuota_.GetTopPids(topNum);
 }
 
 void CommonEventSubscriberManager::PrintSubscriberCounts(std::vector<std::pair<pid_t, uint32_t>> vtSubscriberCounts)
@@ -1070,12 +1504,18 @@ std::map<pid_t, SubscriberRecordPtr> CommonEventSubscriberManager::GetTopSubscri
         return topRecordsMap;
     }
  
+    std::unordered_set<pid_t> pids;
     for (const auto& [pid, count] : topSubscriberCounts) {
-        for (const auto& subscriber : subscribers_) {
-            if (subscriber != nullptr && subscriber->eventRecordInfo.pid == pid) {
-                topRecordsMap[pid] = subscriber;
-                break;
-            }
+        pids.emplace(pid);
+    }
+    // one pass for all the pids, stopped as soon as each has a record
+    for (const auto& subscriber : subscribers_) {
+        if (subscriber == nullptr || pids.erase(subscriber->eventRecordInfo.pid) == 0) {
+            continue;
+        }
+        topRecordsMap[subscriber->eventRecordInfo.pid] = subscriber;
+        if (pids.empty()) {
+            break;
         }
     }
  
@@ -1114,7 +1554,7 @@ std::string CommonEventSubscriberManager::FormatTopSubscribersInfo(
                   << ", bundle_name=" << subscriber->eventRecordInfo.bundleName;
  
         if (subscriber->eventSubscribeInfo != nullptr) {
-            std::vector<std::string> events = subscriber->eventSubscribeInfo->GetMatchingSkills().GetEvents();
+            const std::vector<std::string> &events = subscriber->eventSubscribeInfo->GetMatchingSkills().GetEventsRef();
             infoStream << ", events=" << FormatEventsString(events);
         }
         infoStream << "\n";
@@ -1154,50 +1594,109 @@ void CommonEventSubscriberManager::ReportTopSubscribersInfoHiSysEvent(
         result, killedPid, processName.c_str(), uid, msg.c_str(), subscriber->eventRecordInfo.bundleName.c_str());
 }
 
-void CommonEventSubscriberManager::CompactSubscriberDataStructures()
+size_t CommonEventSubscriberManager::FragmentationStats::GetSlackBytes() const
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
-    EVENT_LOGI(LOG_TAG_SUBSCRIBER, "Start memory fragmentation optimization, current subscriber count: %{public}zu",
-        subscribers_.size());
+    return vectorSlack * sizeof(SubscriberRecordPtr) + idleBuckets * sizeof(void *);
+}
 
-    auto startTime = std::chrono::high_resolution_clock::now();
+CommonEventSubscriberManager::FragmentationStats CommonEventSubscriberManager::MeasureFragmentationLocked() const
+{
+    // one visit per event, not per subscriber, the event count stays in the hundreds
+    FragmentationStats stats;
+    stats.vectorSlack = subscribers_.capacity() - subscribers_.size();
+    for (const auto &[event, records] : eventSubscribers_) {
+        stats.vectorSlack += records.capacity() - records.size();
+        if (records.empty()) {
+            stats.emptyEvents++;
+        }
+    }
+    size_t neededBuckets = static_cast<size_t>(eventSubscribers_.size() / eventSubscribers_.max_load_factor()) + 1;
+    if (eventSubscribers_.bucket_count() > neededBuckets * COMPACT_BUCKET_FACTOR) {
+        stats.idleBuckets = eventSubscribers_.bucket_count() - neededBuckets;
+    }
+    return stats;
+}
 
-    std::vector<SubscriberRecordPtr> compactedSubscribers;
-    compactedSubscribers.reserve(subscribers_.size());
+void CommonEventSubscriberManager::ScheduleCompaction()
+{
+    if (compactScheduled_.exchange(true)) {
+        return;
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(compactMutex_);
+        if (compactQueue_ == nullptr) {
+            compactQueue_ = std::make_shared<ffrt::queue>("CesSubscriberCompact",
+                ffrt::queue_attr().qos(ffrt::qos_background));
+        }
+        // removals come in bursts when a process dies, wait for the burst to settle
+        compactQueue_->submit([this]() { RunCompaction(); },
+            ffrt::task_attr().delay(COMPACT_DELAY_TIME));
+    }
+}
 
-    std::unordered_map<std::string, std::vector<SubscriberRecordPtr>> compactedEventSubscribers;
-    std::unordered_map<pid_t, uint32_t> compactedSubscriberCounts;
+void CommonEventSubscriberManager::RunCompaction()
+{
+    if (!CompactStep()) {
+        compactScheduled_ = false;
+        return;
+    }
+    // one slice per task, publishes take the subscriber lock in between
+    std::lock_guard<ffrt::mutex> lock(compactMutex_);
+    if (compactQueue_ != nullptr) {
+        compactQueue_->submit([this]() { RunCompaction(); });
+    }
+}
 
-    for (const auto& subscriber : subscribers_) {
-        if (subscriber == nullptr || subscriber->commonEventListener == nullptr) {
-            continue;
+bool CommonEventSubscriberManager::CompactStep()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!compacting_) {
+        FragmentationStats stats = MeasureFragmentationLocked();
+        if (stats.GetSlackBytes() < COMPACT_MIN_SLACK_BYTES && stats.emptyEvents == 0) {
+            return false;
         }
-        auto newRecord = std::make_shared<EventSubscriberRecord>();
-        newRecord->isFreeze = subscriber->isFreeze;
-        newRecord->recordTime = subscriber->recordTime;
-        newRecord->freezeTime = subscriber->freezeTime;
-        newRecord->eventRecordInfo = subscriber->eventRecordInfo;
-        newRecord->commonEventListener = subscriber->commonEventListener;
-        if (subscriber->eventSubscribeInfo != nullptr) {
-            newRecord->eventSubscribeInfo = std::make_shared<CommonEventSubscribeInfo>(
-                *(subscriber->eventSubscribeInfo));
+        compactBefore_ = stats;
+        compactEvents_.clear();
+        for (const auto &[event, records] : eventSubscribers_) {
+            if (records.empty() || records.capacity() - records.size() >= COMPACT_MIN_VECTOR_SLACK) {
+                compactEvents_.emplace_back(event);
+            }
+        }
+        compacting_ = true;
+        return true;
+    }
+
+    size_t budget = COMPACT_STEP_EVENTS;
+    while (!compactEvents_.empty() && budget > 0) {
+        auto it = eventSubscribers_.find(compactEvents_.back());
+        compactEvents_.pop_back();
+        budget--;
+        if (it == eventSubscribers_.end()) {
+            continue;
         }
-        compactedSubscribers.push_back(newRecord);
-        pid_t pid = newRecord->eventRecordInfo.pid;
-        compactedSubscriberCounts[pid]++;
-        std::vector<std::string> events = newRecord->eventSubscribeInfo->GetMatchingSkills().GetEvents();
-        for (const auto& event : events) {
-            compactedEventSubscribers[event].push_back(newRecord);
+        if (it->second.empty()) {
+            eventSubscribers_.erase(it);
+        } else {
+            it->second.shrink_to_fit();
         }
     }
-    subscribers_.swap(compactedSubscribers);
-    eventSubscribers_.swap(compactedEventSubscribers);
-    subscriberCounts_.swap(compactedSubscriberCounts);
-    hasCompacted_ = true;
-    auto endTime = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
-    EVENT_LOGI(LOG_TAG_SUBSCRIBER, "Memory fragmentation optimization completed. Copied subscriber count: %{public}zu,"
-        "elapsed time: %{public}lld ms", compactedSubscribers.size(), duration.count());
+    if (!compactEvents_.empty()) {
+        return true;
+    }
+
+    // the last slice moves the flat list and the buckets, each is a single reallocation
+    subscribers_.shrink_to_fit();
+    if (compactBefore_.idleBuckets != 0) {
+        eventSubscribers_.rehash(0);
+    }
+    compactEvents_.shrink_to_fit();
+    compactAfter_ = MeasureFragmentationLocked();
+    compactRuns_++;
+    compacting_ = false;
+    EVENT_LOGI(LOG_TAG_SUBSCRIBER, "Compacted subscribers, slack %{public}zu -> %{public}zu bytes, "
+        "%{public}zu empty events removed", compactBefore_.GetSlackBytes(), compactAfter_.GetSlackBytes(),
+        compactBefore_.emptyEvents);
+    return false;
 }
 
 std::string CommonEventSubscriberManager::GetFirstLine(const std::string& path)
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dump_writer.h"
+
+#include <cerrno>
+#include <charconv>
+#include <unistd.h>
+
+#include "event_log_wrapper.h"
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+constexpr size_t BUFFER_SIZE = 16 * 1024;
+constexpr size_t NUMBER_LENGTH = 24;
+}
+
+DumpWriter::DumpWriter(int fd) : fd_(fd)
+{
+    buffer_.reserve(BUFFER_SIZE);
+}
+
+DumpWriter::DumpWriter(std::string &output) : output_(&output)
+{}
+
+DumpWriter::~DumpWriter()
+{
+    Flush();
+}
+
+DumpWriter &DumpWriter::Append(std::string_view text)
+{
+    if (output_ != nullptr) {
+        output_->append(text);
+        return *this;
+    }
+    if (buffer_.size() + text.size() > BUFFER_SIZE) {
+        Flush();
+    }
+    buffer_.append(text);
+    return *this;
+}
+
+DumpWriter &DumpWriter::Append(int64_t value)
+{
+    char number[NUMBER_LENGTH];
+    auto result = std::to_chars(number, number + NUMBER_LENGTH, value);
+    return Append(std::string_view(number, result.ptr - number));
+}
+
+bool DumpWriter::Flush()
+{
+    if (output_ != nullptr) {
+        return true;
+    }
+    size_t written = 0;
+    while (!failed_ && written < buffer_.size()) {
+        ssize_t ret = write(fd_, buffer_.data() + written, buffer_.size() - written);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            EVENT_LOGE(LOG_TAG_CES, "write dump failed, errno %{public}d", errno);
+            failed_ = true;
+            break;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    buffer_.clear();
+    return !failed_;
+}
+}  // namespace EventFwk
+}  // namespace OHOS
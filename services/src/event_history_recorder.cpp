@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "event_history_recorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+
+#include "securec.h"
+#include "system_time.h"
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+constexpr char UNKNOWN_STRING[] = "<unknown>";
+constexpr size_t TIME_LENGTH = 32;
+constexpr int64_t MS_PER_SECOND = 1000;
+constexpr double US_PER_MS = 1000.0;
+const char *DELIVERY_STATE_NAMES[] = { "PENDING", "DELIVERED", "SKIPPED", "TIMEOUT" };
+
+std::string FormatCost(uint32_t us)
+{
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(3) << (static_cast<double>(us) / US_PER_MS) << "ms";
+    return stream.str();
+}
+
+std::string FormatTime(int64_t ms)
+{
+    time_t seconds = static_cast<time_t>(ms / MS_PER_SECOND);
+    struct tm local {};
+    if (localtime_r(&seconds, &local) == nullptr) {
+        return std::to_string(ms);
+    }
+    char buffer[TIME_LENGTH] = {0};
+    strftime(buffer, sizeof(buffer), "%Y%m%d %H:%M:%S", &local);
+    std::ostringstream stream;
+    stream << buffer << "." << std::setw(3) << std::setfill('0') << (ms % MS_PER_SECOND);
+    return stream.str();
+}
+}
+
+EventHistoryRecorder::EventHistoryRecorder()
+{}
+
+EventHistoryRecorder::~EventHistoryRecorder()
+{}
+
+void EventHistoryRecorder::Record(const OrderedEventRecord &record)
+{
+    if (record.commonEventData == nullptr || record.publishInfo == nullptr) {
+        return;
+    }
+
+    Entry entry {};
+    entry.finishTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    entry.event = Intern(record.commonEventData->GetWant().GetAction());
+    entry.bundleName = Intern(record.eventRecordInfo.bundleName);
+    entry.pid = static_cast<int32_t>(record.eventRecordInfo.pid);
+    entry.uid = static_cast<int32_t>(record.eventRecordInfo.uid);
+    entry.userId = record.userId;
+    entry.code = record.commonEventData->GetCode();
+    entry.costUs = record.publishTime > 0 ? ToCostUs(SystemTime::GetNowSysTimeUs() - record.publishTime) : 0;
+    entry.fanOut = static_cast<uint32_t>(record.receivers.size());
+    entry.flags = (record.publishInfo->IsSticky() ? STICKY : 0) | (record.publishInfo->IsOrdered() ? ORDERED : 0) |
+        (record.eventRecordInfo.isSystemApp ? SYSTEM_APP : 0) | (record.isSystemEvent ? SYSTEM_EVENT : 0) |
+        (record.resultAbort ? RESULT_ABORT : 0) | (record.resultTo != nullptr ? HAS_LAST_SUBSCRIBER : 0);
+    for (size_t i = 0; i < record.receivers.size() && i < record.deliveryState.size(); ++i) {
+        uint8_t deliveryState = record.deliveryState[i];
+        if (deliveryState <= OrderedEventRecord::TIMEOUT) {
+            entry.stateCount[deliveryState]++;
+        }
+        if (i >= MAX_RECEIVER_NUM || record.receivers[i] == nullptr) {
+            continue;
+        }
+        ReceiverEntry &receiver = entry.receivers[entry.receiverNum++];
+        receiver.bundleName = Intern(record.receivers[i]->eventRecordInfo.bundleName);
+        receiver.pid = static_cast<int32_t>(record.receivers[i]->eventRecordInfo.pid);
+        receiver.costUs = i < record.deliveryCost.size() ? record.deliveryCost[i] : 0;
+        receiver.state = deliveryState;
+    }
+
+    uint64_t words[WORD_NUM] = {0};
+    if (memcpy_s(words, sizeof(words), &entry, sizeof(entry)) != EOK) {
+        return;
+    }
+    uint64_t index = next_.fetch_add(1, std::memory_order_relaxed);
+    Slot &slot = slots_[index % CAPACITY];
+    uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    // give up on the slot if a writer is still on it or a newer entry already landed
+    if ((sequence & 1) != 0 || sequence > index * 2 ||
+        !slot.sequence.compare_exchange_strong(sequence, index * 2 + 1, std::memory_order_relaxed)) {
+        return;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < WORD_NUM; ++i) {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    slot.sequence.store(index * 2 + 2, std::memory_order_release);
+}
+
+bool EventHistoryRecorder::Load(uint64_t index, Entry &entry) const
+{
+    const Slot &slot = slots_[index % CAPACITY];
+    uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence != index * 2 + 2) {
+        return false;
+    }
+    uint64_t words[WORD_NUM] = {0};
+    for (size_t i = 0; i < WORD_NUM; ++i) {
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+        return false;
+    }
+    return memcpy_s(&entry, sizeof(entry), words, sizeof(entry)) == EOK;
+}
+
+uint32_t EventHistoryRecorder::Intern(const std::string &value)
+{
+    uint8_t bytes[STRING_WORD_NUM * sizeof(uint64_t)] = {0};
+    size_t length = std::min(value.size(), MAX_STRING_LENGTH);
+    bytes[0] = static_cast<uint8_t>(length);
+    if (length > 0 && memcpy_s(bytes + 1, sizeof(bytes) - 1, value.data(), length) != EOK) {
+        return 0;
+    }
+    uint64_t words[STRING_WORD_NUM] = {0};
+    if (memcpy_s(words, sizeof(words), bytes, sizeof(bytes)) != EOK) {
+        return 0;
+    }
+    uint64_t hash = static_cast<uint64_t>(std::hash<std::string>()(value));
+    size_t start = hash % MAX_STRING_NUM;
+    for (size_t i = 0; i < STRING_PROBE_NUM; ++i) {
+        size_t position = (start + i) % MAX_STRING_NUM;
+        StringSlot &slot = strings_[position];
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence == 0 && StoreString(slot, sequence, hash, words)) {
+            return static_cast<uint32_t>(position + 1);
+        }
+        if ((sequence & 1) != 0 || slot.hash.load(std::memory_order_relaxed) != hash) {
+            continue;
+        }
+        bool equal = true;
+        for (size_t j = 0; j < STRING_WORD_NUM && equal; ++j) {
+            equal = slot.words[j].load(std::memory_order_relaxed) == words[j];
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (equal && slot.sequence.load(std::memory_order_relaxed) == sequence) {
+            uint64_t generation = sequence / 2 - 1;
+            return static_cast<uint32_t>(generation * MAX_STRING_NUM + position + 1);
+        }
+    }
+    // the probe window is full, the home slot starts a new generation
+    StringSlot &slot = strings_[start];
+    uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    if ((sequence & 1) != 0 || !StoreString(slot, sequence, hash, words)) {
+        return 0;
+    }
+    uint64_t generation = sequence / 2;
+    return static_cast<uint32_t>(generation * MAX_STRING_NUM + start + 1);
+}
+
+bool EventHistoryRecorder::StoreString(StringSlot &slot, uint64_t sequence, uint64_t hash, const uint64_t *words)
+{
+    if (!slot.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_relaxed)) {
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.hash.store(hash, std::memory_order_relaxed);
+    for (size_t i = 0; i < STRING_WORD_NUM; ++i) {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+    return true;
+}
+
+std::string EventHistoryRecorder::GetString(uint32_t id) const
+{
+    if (id == 0) {
+        return UNKNOWN_STRING;
+    }
+    const StringSlot &slot = strings_[(id - 1) % MAX_STRING_NUM];
+    uint64_t sequence = static_cast<uint64_t>((id - 1) / MAX_STRING_NUM) * 2 + 2;
+    if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+        return UNKNOWN_STRING;
+    }
+    uint64_t words[STRING_WORD_NUM] = {0};
+    for (size_t i = 0; i < STRING_WORD_NUM; ++i) {
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+        return UNKNOWN_STRING;
+    }
+    uint8_t bytes[STRING_WORD_NUM * sizeof(uint64_t)] = {0};
+    if (memcpy_s(bytes, sizeof(bytes), words, sizeof(words)) != EOK) {
+        return UNKNOWN_STRING;
+    }
+    return std::string(reinterpret_cast<const char *>(bytes + 1), std::min<size_t>(bytes[0], MAX_STRING_LENGTH));
+}
+
+uint32_t EventHistoryRecorder::ToCostUs(int64_t costUs)
+{
+    if (costUs <= 0) {
+        return 0;
+    }
+    return static_cast<uint32_t>(std::min<int64_t>(costUs, UINT32_MAX));
+}
+
+#ifdef CEM_SUPPORT_DUMP
+void EventHistoryRecorder::DumpState(
+    const std::string &event, const int32_t &userId, std::vector<std::string> &state) const
+{
+    std::vector<std::string> infos;
+    uint64_t next = next_.load(std::memory_order_acquire);
+    uint64_t oldest = next > CAPACITY ? next - CAPACITY : 0;
+    Entry entry {};
+    for (uint64_t index = next; index > oldest; --index) {
+        if (!Load(index - 1, entry)) {
+            continue;
+        }
+        if (!event.empty() && GetString(entry.event) != event.substr(0, MAX_STRING_LENGTH)) {
+            continue;
+        }
+        if (userId != ALL_USER && entry.userId != userId) {
+            continue;
+        }
+        infos.emplace_back(DumpEntry(infos.size() + 1, entry));
+    }
+
+    if (infos.empty()) {
+        state.emplace_back("History Events:\tNo information");
+        return;
+    }
+    infos[0] = "History Events:\tTotal " + std::to_string(infos.size()) + " information\n" + infos[0];
+    state.insert(state.end(), infos.begin(), infos.end());
+}
+
+std::string EventHistoryRecorder::DumpEntry(size_t num, const Entry &entry) const
+{
+    auto boolString = [&entry](uint8_t flag) { return (entry.flags & flag) != 0 ? "true" : "false"; };
+
+    std::string info = "NO " + std::to_string(num) + "\n";
+    info.append("\tTime: ").append(FormatTime(entry.finishTime)).append("\n")
+        .append("\tEvent: ").append(GetString(entry.event)).append("\n")
+        .append("\tPID: ").append(std::to_string(entry.pid)).append("\n")
+        .append("\tUID: ").append(std::to_string(entry.uid)).append("\n")
+        .append("\tUSERID: ").append(std::to_string(entry.userId)).append("\n")
+        .append("\tBundleName: ").append(GetString(entry.bundleName)).append("\n")
+        .append("\tCode: ").append(std::to_string(entry.code)).append("\n")
+        .append("\tIsSticky: ").append(boolString(STICKY)).append("\n")
+        .append("\tIsOrdered: ").append(boolString(ORDERED)).append("\n")
+        .append("\tIsSystemApp: ").append(boolString(SYSTEM_APP)).append("\n")
+        .append("\tIsSystemEvent: ").append(boolString(SYSTEM_EVENT)).append("\n")
+        .append("\tHasLastSubscriber: ").append(boolString(HAS_LAST_SUBSCRIBER)).append("\n")
+        .append("\tResultAbort: ").append(boolString(RESULT_ABORT)).append("\n")
+        .append("\tCostTime: ").append(FormatCost(entry.costUs)).append("\n");
+
+    if (entry.fanOut == 0) {
+        info.append("\tSubscribers:\tNo information\n");
+        return info;
+    }
+    info.append("\tSubscribers:\tTotal ").append(std::to_string(entry.fanOut)).append(" subscribers (");
+    for (size_t state = 0; state <= OrderedEventRecord::TIMEOUT; ++state) {
+        info.append(state == 0 ? "" : ", ").append(DELIVERY_STATE_NAMES[state]).append(" ")
+            .append(std::to_string(entry.stateCount[state]));
+    }
+    info.append(")\n");
+    for (size_t i = 0; i < entry.receiverNum && i < MAX_RECEIVER_NUM; ++i) {
+        const ReceiverEntry &receiver = entry.receivers[i];
+        info.append("\t\tNO ").append(std::to_string(i + 1))
+            .append(" BundleName: ").append(GetString(receiver.bundleName))
+            .append(" PID: ").append(std::to_string(receiver.pid))
+            .append(" EventState: ")
+            .append(receiver.state <= OrderedEventRecord::TIMEOUT ? DELIVERY_STATE_NAMES[receiver.state] : "UNKNOWN")
+            .append(" CostTime: ").append(FormatCost(receiver.costUs)).append("\n");
+    }
+    if (entry.fanOut > entry.receiverNum) {
+        info.append("\t\t... ").append(std::to_string(entry.fanOut - entry.receiverNum)).append(" more\n");
+    }
+    return info;
+}
+#endif
+}  // namespace EventFwk
+}  // namespace OHOS
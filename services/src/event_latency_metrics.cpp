@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "event_latency_metrics.h"
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <new>
+#include <sstream>
+
+#include "system_time.h"
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+constexpr char OVERFLOW_EVENT[] = "<others>";
+constexpr uint32_t PERCENT_MEDIAN = 50;
+constexpr uint32_t PERCENT_TAIL = 99;
+constexpr uint32_t PERCENT_ALL = 100;
+constexpr double US_PER_MS = 1000.0;
+const char *STAGE_NAMES[] = { "arrival", "queue", "match", "receiver", "ordered" };
+
+std::string FormatMs(uint64_t us)
+{
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(3) << (static_cast<double>(us) / US_PER_MS) << "ms";
+    return stream.str();
+}
+}
+
+EventLatencyMetrics::EventLatencyMetrics() : overflow_(OVERFLOW_EVENT)
+{}
+
+EventLatencyMetrics::~EventLatencyMetrics()
+{
+    for (auto &slot : slots_) {
+        delete slot.load(std::memory_order_acquire);
+    }
+}
+
+void EventLatencyMetrics::Record(const std::string &event, Stage stage, int64_t costUs)
+{
+    if (stage >= STAGE_MAX) {
+        return;
+    }
+    uint64_t value = costUs > 0 ? static_cast<uint64_t>(costUs) : 0;
+    Histogram &histogram = GetSlot(event)->stages[stage];
+    histogram.buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    histogram.count.fetch_add(1, std::memory_order_relaxed);
+    uint64_t max = histogram.max.load(std::memory_order_relaxed);
+    while (value > max && !histogram.max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+}
+
+void EventLatencyMetrics::RecordSince(const std::string &event, Stage stage, int64_t startUs)
+{
+    if (startUs <= 0) {
+        return;
+    }
+    Record(event, stage, SystemTime::GetNowSysTimeUs() - startUs);
+}
+
+EventLatencyMetrics::EventSlot *EventLatencyMetrics::GetSlot(const std::string &event)
+{
+    size_t start = std::hash<std::string>()(event) % MAX_EVENT_NUM;
+    EventSlot *created = nullptr;
+    // a short probe keeps recording cheap once the table fills up
+    for (size_t i = 0; i < PROBE_NUM; ++i) {
+        std::atomic<EventSlot *> &entry = slots_[(start + i) % MAX_EVENT_NUM];
+        EventSlot *slot = entry.load(std::memory_order_acquire);
+        if (slot == nullptr) {
+            if (created == nullptr) {
+                created = new (std::nothrow) EventSlot(event);
+                if (created == nullptr) {
+                    return &overflow_;
+                }
+            }
+            if (entry.compare_exchange_strong(slot, created, std::memory_order_acq_rel)) {
+                return created;
+            }
+        }
+        // slot holds the winner of a concurrent claim or an existing event
+        if (slot->event == event) {
+            delete created;
+            return slot;
+        }
+    }
+    delete created;
+    return &overflow_;
+}
+
+size_t EventLatencyMetrics::GetBucketIndex(uint64_t value)
+{
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value);
+    }
+    size_t msb = static_cast<size_t>(63 - __builtin_clzll(value));
+    size_t sub = static_cast<size_t>(value >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+    size_t index = (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + sub;
+    return index < BUCKET_NUM ? index : BUCKET_NUM - 1;
+}
+
+uint64_t EventLatencyMetrics::GetBucketUpperBound(size_t index)
+{
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    size_t shift = index / SUB_BUCKET_COUNT - 1;
+    uint64_t sub = index % SUB_BUCKET_COUNT;
+    return ((SUB_BUCKET_COUNT + sub + 1) << shift) - 1;
+}
+
+uint64_t EventLatencyMetrics::GetPercentile(const Histogram &histogram, uint64_t count, uint32_t percent)
+{
+    uint64_t rank = (count * percent + PERCENT_ALL - 1) / PERCENT_ALL;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_NUM; ++i) {
+        seen += histogram.buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return GetBucketUpperBound(i);
+        }
+    }
+    return GetBucketUpperBound(BUCKET_NUM - 1);
+}
+
+#ifdef CEM_SUPPORT_DUMP
+void EventLatencyMetrics::DumpState(const std::string &event, std::vector<std::string> &state) const
+{
+    auto dumpSlot = [&state](const EventSlot &slot) {
+        std::string info;
+        for (size_t stage = 0; stage < STAGE_MAX; ++stage) {
+            const Histogram &histogram = slot.stages[stage];
+            uint64_t count = histogram.count.load(std::memory_order_relaxed);
+            if (count == 0) {
+                continue;
+            }
+            uint64_t max = histogram.max.load(std::memory_order_relaxed);
+            info.append("\t").append(STAGE_NAMES[stage]).append(": count=").append(std::to_string(count))
+                .append(" p50=").append(FormatMs(std::min(GetPercentile(histogram, count, PERCENT_MEDIAN), max)))
+                .append(" p99=").append(FormatMs(std::min(GetPercentile(histogram, count, PERCENT_TAIL), max)))
+                .append(" max=").append(FormatMs(max)).append("\n");
+        }
+        if (!info.empty()) {
+            state.emplace_back("Event: " + slot.event + "\n" + info);
+        }
+    };
+
+    for (const auto &entry : slots_) {
+        EventSlot *slot = entry.load(std::memory_order_acquire);
+        if (slot != nullptr && (event.empty() || slot->event == event)) {
+            dumpSlot(*slot);
+        }
+    }
+    if (event.empty()) {
+        dumpSlot(overflow_);
+    }
+}
+#endif
+}  // namespace EventFwk
+}  // namespace OHOS
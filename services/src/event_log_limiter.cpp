@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "event_log_limiter.h"
+
+#include <functional>
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+constexpr size_t EMPTY_KEY = 0;
+}
+
+EventLogLimiter::EventLogLimiter(int64_t interval) : interval_(interval)
+{}
+
+size_t EventLogLimiter::GetKey(const std::string &event)
+{
+    size_t key = std::hash<std::string>()(event);
+    return key == EMPTY_KEY ? 1 : key;
+}
+
+bool EventLogLimiter::Claim(Slot &slot, size_t current, size_t key, int64_t now)
+{
+    if (!slot.key.compare_exchange_strong(current, key)) {
+        return false;
+    }
+    // a count left by the previous owner is dropped, it went quiet for a whole interval
+    slot.windowStart.store(now);
+    slot.suppressed.store(0);
+    return true;
+}
+
+bool EventLogLimiter::CanLog(const std::string &event, int64_t now, uint32_t &suppressed)
+{
+    suppressed = 0;
+    size_t key = GetKey(event);
+    size_t first = key % SLOT_NUM;
+    Slot *expired = nullptr;
+    for (size_t probe = 0; probe < PROBE_NUM; ++probe) {
+        Slot &slot = slots_[(first + probe) % SLOT_NUM];
+        size_t current = slot.key.load();
+        if (current == EMPTY_KEY) {
+            if (Claim(slot, current, key, now)) {
+                return true;
+            }
+            current = slot.key.load();
+        }
+        if (current != key) {
+            if (expired == nullptr && now - slot.windowStart.load() >= interval_) {
+                expired = &slot;
+            }
+            continue;
+        }
+        int64_t windowStart = slot.windowStart.load();
+        if (now - windowStart >= interval_ && slot.windowStart.compare_exchange_strong(windowStart, now)) {
+            suppressed = slot.suppressed.exchange(0);
+            return true;
+        }
+        slot.suppressed.fetch_add(1);
+        return false;
+    }
+    // every probed slot is busy with another event, take one that went quiet or let the line through
+    if (expired != nullptr) {
+        Claim(*expired, expired->key.load(), key, now);
+    }
+    return true;
+}
+}  // namespace EventFwk
+}  // namespace OHOS
@@ -21,16 +21,23 @@
 #include "common_event_sticky_manager.h"
 #include "common_event_subscriber_manager.h"
 #include "common_event_support.h"
+#include "common_event_wire_format.h"
+#include "event_history_recorder.h"
+#include "event_latency_metrics.h"
 #include "event_log_wrapper.h"
 #include "event_trace_wrapper.h"
 #include "event_report.h"
 #include "hitrace_meter_adapter.h"
 #include "ipc_skeleton.h"
 #include "nlohmann/json.hpp"
+#include "ordered_event_record_pool.h"
 #include "os_account_manager_helper.h"
 #include "parameters.h"
+#include "shared_common_event_data.h"
+#include "structured_dump.h"
 #include "system_time.h"
 #include "want.h"
+#include <charconv>
 #include <climits>
 #include <cstdlib>
 #include <fstream>
@@ -74,11 +81,44 @@ InnerCommonEventManager::InnerCommonEventManager() : controlPtr_(std::make_share
     staticSubscriberManager_(std::make_shared<StaticSubscriberManager>())
 {
     supportCheckSaPermission_ = OHOS::system::GetParameter(NOTIFICATION_CES_CHECK_SA_PERMISSION, "false");
-    if (!GetJsonByFilePath(CONFIG_FILE, eventConfigJson_)) {
+    std::weak_ptr<CommonEventControlManager> weak = controlPtr_;
+    DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->SetProcessDiedCallback([weak](pid_t pid, uid_t uid) {
+        CommonEventWireFormat::RemoveClientVersion(pid, uid);
+        auto control = weak.lock();
+        if (control != nullptr) {
+            control->RemoveProcessReceivers(pid);
+        }
+    });
+}
+
+bool InnerCommonEventManager::LoadConfig()
+{
+    std::vector<nlohmann::json> configs;
+    if (!GetJsonByFilePath(CONFIG_FILE, configs)) {
         EVENT_LOGE(LOG_TAG_CES, "Failed to get config file.");
     }
+    // publishing reads the tables only, the json documents are dropped once compiled
+    auto policy = CommonEventPolicy::Compile(configs);
+    if (controlPtr_) {
+        controlPtr_->SetCoalescingEvents(policy->GetCoalescingEvents());
+        controlPtr_->SetFlowControlConfig(policy->GetFlowControlConfig());
+    }
+    std::atomic_store(&policy_, policy);
+    return !configs.empty();
+}
 
-    getCcmPublishControl();
+bool InnerCommonEventManager::ReloadConfig()
+{
+    EVENT_LOGI(LOG_TAG_CES, "Reload config");
+    DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->ReloadSubscriberLimits();
+    bool loaded = false;
+    bool result = false;
+    // a reload before the first publish is the initial load
+    std::call_once(configFlag_, [this, &loaded, &result]() {
+        result = LoadConfig();
+        loaded = true;
+    });
+    return loaded ? result : LoadConfig();
 }
 
 constexpr char HIDUMPER_HELP_MSG[] =
@@ -86,22 +126,57 @@ constexpr char HIDUMPER_HELP_MSG[] =
     "Description:\n"
     "  -h, --help                   list available commands\n"
     "  -a, --all                    dump the info of all events\n"
-    "  -e, --event <name>           dump the info of a specified event\n";
+    "  -e, --event <name>           dump the info of a specified event\n"
+    "  -m, --metrics [<name>]       dump the publish latency of all events or a specified event\n"
+    "  -r, --history [<name>]       dump the recently finished publishes of all events or a specified event\n"
+    "  -c, --reload-config          reload common_event_config.json and the subscriber limits without restarting\n"
+    "                               the service\n"
+    "  -j, --json [<name>]          dump subscribers, sticky, pending and frozen events with counters as json\n"
+    "  -b, --binary [<name>]        dump the same content as -j encoded as cbor\n"
+    "  -s, --memory                 dump the estimated memory of the subscriber records and indexes\n"
+    "Subscriber filters of -a and -e:\n"
+    "  --pid <pid>                  dump the subscribers of a process\n"
+    "  --uid <uid>                  dump the subscribers of a uid\n"
+    "  --bundle <name>              dump the subscribers of a bundle\n"
+    "  --page <index>               dump one page of the subscribers, the first page is 0\n"
+    "  --page-size <size>           set the number of subscribers in a page\n";
 
 const std::unordered_map<std::string, char> HIDUMPER_CMD_MAP = {
     { "--help", 'h'},
     { "--all", 'a'},
     { "--event", 'e'},
+    { "--metrics", 'm'},
+    { "--history", 'r'},
+    { "--reload-config", 'c'},
+    { "--json", 'j'},
+    { "--binary", 'b'},
+    { "--memory", 's'},
     { "-h", 'h' },
     { "-a", 'a' },
     { "-e", 'e' },
+    { "-m", 'm' },
+    { "-r", 'r' },
+    { "-c", 'c' },
+    { "-j", 'j' },
+    { "-b", 'b' },
+    { "-s", 's' },
 };
 
 const std::map<std::string, std::string> EVENT_COUNT_DISALLOW = {
     { CommonEventSupport::COMMON_EVENT_TIME_TICK, "usual.event.TIME_TICK" },
 };
 
-constexpr size_t HIDUMP_OPTION_MAX_SIZE = 2;
+const std::unordered_map<std::string, char> HIDUMPER_FILTER_MAP = {
+    { "--pid", 'p' },
+    { "--uid", 'u' },
+    { "--bundle", 'b' },
+    { "--page", 'n' },
+    { "--page-size", 's' },
+};
+
+constexpr size_t HIDUMP_FILTER_ARG_SIZE = 2;
+// the structured dump goes back over binder in slices of this size, the whole reply stays below 400KB
+constexpr size_t STRUCTURED_DUMP_SLICE_SIZE = 4096;
 
 bool InnerCommonEventManager::GetJsonFromFile(const char *path, nlohmann::json &root)
 {
@@ -169,82 +244,16 @@ bool InnerCommonEventManager::GetJsonByFilePath(const char *filePath, std::vecto
     return ret;
 }
 
-bool InnerCommonEventManager::GetConfigJson(const std::string &keyCheck, nlohmann::json &configJson) const
-{
-    if (eventConfigJson_.size() <= 0) {
-        EVENT_LOGE(LOG_TAG_CES, "Failed to get config json cause empty configJsons.");
-        return false;
-    }
-    bool ret = false;
-    std::for_each(eventConfigJson_.rbegin(), eventConfigJson_.rend(),
-        [&keyCheck, &configJson, &ret](const nlohmann::json &json) {
-        if (keyCheck.find("/") == std::string::npos && json.contains(keyCheck)) {
-            configJson = json;
-            ret = true;
-        }
-
-        if (keyCheck.find("/") != std::string::npos) {
-            nlohmann::json::json_pointer keyCheckPoint(keyCheck);
-            if (json.contains(keyCheckPoint)) {
-                configJson = json;
-                ret = true;
-            }
-        }
-    });
-    if (!ret) {
-        EVENT_LOGE(LOG_TAG_CES, "Cannot find keyCheck: %{public}s in configJsons.", keyCheck.c_str());
-    }
-    return ret;
-}
-
-void InnerCommonEventManager::getCcmPublishControl()
-{
-    nlohmann::json root;
-    std::string JsonPoint = "/";
-    JsonPoint.append("publishControl");
-    if (!GetConfigJson(JsonPoint, root)) {
-        EVENT_LOGE(LOG_TAG_CES, "Failed to get JsonPoint CCM config file.");
-        return;
-    }
-    if (!root.contains("publishControl")) {
-        EVENT_LOGE(LOG_TAG_CES, "not found jsonKey publishControl");
-        return;
-    }
-    // 访问数据
-    const nlohmann::json& publish_control = root["publishControl"];
-    if (publish_control.is_null() || publish_control.empty()) {
-        EVENT_LOGE(LOG_TAG_CES, "GetCcm publishControl failed as invalid publishControl json.");
-        return;
-    }
-    for (const auto& item : publish_control) {
-        std::string event_name = item["eventName"];
-        const nlohmann::json& uid_list = item["uidList"];
-        std::vector<int> uids;
-        for (const auto& uid : uid_list) {
-            uids.push_back(uid);
-        }
-        publishControlMap_[event_name] = uids;
-    }
-}
-
 bool InnerCommonEventManager::IsPublishAllowed(const std::string &event, int32_t uid)
 {
-    if (publishControlMap_.empty()) {
-        EVENT_LOGD(LOG_TAG_CES, "PublishControlMap event no need control");
-        return true;
-    }
-    auto it = publishControlMap_.find(event);
-    if (it != publishControlMap_.end()) {
-        EVENT_LOGD(LOG_TAG_CES, "PublishControlMap event = %{public}s,uid = %{public}d", event.c_str(), it->second[0]);
-        return std::find(it->second.begin(), it->second.end(), uid) != it->second.end();
-    }
-    return true;
+    auto policy = std::atomic_load(&policy_);
+    return policy == nullptr || policy->IsPublishAllowed(event, uid);
 }
 
 bool InnerCommonEventManager::PublishCommonEvent(const CommonEventData &data, const CommonEventPublishInfo &publishInfo,
     const sptr<IRemoteObject> &commonEventListener, const struct tm &recordTime, const pid_t &pid, const uid_t &uid,
     const Security::AccessToken::AccessTokenID &callerToken, const int32_t &userId, const std::string &bundleName,
-    const sptr<IRemoteObject> &service)
+    const sptr<IRemoteObject> &service, const int64_t publishTime)
 {
     NOTIFICATION_HITRACE(HITRACE_TAG_NOTIFICATION);
     if (data.GetWant().GetAction().empty()) {
@@ -257,6 +266,8 @@ bool InnerCommonEventManager::PublishCommonEvent(const CommonEventData &data, co
         return false;
     }
 
+    // the config only shapes publishing, so it is parsed by the first publish instead of on service start
+    std::call_once(configFlag_, [this]() { LoadConfig(); });
     std::string action = data.GetWant().GetAction();
     bool isAllowed = IsPublishAllowed(action, uid);
     if (!isAllowed) {
@@ -290,7 +301,8 @@ bool InnerCommonEventManager::PublishCommonEvent(const CommonEventData &data, co
     }
 
     CommonEventRecord eventRecord;
-    eventRecord.commonEventData = std::make_shared<CommonEventData>(data);
+    // the want is marshalled for the first receiver only, the others get its bytes or shared memory handle
+    eventRecord.commonEventData = std::make_shared<SharedCommonEventData>(data);
     eventRecord.publishInfo = std::make_shared<CommonEventPublishInfo>(publishInfo);
     eventRecord.recordTime = recordTime;
     eventRecord.eventRecordInfo.pid = pid;
@@ -302,6 +314,7 @@ bool InnerCommonEventManager::PublishCommonEvent(const CommonEventData &data, co
     eventRecord.eventRecordInfo.isSystemApp = (comeFrom.isSystemApp || comeFrom.isCemShell);
     eventRecord.eventRecordInfo.isProxy = comeFrom.isProxy;
     eventRecord.isSystemEvent = isSystemEvent;
+    eventRecord.publishTime = publishTime;
 
     if (publishInfo.IsSticky()) {
         if (!ProcessStickyEvent(eventRecord)) {
@@ -327,7 +340,8 @@ bool InnerCommonEventManager::SubscribeCommonEvent(const CommonEventSubscribeInf
     NOTIFICATION_HITRACE(HITRACE_TAG_NOTIFICATION);
     int64_t taskStartTime = SystemTime::GetNowSysTime();
 
-    if (subscribeInfo.GetMatchingSkills().CountEvent() == 0) {
+    if (subscribeInfo.GetMatchingSkills().CountEvent() == 0 &&
+        subscribeInfo.GetMatchingSkills().CountEventPrefixes() == 0) {
         EVENT_LOGE(LOG_TAG_SUBSCRIBER, "the subscriber has no event");
         return false;
     }
@@ -427,6 +441,36 @@ void InnerCommonEventManager::DumpState(const uint8_t &dumpType, const std::stri
             break;
         }
         case DumpEventType::HISTORY: {
+            DelayedSingleton<EventHistoryRecorder>::GetInstance()->DumpState(event, userId, state);
+            break;
+        }
+        case DumpEventType::METRICS: {
+            DelayedSingleton<EventLatencyMetrics>::GetInstance()->DumpState(event, state);
+            break;
+        }
+        case DumpEventType::MEMORY: {
+            DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->DumpMemory(state);
+            OrderedEventRecordPool::Stats pool = OrderedEventRecordPool::GetInstance().GetStats();
+            state.emplace_back("\tDispatch records: " + std::to_string(pool.idle) + " idle, " +
+                std::to_string(pool.created) + " created, " + std::to_string(pool.reused) + " reused");
+            break;
+        }
+        case DumpEventType::STRUCTURED: {
+            std::string result;
+            DumpStructured(event, userId, false, result);
+            if (result.size() > STRUCTURED_DUMP_SLICE_SIZE * MAX_HISTORY_SIZE) {
+                // still a JSON document, so that a reader parsing the output learns why the state is missing
+                nlohmann::json error = {
+                    { "version", StructuredDump::SCHEMA_VERSION },
+                    { "error", "the structured dump is too large, use hidumper -j instead" },
+                    { "size", result.size() },
+                };
+                state.emplace_back(StructuredDump::Serialize(error, false));
+                break;
+            }
+            for (size_t pos = 0; pos < result.size(); pos += STRUCTURED_DUMP_SLICE_SIZE) {
+                state.emplace_back(result.substr(pos, STRUCTURED_DUMP_SLICE_SIZE));
+            }
             break;
         }
         default: {
@@ -443,6 +487,39 @@ void InnerCommonEventManager::DumpState(const uint8_t &dumpType, const std::stri
         EVENT_LOGE(LOG_TAG_CES, "CommonEventControlManager ptr is nullptr");
     }
 }
+
+void InnerCommonEventManager::DumpStructured(const std::string &event, const int32_t &userId, bool binary,
+    std::string &result)
+{
+    EVENT_LOGD(LOG_TAG_CES, "enter");
+
+    nlohmann::json root = {
+        { "version", StructuredDump::SCHEMA_VERSION },
+        { "time", SystemTime::GetNowSysTime() },
+    };
+    auto subscriberManager = DelayedSingleton<CommonEventSubscriberManager>::GetInstance();
+    subscriberManager->DumpStructured(event, userId, root);
+    DelayedSingleton<CommonEventStickyManager>::GetInstance()->DumpStructured(event, userId, root);
+    if (controlPtr_) {
+        controlPtr_->DumpStructured(event, userId, root);
+    } else {
+        root["pending"] = { { "unordered", nlohmann::json::array() }, { "ordered", nlohmann::json::array() } };
+    }
+
+    size_t frozenEvents = 0;
+    for (const auto &item : root["frozen"]) {
+        frozenEvents += item["events"].size();
+    }
+    root["counters"] = {
+        { "subscribers", root["subscribers"].size() },
+        { "sticky", root["sticky"].size() },
+        { "unorderedPending", root["pending"]["unordered"].size() },
+        { "orderedPending", root["pending"]["ordered"].size() },
+        { "frozenSubscribers", root["frozen"].size() },
+        { "frozenEvents", frozenEvents },
+    };
+    result = StructuredDump::Serialize(root, binary);
+}
 #endif
 void InnerCommonEventManager::FinishReceiver(
     const sptr<IRemoteObject> &proxy, const int32_t &code, const std::string &receiverData, const bool &abortEvent)
@@ -462,6 +539,21 @@ void InnerCommonEventManager::FinishReceiver(
     return;
 }
 
+void InnerCommonEventManager::AckEvents(const sptr<IRemoteObject> &commonEventListener, uint32_t count, pid_t pid)
+{
+    if (!controlPtr_) {
+        EVENT_LOGE(LOG_TAG_CES, "CommonEventControlManager ptr is nullptr");
+        return;
+    }
+    auto record = DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->GetSubscriberRecord(
+        commonEventListener);
+    if (record == nullptr || record->eventRecordInfo.pid != pid) {
+        EVENT_LOGD(LOG_TAG_CES, "ack from pid %{public}d matches no subscriber", pid);
+        return;
+    }
+    controlPtr_->AckEvents(record, count);
+}
+
 void InnerCommonEventManager::Freeze(const uid_t &uid)
 {
     EVENT_LOGD(LOG_TAG_CES, "enter");
@@ -621,32 +713,98 @@ bool InnerCommonEventManager::PublishStickyEvent(
     return true;
 }
 #ifdef CEM_SUPPORT_DUMP
+template<typename T>
+static bool ParseDumpNumber(const std::string &text, T &value)
+{
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    return result.ec == std::errc {} && result.ptr == text.data() + text.size();
+}
+
+static bool ParseDumpFilter(const std::vector<std::u16string> &args, size_t index, DumpFilter &filter)
+{
+    for (; index < args.size(); index += HIDUMP_FILTER_ARG_SIZE) {
+        auto iter = HIDUMPER_FILTER_MAP.find(Str16ToStr8(args[index]));
+        if (iter == HIDUMPER_FILTER_MAP.end() || index + 1 >= args.size()) {
+            return false;
+        }
+        std::string value = Str16ToStr8(args[index + 1]);
+        int32_t id = 0;
+        bool ret = true;
+        switch (iter->second) {
+            case 'p' :
+                ret = ParseDumpNumber(value, id);
+                filter.pid = id;
+                break;
+            case 'u' :
+                ret = ParseDumpNumber(value, id);
+                filter.uid = id;
+                break;
+            case 'b' :
+                filter.bundleName = value;
+                break;
+            case 'n' :
+                ret = ParseDumpNumber(value, filter.page);
+                break;
+            default:
+                ret = ParseDumpNumber(value, filter.pageSize);
+                break;
+        }
+        if (!ret) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void InnerCommonEventManager::HiDump(const std::vector<std::u16string> &args, std::string &result)
 {
-    if (args.size() == 0 || args.size() > HIDUMP_OPTION_MAX_SIZE) {
-        result = "error: unknown option.";
+    DumpWriter writer(result);
+    HiDump(args, writer);
+}
+
+void InnerCommonEventManager::HiDump(const std::vector<std::u16string> &args, DumpWriter &writer)
+{
+    if (args.size() == 0) {
+        writer.Append("error: unknown option.");
         return;
     }
     std::string cmd = Str16ToStr8(args[0]);
     if (HIDUMPER_CMD_MAP.find(cmd) == HIDUMPER_CMD_MAP.end()) {
-        result = "error: unknown option.";
+        writer.Append("error: unknown option.");
         return;
     }
     std::string event;
-    if (args.size() == HIDUMP_OPTION_MAX_SIZE) {
-        event = Str16ToStr8(args[1]);
+    size_t index = 1;
+    if (index < args.size() && HIDUMPER_FILTER_MAP.find(Str16ToStr8(args[index])) == HIDUMPER_FILTER_MAP.end()) {
+        event = Str16ToStr8(args[index]);
+        index++;
+    }
+    DumpFilter filter;
+    if (!ParseDumpFilter(args, index, filter)) {
+        writer.Append("error: unknown option.");
+        return;
     }
     char cmdValue = HIDUMPER_CMD_MAP.find(cmd)->second;
     switch (cmdValue) {
         case 'h' :
-            result = HIDUMPER_HELP_MSG;
+            writer.Append(HIDUMPER_HELP_MSG);
             return;
+        case 'c' :
+            writer.Append(ReloadConfig() ? "config reloaded." : "config reloaded, no config file found.");
+            return;
+        case 'j' :
+        case 'b' : {
+            std::string result;
+            DumpStructured(event, ALL_USER, cmdValue == 'b', result);
+            writer.Append(result);
+            return;
+        }
         case 'a' :
             event = "";
             break;
         case 'e' :
             if (event.empty()) {
-                result = "error: request a event value.";
+                writer.Append("error: request a event value.");
                 return;
             }
             break;
@@ -654,9 +812,18 @@ void InnerCommonEventManager::HiDump(const std::vector<std::u16string> &args, st
             break;
     }
     std::vector<std::string> records;
-    DumpState(DumpEventType::ALL, event, ALL_USER, records);
+    if (cmdValue == 'm' || cmdValue == 'r') {
+        DumpState(cmdValue == 'm' ? DumpEventType::METRICS : DumpEventType::HISTORY, event, ALL_USER, records);
+    } else if (cmdValue == 's') {
+        DumpState(DumpEventType::MEMORY, event, ALL_USER, records);
+    } else {
+        // subscribers are the bulk of a full dump, they are formatted straight into the writer
+        DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->DumpState(event, ALL_USER, filter, writer);
+        DumpState(DumpEventType::STICKY, event, ALL_USER, records);
+        DumpState(DumpEventType::PENDING, event, ALL_USER, records);
+    }
     for (const auto &record : records) {
-        result.append(record).append("\n");
+        writer.Append(record).Append("\n");
     }
 }
 #endif
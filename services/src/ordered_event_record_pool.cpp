@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordered_event_record_pool.h"
+
+#include <mutex>
+
+#include "slab_allocator.h"
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+constexpr size_t MAX_IDLE_RECORDS = 64;
+// a broadcast to every subscriber should not pin its arrays in the pool
+constexpr size_t MAX_RETAINED_RECEIVERS = 256;
+}
+
+OrderedEventRecordPool &OrderedEventRecordPool::GetInstance()
+{
+    // never destroyed, records may be released during static destruction
+    static OrderedEventRecordPool *pool = new OrderedEventRecordPool();
+    return *pool;
+}
+
+std::shared_ptr<OrderedEventRecord> OrderedEventRecordPool::Acquire()
+{
+    std::unique_ptr<OrderedEventRecord> record;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (!idle_.empty()) {
+            record = std::move(idle_.back());
+            idle_.pop_back();
+            reused_++;
+        } else {
+            created_++;
+        }
+    }
+    if (record == nullptr) {
+        record = std::make_unique<OrderedEventRecord>();
+    }
+    // the control block comes from a slab, so a recycled record costs no allocation at all
+    return std::shared_ptr<OrderedEventRecord>(record.release(),
+        [](OrderedEventRecord *released) { OrderedEventRecordPool::GetInstance().Release(released); },
+        SlabAllocator<OrderedEventRecord, OrderedEventRecordPool>());
+}
+
+void OrderedEventRecordPool::Release(OrderedEventRecord *record)
+{
+    std::unique_ptr<OrderedEventRecord> owner(record);
+    owner->Reset();
+    if (owner->receivers.capacity() > MAX_RETAINED_RECEIVERS) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (idle_.size() < MAX_IDLE_RECORDS) {
+        idle_.emplace_back(std::move(owner));
+    }
+}
+
+OrderedEventRecordPool::Stats OrderedEventRecordPool::GetStats() const
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    Stats stats;
+    stats.idle = idle_.size();
+    stats.created = created_;
+    stats.reused = reused_;
+    return stats;
+}
+}  // namespace EventFwk
+}  // namespace OHOS
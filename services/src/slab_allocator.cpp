@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "slab_allocator.h"
+
+#include <mutex>
+#include <new>
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+constexpr size_t BLOCKS_PER_SLAB = 64;
+// fully free slabs kept beyond this are returned to the heap
+constexpr size_t MAX_EMPTY_SLABS = 1;
+}
+
+size_t SlabPool::GetBlockSize(size_t size)
+{
+    constexpr size_t alignment = alignof(std::max_align_t);
+    size_t blockSize = size < sizeof(FreeBlock) ? sizeof(FreeBlock) : size;
+    return (blockSize + alignment - 1) / alignment * alignment;
+}
+
+bool SlabPool::AddSlabLocked()
+{
+    // blocks are handed out uninitialized, the slab is not zero filled
+    std::unique_ptr<uint8_t[]> memory(new (std::nothrow) uint8_t[blockSize_ * BLOCKS_PER_SLAB]);
+    if (memory == nullptr) {
+        return false;
+    }
+    uintptr_t base = reinterpret_cast<uintptr_t>(memory.get());
+    Slab &slab = slabs_[base];
+    for (size_t index = BLOCKS_PER_SLAB; index > 0; --index) {
+        auto block = reinterpret_cast<FreeBlock *>(memory.get() + (index - 1) * blockSize_);
+        block->next = slab.freeList;
+        slab.freeList = block;
+    }
+    slab.memory = std::move(memory);
+    slab.freeCount = BLOCKS_PER_SLAB;
+    availableSlabs_.insert(base);
+    emptySlabs_++;
+    return true;
+}
+
+void *SlabPool::Allocate(size_t size)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (blockSize_ == 0) {
+        blockSize_ = GetBlockSize(size);
+    } else if (blockSize_ != GetBlockSize(size)) {
+        return nullptr;
+    }
+    if (availableSlabs_.empty() && !AddSlabLocked()) {
+        return nullptr;
+    }
+    auto base = availableSlabs_.begin();
+    Slab &slab = slabs_[*base];
+    if (slab.freeCount == BLOCKS_PER_SLAB) {
+        emptySlabs_--;
+    }
+    FreeBlock *block = slab.freeList;
+    slab.freeList = block->next;
+    if (--slab.freeCount == 0) {
+        availableSlabs_.erase(base);
+    }
+    inUse_++;
+    return block;
+}
+
+bool SlabPool::Deallocate(void *block, size_t size)
+{
+    if (block == nullptr) {
+        return true;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (blockSize_ == 0 || blockSize_ != GetBlockSize(size)) {
+        return false;
+    }
+    uintptr_t address = reinterpret_cast<uintptr_t>(block);
+    auto it = slabs_.upper_bound(address);
+    if (it == slabs_.begin()) {
+        return false;
+    }
+    --it;
+    if (address >= it->first + blockSize_ * BLOCKS_PER_SLAB) {
+        return false;
+    }
+    Slab &slab = it->second;
+    auto freeBlock = static_cast<FreeBlock *>(block);
+    freeBlock->next = slab.freeList;
+    slab.freeList = freeBlock;
+    if (slab.freeCount++ == 0) {
+        availableSlabs_.insert(it->first);
+    }
+    inUse_--;
+    if (slab.freeCount < BLOCKS_PER_SLAB) {
+        return true;
+    }
+    if (emptySlabs_ < MAX_EMPTY_SLABS) {
+        emptySlabs_++;
+        return true;
+    }
+    availableSlabs_.erase(it->first);
+    slabs_.erase(it);
+    return true;
+}
+
+SlabPool::Stats SlabPool::GetStats() const
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    Stats stats;
+    stats.blockSize = blockSize_;
+    stats.slabs = slabs_.size();
+    stats.inUse = inUse_;
+    stats.reservedBytes = slabs_.size() * blockSize_ * BLOCKS_PER_SLAB;
+    return stats;
+}
+}  // namespace EventFwk
+}  // namespace OHOS
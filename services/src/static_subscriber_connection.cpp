@@ -15,12 +15,20 @@
 
 #include "static_subscriber_connection.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "ability_manager_helper.h"
 #include "event_log_wrapper.h"
 #include "event_report.h"
 
 namespace OHOS {
 namespace EventFwk {
+namespace {
+// a flush is split into transactions of at most this many events to stay below the binder buffer limit
+constexpr size_t MAX_EVENTS_PER_TRANSACTION = 16;
+}
+
 void StaticSubscriberConnection::OnAbilityConnectDone(
     const AppExecFwk::ElementName &element, const sptr<IRemoteObject> &remoteObject, int resultCode)
 {
@@ -28,10 +36,13 @@ void StaticSubscriberConnection::OnAbilityConnectDone(
     InitProxy(remoteObject);
     std::string bundleName = element.GetURI();
     EVENT_LOGI(LOG_TAG_STATIC, "called, %{public}s", bundleName.c_str());
-    for (auto &event : events_) {
-        NotifyEvent(event);
+    if (proxy_ == nullptr || events_.empty()) {
+        return;
     }
+    std::string action = events_.front().GetWant().GetAction();
+    pendingEvents_.insert(pendingEvents_.end(), events_.begin(), events_.end());
     events_.clear();
+    ScheduleFlush(action);
 }
 
 void StaticSubscriberConnection::NotifyEvent(const CommonEventData &event)
@@ -42,27 +53,74 @@ void StaticSubscriberConnection::NotifyEvent(const CommonEventData &event)
         EVENT_LOGW_LIMIT(LOG_TAG_STATIC, "Cache events");
         return;
     }
-    action_.push_back(event.GetWant().GetAction());
+    pendingEvents_.push_back(event);
+    ScheduleFlush(event.GetWant().GetAction());
+}
+
+std::vector<CommonEventData> StaticSubscriberConnection::TakeEvents()
+{
+    std::lock_guard<ffrt::recursive_mutex> lock(mutex_);
+    std::vector<CommonEventData> events;
+    events.swap(events_);
+    return events;
+}
+
+void StaticSubscriberConnection::ScheduleFlush(const std::string &action)
+{
+    if (flushScheduled_) {
+        // joins the batch of the flush that is not sent yet
+        return;
+    }
+    flushScheduled_ = true;
+    // one action per batch, the delayed disconnect of the batch releases it
+    action_.push_back(action);
     wptr<StaticSubscriberConnection> wThis = this;
-    staticNotifyQueue_->submit([event, wThis]() {
+    staticNotifyQueue_->submit([action, wThis]() {
         sptr<StaticSubscriberConnection> sThis = wThis.promote();
         if (!sThis) {
             EVENT_LOGE(LOG_TAG_STATIC, "Connection expired, skip Notify");
             return;
         }
-        std::lock_guard<ffrt::recursive_mutex> lock(sThis->mutex_);
-        if (sThis->proxy_ == nullptr) {
-            EVENT_LOGE(LOG_TAG_STATIC, "Proxy is died, skip Notify");
-            return;
-        }
-        int32_t funcResult = -1;
-        ErrCode ec = sThis->proxy_->OnReceiveEvent(event, funcResult);
-        EVENT_LOGI(LOG_TAG_STATIC, "Notify %{public}s to %{public}s end, code %{public}d",
-            event.GetWant().GetAction().c_str(), sThis->connectionKey_.c_str(), ec);
-        AbilityManagerHelper::GetInstance()->DisconnectServiceAbilityDelay(sThis, event.GetWant().GetAction());
+        sThis->FlushEvents(action);
     });
 }
 
+void StaticSubscriberConnection::FlushEvents(const std::string &action)
+{
+    std::lock_guard<ffrt::recursive_mutex> lock(mutex_);
+    flushScheduled_ = false;
+    std::vector<CommonEventData> events;
+    events.swap(pendingEvents_);
+    if (proxy_ == nullptr) {
+        EVENT_LOGE(LOG_TAG_STATIC, "Proxy is died, skip Notify");
+        return;
+    }
+    if (events.empty()) {
+        return;
+    }
+    int32_t funcResult = -1;
+    ErrCode ec = ERR_OK;
+    if (events.size() == 1) {
+        ec = proxy_->OnReceiveEvent(events.front(), funcResult);
+    } else if (events.size() <= MAX_EVENTS_PER_TRANSACTION) {
+        ec = proxy_->OnReceiveEvents(events, funcResult);
+    } else {
+        for (size_t begin = 0; begin < events.size(); begin += MAX_EVENTS_PER_TRANSACTION) {
+            size_t end = std::min(events.size(), begin + MAX_EVENTS_PER_TRANSACTION);
+            if (end - begin == 1) {
+                ec = proxy_->OnReceiveEvent(events[begin], funcResult);
+                continue;
+            }
+            std::vector<CommonEventData> batch(std::make_move_iterator(events.begin() + begin),
+                std::make_move_iterator(events.begin() + end));
+            ec = proxy_->OnReceiveEvents(batch, funcResult);
+        }
+    }
+    EVENT_LOGI(LOG_TAG_STATIC, "Notify %{public}s to %{public}s end, count %{public}zu, code %{public}d",
+        action.c_str(), connectionKey_.c_str(), events.size(), ec);
+    AbilityManagerHelper::GetInstance()->DisconnectServiceAbilityDelay(this, action);
+}
+
 void StaticSubscriberConnection::RemoveEvent(const std::string &action)
 {
     std::lock_guard<ffrt::recursive_mutex> lock(mutex_);
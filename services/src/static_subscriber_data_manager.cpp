@@ -15,7 +15,12 @@
 
 #include "static_subscriber_data_manager.h"
 
+#include <cerrno>
 #include <charconv>
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include "bundle_manager_helper.h"
@@ -33,11 +38,50 @@ constexpr const char *STATIC_SUBSCRIBER_STORAGE_DIR = "/data/service/el1/public/
 const std::string STATIC_SUBSCRIBER_VALUE_DEFAULT = "0";
 const std::string IS_UPDATED_KEY = "is_updated_key";
 const std::string KEY_IS_ALREADY_UPDATED = "true";
+const std::string STATIC_SUBSCRIBER_JOURNAL_PATH =
+    std::string(STATIC_SUBSCRIBER_STORAGE_DIR) + "/static_subscriber_state_journal";
+constexpr uint64_t FLUSH_DELAY_MS = 100;
+constexpr uint64_t FLUSH_RETRY_DELAY_MS = 1000;
+constexpr uint32_t MAX_FLUSH_RETRY_COUNT = 3;
+constexpr uint64_t TIME_UNIT_SIZE = 1000;
+
+bool WriteAll(int fd, const std::string &data)
+{
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t ret = write(fd, data.data() + written, data.size() - written);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    return true;
+}
+
+bool SyncDirectory(const char *path)
+{
+    int fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    bool result = fsync(fd) == 0;
+    close(fd);
+    return result;
+}
 } // namespace
-StaticSubscriberDataManager::StaticSubscriberDataManager() {}
+StaticSubscriberDataManager::StaticSubscriberDataManager()
+{
+    flushQueue_ = std::make_shared<ffrt::queue>("StaticSubscriberStateFlush");
+}
 
 StaticSubscriberDataManager::~StaticSubscriberDataManager()
 {
+    // releasing the queue drops a delayed flush, write what it would have taken
+    flushQueue_ = nullptr;
+    FlushStaticSubscriberState();
     if (kvStorePtr_ != nullptr) {
         dataManager_.CloseKvStore(appId_, kvStorePtr_);
     }
@@ -222,6 +266,161 @@ int32_t StaticSubscriberDataManager::DeleteDisableEventElementByBundleName(const
     return ERR_OK;
 }
 
+int32_t StaticSubscriberDataManager::UpdateStaticSubscriberStateAsync(
+    const std::string &key, const std::vector<std::string> &events)
+{
+    std::lock_guard<ffrt::mutex> lock(pendingMutex_);
+    if (!AppendJournal(key, events)) {
+        EVENT_LOGE(LOG_TAG_STATIC, "failed to journal static subscriber state of %{public}s", key.c_str());
+        return ERR_INVALID_OPERATION;
+    }
+    pendingChanges_[key] = events;
+    flushRetryCount_ = 0;
+    if (flushScheduled_) {
+        return ERR_OK;
+    }
+    flushScheduled_ = true;
+    ScheduleFlush(FLUSH_DELAY_MS);
+    return ERR_OK;
+}
+
+void StaticSubscriberDataManager::ScheduleFlush(uint64_t delayMs)
+{
+    if (flushQueue_ == nullptr) {
+        flushScheduled_ = false;
+        return;
+    }
+    flushQueue_->submit([this]() { FlushStaticSubscriberState(); },
+        ffrt::task_attr().delay(delayMs * TIME_UNIT_SIZE));
+}
+
+int32_t StaticSubscriberDataManager::FlushStaticSubscriberState()
+{
+    std::lock_guard<ffrt::mutex> flushLock(flushMutex_);
+    std::map<std::string, std::vector<std::string>> changes;
+    {
+        std::lock_guard<ffrt::mutex> lock(pendingMutex_);
+        flushScheduled_ = false;
+        changes.swap(pendingChanges_);
+    }
+    if (changes.empty()) {
+        // replay the changes a flush did not write before the service stopped
+        if (!ReadJournal(changes) || changes.empty()) {
+            return ERR_OK;
+        }
+        EVENT_LOGI(LOG_TAG_STATIC, "replay static subscriber state journal, size = %{public}zu", changes.size());
+    }
+
+    int32_t ret = ApplyStaticSubscriberState(changes);
+    std::lock_guard<ffrt::mutex> lock(pendingMutex_);
+    if (ret != ERR_OK) {
+        EVENT_LOGE(LOG_TAG_STATIC, "flush static subscriber state failed, ret = %{public}d", ret);
+        // the changes stay queued and journaled so a later flush or the next start writes them, a change queued in
+        // the meantime is newer and wins
+        pendingChanges_.merge(changes);
+        if (!flushScheduled_ && flushRetryCount_ < MAX_FLUSH_RETRY_COUNT) {
+            flushRetryCount_++;
+            flushScheduled_ = true;
+            ScheduleFlush(FLUSH_RETRY_DELAY_MS);
+        }
+        return ret;
+    }
+    if (pendingChanges_.empty()) {
+        RemoveJournal();
+    }
+    return ERR_OK;
+}
+
+int32_t StaticSubscriberDataManager::ApplyStaticSubscriberState(
+    const std::map<std::string, std::vector<std::string>> &changes)
+{
+    std::lock_guard<ffrt::mutex> lock(kvStorePtrMutex_);
+    if (!CheckKvStore()) {
+        EVENT_LOGE(LOG_TAG_STATIC, "Kvstore is nullptr.");
+        return ERR_NO_INIT;
+    }
+    DistributedKv::Key updateKey(IS_UPDATED_KEY);
+    DistributedKv::Value updateValue(KEY_IS_ALREADY_UPDATED);
+    kvStorePtr_->Put(updateKey, updateValue);
+    for (const auto &[bundleKey, events] : changes) {
+        DistributedKv::Key key(bundleKey);
+        DistributedKv::Status status = events.empty() ? kvStorePtr_->Delete(key) :
+            kvStorePtr_->Put(key, ConvertEventsToValue(events));
+        if (status != DistributedKv::Status::SUCCESS) {
+            EVENT_LOGE(LOG_TAG_STATIC, "Update data from kvstore failed.");
+            dataManager_.CloseKvStore(appId_, kvStorePtr_);
+            kvStorePtr_ = nullptr;
+            return ERR_INVALID_OPERATION;
+        }
+    }
+
+    dataManager_.CloseKvStore(appId_, kvStorePtr_);
+    kvStorePtr_ = nullptr;
+    return ERR_OK;
+}
+
+bool StaticSubscriberDataManager::AppendJournal(const std::string &key, const std::vector<std::string> &events)
+{
+    nlohmann::json entry = { { "key", key }, { "events", events } };
+    std::string line = entry.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace) + "\n";
+    bool created = access(STATIC_SUBSCRIBER_JOURNAL_PATH.c_str(), F_OK) != 0;
+    int fd = open(STATIC_SUBSCRIBER_JOURNAL_PATH.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        return false;
+    }
+    off_t size = lseek(fd, 0, SEEK_END);
+    char last = '\n';
+    // an append torn by a crash was never acknowledged, start a new line after it
+    if (size > 0 && pread(fd, &last, 1, size - 1) == 1 && last != '\n') {
+        line.insert(line.begin(), '\n');
+    }
+    bool result = size >= 0 && WriteAll(fd, line) && fsync(fd) == 0;
+    if (!result && size >= 0 && ftruncate(fd, size) != 0) {
+        EVENT_LOGW(LOG_TAG_STATIC, "failed to drop a partial journal entry");
+    }
+    close(fd);
+    return result && (!created || SyncDirectory(STATIC_SUBSCRIBER_STORAGE_DIR));
+}
+
+bool StaticSubscriberDataManager::ReadJournal(std::map<std::string, std::vector<std::string>> &changes)
+{
+    std::ifstream file(STATIC_SUBSCRIBER_JOURNAL_PATH);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        nlohmann::json entry = nlohmann::json::parse(line, nullptr, false);
+        if (entry.is_discarded() || !entry.is_object()) {
+            EVENT_LOGW(LOG_TAG_STATIC, "skip invalid static subscriber state journal entry");
+            continue;
+        }
+        auto key = entry.find("key");
+        auto events = entry.find("events");
+        if (key == entry.end() || !key->is_string() || events == entry.end() || !events->is_array()) {
+            EVENT_LOGW(LOG_TAG_STATIC, "skip invalid static subscriber state journal entry");
+            continue;
+        }
+        std::vector<std::string> bundleEvents;
+        for (const auto &event : *events) {
+            if (event.is_string()) {
+                bundleEvents.emplace_back(event.get<std::string>());
+            }
+        }
+        // later entries are newer
+        changes[key->get<std::string>()] = std::move(bundleEvents);
+    }
+    return true;
+}
+
+void StaticSubscriberDataManager::RemoveJournal()
+{
+    std::remove(STATIC_SUBSCRIBER_JOURNAL_PATH.c_str());
+}
+
 DistributedKv::Value StaticSubscriberDataManager::ConvertEventsToValue(const std::vector<std::string> &events)
 {
     nlohmann::json jsonNodes = nlohmann::json::array();
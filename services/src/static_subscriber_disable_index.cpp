@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "static_subscriber_disable_index.h"
+
+#include <charconv>
+
+#include "event_log_wrapper.h"
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+constexpr uint32_t BITS_PER_WORD = 64;
+constexpr char KEY_SEPARATOR = '_';
+}
+
+void StaticSubscriberDisableIndex::Rebuild(const std::map<std::string, std::vector<std::string>> &disableEvents)
+{
+    Clear();
+    for (const auto &[key, events] : disableEvents) {
+        Set(key, events);
+    }
+}
+
+void StaticSubscriberDisableIndex::Set(const std::string &key, const std::vector<std::string> &events)
+{
+    int32_t userId = 0;
+    std::string bundleName;
+    if (!ParseKey(key, userId, bundleName)) {
+        EVENT_LOGW(LOG_TAG_STATIC, "invalid disable event key %{public}s", key.c_str());
+        return;
+    }
+    auto userIt = bundles_.find(userId);
+    if (events.empty()) {
+        if (userIt == bundles_.end()) {
+            return;
+        }
+        userIt->second.erase(bundleName);
+        if (userIt->second.empty()) {
+            bundles_.erase(userIt);
+        }
+        return;
+    }
+    std::vector<uint64_t> bits;
+    for (const auto &event : events) {
+        uint32_t eventId = GetEventId(event);
+        if (bits.size() <= eventId / BITS_PER_WORD) {
+            bits.resize(eventId / BITS_PER_WORD + 1, 0);
+        }
+        bits[eventId / BITS_PER_WORD] |= (uint64_t { 1 } << (eventId % BITS_PER_WORD));
+    }
+    bundles_[userId][bundleName] = std::move(bits);
+}
+
+bool StaticSubscriberDisableIndex::Contains(
+    int32_t userId, const std::string &bundleName, const std::string &event) const
+{
+    auto userIt = bundles_.find(userId);
+    if (userIt == bundles_.end()) {
+        return false;
+    }
+    auto bundleIt = userIt->second.find(bundleName);
+    if (bundleIt == userIt->second.end()) {
+        return false;
+    }
+    auto eventIt = eventIds_.find(event);
+    if (eventIt == eventIds_.end()) {
+        return false;
+    }
+    const auto &bits = bundleIt->second;
+    uint32_t word = eventIt->second / BITS_PER_WORD;
+    return word < bits.size() && (bits[word] & (uint64_t { 1 } << (eventIt->second % BITS_PER_WORD))) != 0;
+}
+
+void StaticSubscriberDisableIndex::Clear()
+{
+    eventIds_.clear();
+    bundles_.clear();
+}
+
+bool StaticSubscriberDisableIndex::ParseKey(const std::string &key, int32_t &userId, std::string &bundleName)
+{
+    auto pos = key.find(KEY_SEPARATOR);
+    if (pos == std::string::npos || pos == 0) {
+        return false;
+    }
+    auto result = std::from_chars(key.data(), key.data() + pos, userId);
+    if (result.ec != std::errc {} || result.ptr != key.data() + pos) {
+        return false;
+    }
+    bundleName = key.substr(pos + 1);
+    return true;
+}
+
+uint32_t StaticSubscriberDisableIndex::GetEventId(const std::string &event)
+{
+    auto iter = eventIds_.find(event);
+    if (iter != eventIds_.end()) {
+        return iter->second;
+    }
+    uint32_t eventId = static_cast<uint32_t>(eventIds_.size());
+    eventIds_.emplace(event, eventId);
+    return eventId;
+}
+}  // namespace EventFwk
+}  // namespace OHOS
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "static_subscriber_filter.h"
+
+#include "bool_wrapper.h"
+#include "double_wrapper.h"
+#include "event_log_wrapper.h"
+#include "int_wrapper.h"
+#include "string_wrapper.h"
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+std::optional<StaticSubscriberFilter::ParameterType> ReadParameter(const AAFwk::WantParams &params,
+    const std::string &key)
+{
+    sptr<AAFwk::IInterface> value = params.GetParam(key);
+    if (value == nullptr) {
+        return std::nullopt;
+    }
+    if (auto *ao = AAFwk::IBoolean::Query(value); ao != nullptr) {
+        return AAFwk::Boolean::Unbox(ao);
+    }
+    if (auto *ao = AAFwk::IInteger::Query(value); ao != nullptr) {
+        return AAFwk::Integer::Unbox(ao);
+    }
+    if (auto *ao = AAFwk::IDouble::Query(value); ao != nullptr) {
+        return AAFwk::Double::Unbox(ao);
+    }
+    if (auto *ao = AAFwk::IString::Query(value); ao != nullptr) {
+        return AAFwk::String::Unbox(ao);
+    }
+    return std::nullopt;
+}
+}
+
+uint32_t StaticSubscriberFilter::KeyTable::GetSlot(const std::string &key)
+{
+    auto iter = slots_.find(key);
+    if (iter != slots_.end()) {
+        return iter->second;
+    }
+    uint32_t slot = static_cast<uint32_t>(keys_.size());
+    keys_.emplace_back(key);
+    slots_.emplace(key, slot);
+    return slot;
+}
+
+const std::string &StaticSubscriberFilter::KeyTable::GetKey(uint32_t slot) const
+{
+    return keys_[slot];
+}
+
+size_t StaticSubscriberFilter::KeyTable::GetSize() const
+{
+    return keys_.size();
+}
+
+void StaticSubscriberFilter::KeyTable::Clear()
+{
+    keys_.clear();
+    slots_.clear();
+}
+
+StaticSubscriberFilter::ParameterCache::ParameterCache(const KeyTable &keys, const AAFwk::WantParams &params)
+    : keys_(keys), params_(params)
+{}
+
+const StaticSubscriberFilter::ParameterType *StaticSubscriberFilter::ParameterCache::Get(uint32_t slot)
+{
+    if (slot >= keys_.GetSize()) {
+        return nullptr;
+    }
+    if (loaded_.empty()) {
+        // sized on first use, events without filtered subscribers never allocate
+        loaded_.resize(keys_.GetSize(), false);
+        values_.resize(keys_.GetSize());
+    }
+    if (!loaded_[slot]) {
+        values_[slot] = ReadParameter(params_, keys_.GetKey(slot));
+        loaded_[slot] = true;
+    }
+    return values_[slot].has_value() ? &values_[slot].value() : nullptr;
+}
+
+std::shared_ptr<const StaticSubscriberFilter> StaticSubscriberFilter::Compile(const std::optional<int32_t> &code,
+    const std::optional<std::string> &data, const std::map<std::string, ParameterType> &parameters,
+    KeyTable &keys)
+{
+    auto filter = std::make_shared<StaticSubscriberFilter>();
+    filter->program_.reserve((code.has_value() ? 1 : 0) + (data.has_value() ? 1 : 0) + parameters.size());
+    // cheapest checks first, the parameters are read from the want
+    if (code.has_value()) {
+        filter->program_.push_back({ .opcode = Opcode::CODE_EQUAL, .operand = code.value() });
+    }
+    if (data.has_value()) {
+        filter->program_.push_back({ .opcode = Opcode::DATA_EQUAL, .operand = data.value() });
+    }
+    for (const auto &[name, value] : parameters) {
+        filter->program_.push_back({ .opcode = Opcode::PARAMETER_EQUAL, .slot = keys.GetSlot(name), .operand = value });
+    }
+    return filter;
+}
+
+bool StaticSubscriberFilter::Match(const CommonEventData &data, ParameterCache &cache) const
+{
+    for (const auto &instruction : program_) {
+        switch (instruction.opcode) {
+            case Opcode::CODE_EQUAL:
+                if (std::get<int32_t>(instruction.operand) != data.GetCode()) {
+                    EVENT_LOGD(LOG_TAG_STATIC, "filter code:%{public}d not equal event code:%{public}d",
+                        std::get<int32_t>(instruction.operand), data.GetCode());
+                    return false;
+                }
+                break;
+            case Opcode::DATA_EQUAL:
+                if (std::get<std::string>(instruction.operand) != data.GetData()) {
+                    EVENT_LOGD(LOG_TAG_STATIC, "filter data not equal event data");
+                    return false;
+                }
+                break;
+            case Opcode::PARAMETER_EQUAL: {
+                const ParameterType *value = cache.Get(instruction.slot);
+                if (value == nullptr || *value != instruction.operand) {
+                    EVENT_LOGD(LOG_TAG_STATIC, "filter parameter: %{public}s not match",
+                        cache.GetKey(instruction.slot).c_str());
+                    return false;
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+}  // namespace EventFwk
+}  // namespace OHOS
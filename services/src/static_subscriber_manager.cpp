@@ -15,6 +15,7 @@
 
 #include "static_subscriber_manager.h"
 
+#include <algorithm>
 #include <fstream>
 #include <mutex>
 #include <set>
@@ -53,6 +54,8 @@ constexpr static const char* JSON_KEY_FILTER_CONDITIONS_DATA = "data";
 constexpr static const char* JSON_KEY_FILTER_CONDITIONS_PARAMETERS = "parameters";
 static int32_t g_bootDelayTime = OHOS::system::GetIntParameter("bootevent.boot.completed.delay", 0);
 constexpr int32_t TIME_UNIT_SIZE = 1000;
+constexpr const char *STATIC_SUBSCRIBER_SNAPSHOT_PATH =
+    "/data/service/el1/public/database/common_event_service/static_subscriber_snapshot";
 }
 
 StaticSubscriberManager::StaticSubscriberManager() {}
@@ -69,32 +72,58 @@ bool StaticSubscriberManager::InitAllowList()
         EVENT_LOGE_LIMIT(LOG_TAG_STATIC, "GetApplicationInfos failed");
         return false;
     }
+    AddToAllowList(appInfos);
 
+    hasInitAllowList_ = true;
+    return true;
+}
+
+void StaticSubscriberManager::AddToAllowList(const std::vector<AppExecFwk::ApplicationInfo> &appInfos)
+{
     for (auto const &appInfo : appInfos) {
-        std::vector<std::string> allowCommonEvents = appInfo.allowCommonEvent;
-        std::string bundleName = appInfo.bundleName;
         int32_t userId = ALL_USER;
         if (DelayedSingleton<OsAccountManagerHelper>::GetInstance()
             ->GetOsAccountLocalIdFromUid(appInfo.uid, userId) != ERR_OK) {
             EVENT_LOGE(LOG_TAG_STATIC, "Get userId failed, uid = %{public}d", appInfo.uid);
             continue;
         }
-        std::string key = std::to_string(userId) + "_" + bundleName;
-        for (auto e : allowCommonEvents) {
+        std::string key = std::to_string(userId) + "_" + appInfo.bundleName;
+        std::lock_guard<ffrt::recursive_mutex> lock(subscriberMutex_);
+        for (auto const &e : appInfo.allowCommonEvent) {
+            auto &events = staticSubscribers_[key].events;
+            // singleton apps are listed again for every user
+            if (std::find(events.begin(), events.end(), e) == events.end()) {
+                events.push_back(e);
+            }
+        }
+    }
+}
+
+void StaticSubscriberManager::AddValidExtensions(const std::vector<AppExecFwk::ExtensionAbilityInfo> &extensions,
+    std::set<std::string> &profileKeys)
+{
+    // filter legal extensions and add them to valid map
+    for (auto extension : extensions) {
+        int32_t userId = ALL_USER;
+        if (DelayedSingleton<OsAccountManagerHelper>::GetInstance()
+            ->GetOsAccountLocalIdFromUid(extension.applicationInfo.uid, userId) != ERR_OK) {
+            EVENT_LOGE(LOG_TAG_STATIC, "Get userId failed, uid = %{public}d", extension.applicationInfo.uid);
+            continue;
+        }
+        std::string key = std::to_string(userId) + "_" + extension.bundleName;
+        {
             std::lock_guard<ffrt::recursive_mutex> lock(subscriberMutex_);
             if (staticSubscribers_.find(key) == staticSubscribers_.end()) {
-                std::vector<std::string> v;
-                v.push_back(e);
-                StaticSubscriber subscriber = { .events = v};
-                staticSubscribers_.insert(std::make_pair(key, subscriber));
-            } else {
-                staticSubscribers_[key].events.push_back(e);
+                EVENT_LOGI(LOG_TAG_STATIC, "StaticExtension exists, but allowCommonEvent not found, bundle=%{public}s "
+                    "userId=%{public}d", extension.bundleName.c_str(), userId);
+                continue;
             }
         }
+        EVENT_LOGI(LOG_TAG_STATIC, "StaticExtension exists, bundle=%{public}s userId=%{public}d",
+            extension.bundleName.c_str(), userId);
+        AddSubscriber(extension);
+        profileKeys.insert(StaticSubscriberSnapshot::GetKey(userId, extension.bundleName, extension.name));
     }
-
-    hasInitAllowList_ = true;
-    return true;
 }
 
 bool StaticSubscriberManager::InitValidSubscribers()
@@ -104,41 +133,44 @@ bool StaticSubscriberManager::InitValidSubscribers()
     if (!validSubscribers_.empty()) {
         validSubscribers_.clear();
     }
+    filterKeys_.Clear();
+    {
+        std::lock_guard<ffrt::recursive_mutex> lock(subscriberMutex_);
+        subscriberIdentities_.clear();
+    }
     if (!InitAllowList()) {
         EVENT_LOGE(LOG_TAG_STATIC, "Failed to init AllowList");
         return false;
     }
     std::set<std::string> bundleList;
+    // a state still queued or left by an interrupted flush must reach the kv store before it is read back
+    DelayedSingleton<StaticSubscriberDataManager>::GetInstance()->FlushStaticSubscriberState();
     DelayedSingleton<StaticSubscriberDataManager>::GetInstance()->
         QueryStaticSubscriberStateData(disableEvents_, bundleList);
+    {
+        std::lock_guard<ffrt::mutex> lock(disableEventsMutex_);
+        disableIndex_.Rebuild(disableEvents_);
+    }
 
+    std::vector<int32_t> foregroundUserIds;
+    DelayedSingleton<OsAccountManagerHelper>::GetInstance()->GetForegroundUserIds(foregroundUserIds);
     std::vector<AppExecFwk::ExtensionAbilityInfo> extensions;
     // get all static subscriber type extensions
     if (!DelayedSingleton<BundleManagerHelper>::GetInstance()->QueryExtensionInfos(extensions)) {
         EVENT_LOGE(LOG_TAG_STATIC, "QueryExtensionInfos failed");
         return false;
     }
-    // filter legal extensions and add them to valid map
-    for (auto extension : extensions) {
-        int32_t userId = ALL_USER;
-        if (DelayedSingleton<OsAccountManagerHelper>::GetInstance()
-            ->GetOsAccountLocalIdFromUid(extension.applicationInfo.uid, userId) != ERR_OK) {
-            EVENT_LOGE(LOG_TAG_STATIC, "Get userId failed, uid = %{public}d", extension.applicationInfo.uid);
-            continue;
-        }
-        std::string key = std::to_string(userId) + "_" + extension.bundleName;
-        {
-            std::lock_guard<ffrt::recursive_mutex> lock(subscriberMutex_);
-            if (staticSubscribers_.find(key) == staticSubscribers_.end()) {
-                EVENT_LOGI(LOG_TAG_STATIC, "StaticExtension exists, but allowCommonEvent not found, bundle=%{public}s "
-                    "userId=%{public}d", extension.bundleName.c_str(), userId);
-                continue;
-            }
-        }
-        EVENT_LOGI(LOG_TAG_STATIC, "StaticExtension exists, bundle=%{public}s userId=%{public}d",
-            extension.bundleName.c_str(), userId);
-        AddSubscriber(extension);
+    std::set<std::string> profileKeys;
+    AddValidExtensions(extensions, profileKeys);
+    loadedUsers_ = std::set<int32_t>(foregroundUserIds.begin(), foregroundUserIds.end());
+    // drop profiles of extensions gone from the loaded users, background users keep theirs for the next switch.
+    // singleton apps run under the system user, which is never switched to
+    std::set<int32_t> erasedUsers = loadedUsers_;
+    erasedUsers.insert(SUBSCRIBE_USER_SYSTEM_BEGIN);
+    for (auto userId : erasedUsers) {
+        GetSnapshot().Erase(StaticSubscriberSnapshot::GetUserPrefix(userId), profileKeys);
     }
+    GetSnapshot().Save();
 
     if (bundleList.empty()) {
         hasInitValidSubscribers_ = true;
@@ -159,25 +191,103 @@ bool StaticSubscriberManager::InitValidSubscribers()
             disableEvents_.emplace(bundleKey, events);
         }
     }
+    disableIndex_.Rebuild(disableEvents_);
     DelayedSingleton<StaticSubscriberDataManager>::GetInstance()->UpdateStaticSubscriberState(disableEvents_);
     hasInitValidSubscribers_ = true;
     return true;
 }
 
-bool StaticSubscriberManager::IsDisableEvent(const std::string &bundleName, const std::string &event, int32_t userId)
+bool StaticSubscriberManager::UpdateForegroundUsers()
 {
-    EVENT_LOGD(LOG_TAG_STATIC, "Called.");
-    std::lock_guard<ffrt::mutex> lock(disableEventsMutex_);
-    std::string key = std::to_string(userId) + "_" + bundleName;
-    auto bundleIt = disableEvents_.find(key);
-    if (bundleIt == disableEvents_.end()) {
+    EVENT_LOGD(LOG_TAG_STATIC, "enter");
+
+    std::vector<int32_t> foregroundUserIds;
+    if (DelayedSingleton<OsAccountManagerHelper>::GetInstance()->GetForegroundUserIds(foregroundUserIds) != ERR_OK) {
+        EVENT_LOGW(LOG_TAG_STATIC, "GetForegroundUserIds failed, init all subscribers");
+        return InitValidSubscribers();
+    }
+    std::set<int32_t> users(foregroundUserIds.begin(), foregroundUserIds.end());
+    for (auto userId : loadedUsers_) {
+        if (users.find(userId) == users.end()) {
+            RemoveUserSubscribers(userId);
+        }
+    }
+    for (auto userId : users) {
+        if (loadedUsers_.find(userId) == loadedUsers_.end() && !AddUserSubscribers(userId)) {
+            EVENT_LOGW(LOG_TAG_STATIC, "Add subscribers of user %{public}d failed, init all subscribers", userId);
+            return InitValidSubscribers();
+        }
+    }
+    loadedUsers_ = std::move(users);
+    GetSnapshot().Save();
+    return true;
+}
+
+bool StaticSubscriberManager::AddUserSubscribers(const int32_t &userId)
+{
+    EVENT_LOGD(LOG_TAG_STATIC, "enter, userId = %{public}d", userId);
+
+    std::vector<AppExecFwk::ApplicationInfo> appInfos {};
+    if (!DelayedSingleton<BundleManagerHelper>::GetInstance()
+            ->GetApplicationInfos(AppExecFwk::ApplicationFlag::GET_BASIC_APPLICATION_INFO, userId, appInfos)) {
+        EVENT_LOGE(LOG_TAG_STATIC, "GetApplicationInfos failed");
         return false;
     }
-    auto eventIt = std::find(bundleIt->second.begin(), bundleIt->second.end(), event);
-    if (eventIt != bundleIt->second.end()) {
-        return true;
+    AddToAllowList(appInfos);
+
+    std::vector<AppExecFwk::ExtensionAbilityInfo> extensions;
+    if (!DelayedSingleton<BundleManagerHelper>::GetInstance()->QueryExtensionInfos(extensions, userId)) {
+        EVENT_LOGE(LOG_TAG_STATIC, "QueryExtensionInfos failed");
+        return false;
     }
-    return false;
+    std::set<std::string> profileKeys;
+    AddValidExtensions(extensions, profileKeys);
+    GetSnapshot().Erase(StaticSubscriberSnapshot::GetUserPrefix(userId), profileKeys);
+    return true;
+}
+
+void StaticSubscriberManager::RemoveUserSubscribers(const int32_t &userId)
+{
+    EVENT_LOGD(LOG_TAG_STATIC, "enter, userId = %{public}d", userId);
+
+    for (auto it = validSubscribers_.begin(); it != validSubscribers_.end();) {
+        it->second.erase(std::remove_if(it->second.begin(), it->second.end(),
+            [userId](const StaticSubscriberInfo &subscriber) { return subscriber.userId == userId; }),
+            it->second.end());
+        if (it->second.empty()) {
+            it = validSubscribers_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // the disabled events stay, they are persisted state rather than part of the registry
+    std::string prefix = std::to_string(userId) + "_";
+    std::lock_guard<ffrt::recursive_mutex> lock(subscriberMutex_);
+    for (auto it = staticSubscribers_.lower_bound(prefix);
+        it != staticSubscribers_.end() && it->first.compare(0, prefix.size(), prefix) == 0;) {
+        it = staticSubscribers_.erase(it);
+    }
+    for (auto it = subscriberIdentities_.lower_bound(prefix);
+        it != subscriberIdentities_.end() && it->first.compare(0, prefix.size(), prefix) == 0;) {
+        it = subscriberIdentities_.erase(it);
+    }
+}
+
+StaticSubscriberSnapshot &StaticSubscriberManager::GetSnapshot()
+{
+    if (snapshot_ == nullptr) {
+        snapshot_ = std::make_unique<StaticSubscriberSnapshot>(STATIC_SUBSCRIBER_SNAPSHOT_PATH);
+        snapshot_->Load();
+    }
+    return *snapshot_;
+}
+
+bool StaticSubscriberManager::IsDisableEvent(const std::string &bundleName, const std::string &event, int32_t userId)
+{
+    EVENT_LOGD(LOG_TAG_STATIC, "Called.");
+    std::lock_guard<ffrt::mutex> lock(disableEventsMutex_);
+    return disableIndex_.Contains(userId, bundleName, event);
 }
 
 void StaticSubscriberManager::PublishCommonEventConnecAbility(const CommonEventData &data,
@@ -188,7 +298,15 @@ void StaticSubscriberManager::PublishCommonEventConnecAbility(const CommonEventD
     want.SetElementName(bundleName, abilityName);
     EVENT_LOGD(LOG_TAG_STATIC, "Ready to connect to subscriber %{public}s in bundle %{public}s",
         abilityName.c_str(), bundleName.c_str());
-    DelayedSingleton<AbilityManagerHelper>::GetInstance()->ConnectAbility(want, data, service, userId);
+    std::string action = data.GetWant().GetAction();
+    // boot events fan out to most static subscribers, let targeted events connect ahead of them
+    bool isPriority = action != CommonEventSupport::COMMON_EVENT_BOOT_COMPLETED &&
+        action != CommonEventSupport::COMMON_EVENT_LOCKED_BOOT_COMPLETED;
+    DelayedSingleton<AbilityManagerHelper>::GetInstance()->ConnectAbilityAsync(want, data, service, userId,
+        isPriority, [action, bundleName](int result, size_t droppedCount) {
+            EVENT_LOGI(LOG_TAG_STATIC, "ConnectAbility %{public}s end, Subscriber = %{public}s, result = %{public}d, "
+                "dropped = %{public}zu", action.c_str(), bundleName.c_str(), result, droppedCount);
+        });
 }
 
 void StaticSubscriberManager::PublishCommonEventInner(const CommonEventData &data,
@@ -200,7 +318,8 @@ void StaticSubscriberManager::PublishCommonEventInner(const CommonEventData &dat
         return;
     }
     std::vector<StaticSubscriberInfo> bootStartHaps {};
-    for (auto subscriber : targetSubscribers->second) {
+    StaticSubscriberFilter::ParameterCache parameters(filterKeys_, data.GetWant().GetParams());
+    for (const auto &subscriber : targetSubscribers->second) {
         if (IsDisableEvent(subscriber.bundleName, targetSubscribers->first, subscriber.userId)) {
             EVENT_LOGW(LOG_TAG_STATIC, "subscriber %{public}s is disable.", subscriber.bundleName.c_str());
             SendStaticEventProcErrHiSysEvent(userId, bundleName, subscriber.bundleName, data.GetWant().GetAction());
@@ -229,7 +348,9 @@ void StaticSubscriberManager::PublishCommonEventInner(const CommonEventData &dat
             SendStaticEventProcErrHiSysEvent(userId, bundleName, subscriber.bundleName, data.GetWant().GetAction());
             continue;
         }
-        if (!IsFilterParameters(subscriber, data)) {
+        bool isFilterMatched = subscriber.filter != nullptr ? subscriber.filter->Match(data, parameters) :
+            IsFilterParameters(subscriber, data);
+        if (!isFilterMatched) {
             EVENT_LOGD(LOG_TAG_STATIC, "subscriber filter parameters is not match, subscriber.bundleName = %{public}s",
                 subscriber.bundleName.c_str());
             continue;
@@ -239,13 +360,9 @@ void StaticSubscriberManager::PublishCommonEventInner(const CommonEventData &dat
             bootStartHaps.push_back(subscriber);
         } else {
             PublishCommonEventConnecAbility(data, service, subscriber.userId, subscriber.bundleName, subscriber.name);
-            EVENT_LOGI(LOG_TAG_STATIC, "ConnectAbility %{public}s end, Subscriber = %{public}s",
-                data.GetWant().GetAction().c_str(), subscriber.bundleName.c_str());
         }
 #else
         PublishCommonEventConnecAbility(data, service, subscriber.userId, subscriber.bundleName, subscriber.name);
-        EVENT_LOGI(LOG_TAG_STATIC, "ConnectAbility %{public}s end, Subscriber = %{public}s",
-            data.GetWant().GetAction().c_str(), subscriber.bundleName.c_str());
 #endif
     }
 #ifdef WATCH_EVENT_BOOT_COMPLETED_DELAY
@@ -259,8 +376,6 @@ void StaticSubscriberManager::PublishCommonEventInner(const CommonEventData &dat
             for (auto subscriber : bootStartHaps) {
                 StaticSubscriberManager::GetInstance()->PublishCommonEventConnecAbility(data, service,
                     subscriber.userId, subscriber.bundleName, subscriber.name);
-                EVENT_LOGI(LOG_TAG_STATIC, "ConnectAbility %{public}s end, Subscriber = %{public}s",
-                    data.GetWant().GetAction().c_str(), subscriber.bundleName.c_str());
             }
         };
         ffrt_->submit(task, ffrt::task_attr().delay(g_bootDelayTime * TIME_UNIT_SIZE));
@@ -293,23 +408,23 @@ bool StaticSubscriberManager::CheckSubscriberWhetherMatched(
         publishInfo.GetBundleName() == subscriber.bundleName) {
         checkResult |= SUBSCRIBER_FILTER_BUNDLE_INDEX;
     }
-    auto isSystemApp = DelayedSingleton<BundleManagerHelper>::GetInstance()->
-        CheckIsSystemAppByBundleName(subscriber.bundleName, subscriber.userId);
+    // an identity that failed to resolve is not stored, the cache serves the retry once bundle manager answers
+    auto identity = subscriber.identity != nullptr && subscriber.identity->uid >= 0 ? subscriber.identity :
+        GetSubscriberIdentity(subscriber.bundleName, subscriber.userId);
     bool isTypeMatched = specifiedSubscriberType == static_cast<int32_t>(SubscriberType::ALL_SUBSCRIBER_TYPE) ||
-        (specifiedSubscriberType == static_cast<int32_t>(SubscriberType::SYSTEM_SUBSCRIBER_TYPE) && isSystemApp);
+        (specifiedSubscriberType == static_cast<int32_t>(SubscriberType::SYSTEM_SUBSCRIBER_TYPE) &&
+        identity->isSystemApp);
     if (specifiedSubscriberType != UNINITIALIZATED_SUBSCRIBER_TYPE && isTypeMatched) {
         checkResult |= SUBSCRIBER_FILTER_SUBSCRIBER_TYPE_INDEX;
     }
 
-    auto subscriberUid = DelayedSingleton<BundleManagerHelper>::GetInstance()->
-        GetDefaultUidByBundleName(subscriber.bundleName, subscriber.userId);
     if (!specifiedSubscriberUids.empty() &&
-        CheckSubscriberBySpecifiedUids(static_cast<int32_t>(subscriberUid), specifiedSubscriberUids)) {
+        CheckSubscriberBySpecifiedUids(identity->uid, specifiedSubscriberUids)) {
         checkResult |= SUBSCRIBER_FILTER_SUBSCRIBER_UID_INDEX;
     }
     std::vector<std::string> publisherRequiredPermissions = publishInfo.GetSubscriberPermissions();
     if (!publisherRequiredPermissions.empty() &&
-        VerifySubscriberPermission(subscriber.bundleName, subscriber.userId, publisherRequiredPermissions)) {
+        VerifySubscriberPermission(identity->tokenId, publisherRequiredPermissions)) {
         checkResult |= SUBSCRIBER_FILTER_PERMISSION_INDEX;
     }
     bool result = false;
@@ -334,9 +449,13 @@ void StaticSubscriberManager::PublishCommonEvent(const CommonEventData &data,
     std::string event = data.GetWant().GetAction();
     EVENT_LOGD(LOG_TAG_STATIC, "enter, event = %{public}s, userId = %{public}d", event.c_str(), userId);
 
-    if ((!hasInitValidSubscribers_ || event == CommonEventSupport::COMMON_EVENT_USER_FOREGROUND) &&
-        !InitValidSubscribers()) {
-        EVENT_LOGE(LOG_TAG_STATIC, "Failed to init subscribers");
+    if (!hasInitValidSubscribers_) {
+        if (!InitValidSubscribers()) {
+            EVENT_LOGE(LOG_TAG_STATIC, "Failed to init subscribers");
+            return;
+        }
+    } else if (event == CommonEventSupport::COMMON_EVENT_USER_FOREGROUND && !UpdateForegroundUsers()) {
+        EVENT_LOGE(LOG_TAG_STATIC, "Failed to update subscribers of foreground users");
         return;
     }
 
@@ -360,7 +479,12 @@ bool StaticSubscriberManager::VerifySubscriberPermission(const std::string &bund
     const std::vector<std::string> &permissions)
 {
     // get hap tokenid with default instindex(0), this should be modified later.
-    Security::AccessToken::AccessTokenID tokenId = AccessTokenHelper::GetHapTokenID(userId, bundleName, 0);
+    return VerifySubscriberPermission(AccessTokenHelper::GetHapTokenID(userId, bundleName, 0), permissions);
+}
+
+bool StaticSubscriberManager::VerifySubscriberPermission(const Security::AccessToken::AccessTokenID &tokenId,
+    const std::vector<std::string> &permissions)
+{
     for (auto permission : permissions) {
         if (permission.empty()) {
             continue;
@@ -379,7 +503,15 @@ void StaticSubscriberManager::ParseEvents(const std::string &extensionName, cons
 {
     EVENT_LOGD(LOG_TAG_STATIC, "enter, subscriber name = %{public}s, bundle name = %{public}s, userId = %{public}d",
         extensionName.c_str(), extensionBundleName.c_str(), extensionUserId);
-    
+
+    std::vector<StaticSubscriberSnapshot::Subscriber> subscribers;
+    ParseProfile(extensionName, profile, subscribers);
+    AddParsedSubscribers(extensionName, extensionBundleName, extensionUserId, subscribers);
+}
+
+void StaticSubscriberManager::ParseProfile(const std::string &extensionName, const std::string &profile,
+    std::vector<StaticSubscriberSnapshot::Subscriber> &subscribers)
+{
     if (profile.empty()) {
         EVENT_LOGE(LOG_TAG_STATIC, "invalid profile");
         return;
@@ -421,37 +553,55 @@ void StaticSubscriberManager::ParseEvents(const std::string &extensionName, cons
             EVENT_LOGW(LOG_TAG_STATIC, "invalid events obj");
             continue;
         }
-        std::string invalidEventsLogger = "";
-        std::string key = std::to_string(extensionUserId) + "_" + extensionBundleName;
         for (auto e : commonEventObj[JSON_KEY_EVENTS]) {
             if (e.is_null() || !e.is_string()) {
                 EVENT_LOGW(LOG_TAG_STATIC, "invalid json obj");
                 continue;
             }
             std::string eventName = e.get<std::string>();
-            {
-                std::lock_guard<ffrt::recursive_mutex> lock(subscriberMutex_);
-                if (staticSubscribers_.find(key) == staticSubscribers_.end()) {
-                    invalidEventsLogger.append(key).append(",");
-                    continue;
-                }
-                if (std::find(staticSubscribers_[key].events.begin(), staticSubscribers_[key].events.end(),
-                    eventName) == staticSubscribers_[key].events.end()) {
-                    invalidEventsLogger.append(eventName).append(",");
-                    continue;
-                }
-            }
-            StaticSubscriberInfo subscriber = { .name = extensionName,
-                .bundleName = extensionBundleName,
-                .userId = extensionUserId,
-                .permission = commonEventObj[JSON_KEY_PERMISSION].get<std::string>()};
+            StaticSubscriberInfo subscriber = { .permission = commonEventObj[JSON_KEY_PERMISSION].get<std::string>() };
             ParseFilterObject(commonEventObj[JSON_KEY_FILTER], eventName, subscriber);
-            AddToValidSubscribers(eventName, subscriber);
+            subscribers.push_back({ .event = eventName,
+                .permission = subscriber.permission,
+                .filterCode = subscriber.filterCode,
+                .filterData = subscriber.filterData,
+                .filterParameters = subscriber.filterParameters });
         }
-        if (!invalidEventsLogger.empty()) {
-            EVENT_LOGW(LOG_TAG_STATIC, "%{public}s is not match between profile and allowCommonEvent",
-                invalidEventsLogger.c_str());
+    }
+}
+
+void StaticSubscriberManager::AddParsedSubscribers(const std::string &extensionName,
+    const std::string &extensionBundleName, const int32_t &extensionUserId,
+    const std::vector<StaticSubscriberSnapshot::Subscriber> &subscribers)
+{
+    std::string invalidEventsLogger = "";
+    std::string key = std::to_string(extensionUserId) + "_" + extensionBundleName;
+    for (const auto &parsed : subscribers) {
+        {
+            std::lock_guard<ffrt::recursive_mutex> lock(subscriberMutex_);
+            auto finder = staticSubscribers_.find(key);
+            if (finder == staticSubscribers_.end()) {
+                invalidEventsLogger.append(key).append(",");
+                continue;
+            }
+            if (std::find(finder->second.events.begin(), finder->second.events.end(), parsed.event) ==
+                finder->second.events.end()) {
+                invalidEventsLogger.append(parsed.event).append(",");
+                continue;
+            }
         }
+        StaticSubscriberInfo subscriber = { .name = extensionName,
+            .bundleName = extensionBundleName,
+            .userId = extensionUserId,
+            .permission = parsed.permission,
+            .filterCode = parsed.filterCode,
+            .filterData = parsed.filterData,
+            .filterParameters = parsed.filterParameters };
+        AddToValidSubscribers(parsed.event, subscriber);
+    }
+    if (!invalidEventsLogger.empty()) {
+        EVENT_LOGW(LOG_TAG_STATIC, "%{public}s is not match between profile and allowCommonEvent",
+            invalidEventsLogger.c_str());
     }
 }
 
@@ -459,20 +609,60 @@ void StaticSubscriberManager::AddSubscriber(const AppExecFwk::ExtensionAbilityIn
 {
     EVENT_LOGD(LOG_TAG_STATIC, "enter, subscriber bundlename = %{public}s", extension.bundleName.c_str());
 
+    int32_t userId = ALL_USER;
+    if (DelayedSingleton<OsAccountManagerHelper>::GetInstance()->GetOsAccountLocalIdFromUid(
+        extension.applicationInfo.uid, userId) != ERR_OK) {
+        EVENT_LOGE(LOG_TAG_STATIC, "Get userId failed, uid = %{public}d", extension.applicationInfo.uid);
+        return;
+    }
+    // the profile is packed in the hap, a reinstall or upgrade changes the path or the version
+    std::string fingerprint = extension.hapPath.empty() ? "" :
+        extension.hapPath + "#" + std::to_string(extension.applicationInfo.versionCode);
+    std::string snapshotKey = StaticSubscriberSnapshot::GetKey(userId, extension.bundleName, extension.name);
+    if (!fingerprint.empty()) {
+        const auto *cached = GetSnapshot().Find(snapshotKey, fingerprint);
+        if (cached != nullptr) {
+            AddParsedSubscribers(extension.name, extension.bundleName, userId, cached->subscribers);
+            return;
+        }
+    }
+
     std::vector<std::string> profileInfos;
     if (!DelayedSingleton<BundleManagerHelper>::GetInstance()->GetResConfigFile(extension, profileInfos)) {
         EVENT_LOGE(LOG_TAG_STATIC, "GetProfile failed");
         return;
     }
+    StaticSubscriberSnapshot::Profile parsed = { .fingerprint = fingerprint };
     for (auto profile : profileInfos) {
-        int32_t userId = ALL_USER;
-        if (DelayedSingleton<OsAccountManagerHelper>::GetInstance()->GetOsAccountLocalIdFromUid(
-            extension.applicationInfo.uid, userId) != ERR_OK) {
-            EVENT_LOGE(LOG_TAG_STATIC, "Get userId failed, uid = %{public}d", extension.applicationInfo.uid);
-            return;
-        }
-        ParseEvents(extension.name, extension.bundleName, userId, profile);
+        ParseProfile(extension.name, profile, parsed.subscribers);
+    }
+    AddParsedSubscribers(extension.name, extension.bundleName, userId, parsed.subscribers);
+    if (!fingerprint.empty()) {
+        GetSnapshot().Put(snapshotKey, std::move(parsed));
+    }
+}
+
+std::shared_ptr<const StaticSubscriberManager::SubscriberIdentity> StaticSubscriberManager::GetSubscriberIdentity(
+    const std::string &bundleName, const int32_t &userId)
+{
+    std::string key = std::to_string(userId) + "_" + bundleName;
+    std::lock_guard<ffrt::recursive_mutex> lock(subscriberMutex_);
+    auto iter = subscriberIdentities_.find(key);
+    if (iter != subscriberIdentities_.end()) {
+        return iter->second;
+    }
+    auto identity = std::make_shared<SubscriberIdentity>();
+    identity->uid = DelayedSingleton<BundleManagerHelper>::GetInstance()->GetDefaultUidByBundleName(bundleName, userId);
+    identity->isSystemApp = DelayedSingleton<BundleManagerHelper>::GetInstance()->CheckIsSystemAppByUid(identity->uid);
+    // get hap tokenid with default instindex(0), this should be modified later.
+    identity->tokenId = AccessTokenHelper::GetHapTokenID(userId, bundleName, 0);
+    if (identity->uid < 0) {
+        // bundle manager not reachable or bundle gone, resolve again next time
+        EVENT_LOGW(LOG_TAG_STATIC, "get invalid uid of %{public}s, userId = %{public}d", bundleName.c_str(), userId);
+        return identity;
     }
+    subscriberIdentities_.emplace(key, identity);
+    return identity;
 }
 
 void StaticSubscriberManager::AddToValidSubscribers(const std::string &eventName,
@@ -491,6 +681,14 @@ void StaticSubscriberManager::AddToValidSubscribers(const std::string &eventName
         }
     }
     validSubscribers_[eventName].emplace_back(subscriber);
+    if (subscriber.identity == nullptr || subscriber.identity->uid < 0) {
+        auto identity = GetSubscriberIdentity(subscriber.bundleName, subscriber.userId);
+        validSubscribers_[eventName].back().identity = identity->uid < 0 ? nullptr : identity;
+    }
+    if (subscriber.filter == nullptr) {
+        validSubscribers_[eventName].back().filter = StaticSubscriberFilter::Compile(
+            subscriber.filterCode, subscriber.filterData, subscriber.filterParameters, filterKeys_);
+    }
     EVENT_LOGD(LOG_TAG_STATIC, "subscriber added, event = %{public}s,bundlename = %{public}s,name = %{public}s,"
         "userId = %{public}d", eventName.c_str(), subscriber.bundleName.c_str(), subscriber.name.c_str(),
         subscriber.userId);
@@ -500,6 +698,10 @@ void StaticSubscriberManager::AddSubscriberWithBundleName(const std::string &bun
 {
     EVENT_LOGD(LOG_TAG_STATIC, "enter, bundleName = %{public}s, userId = %{public}d", bundleName.c_str(), userId);
 
+    {
+        std::lock_guard<ffrt::recursive_mutex> lock(subscriberMutex_);
+        subscriberIdentities_.erase(std::to_string(userId) + "_" + bundleName);
+    }
     std::vector<AppExecFwk::ExtensionAbilityInfo> extensions;
     if (!DelayedSingleton<BundleManagerHelper>::GetInstance()->QueryExtensionInfos(extensions, userId)) {
         EVENT_LOGE(LOG_TAG_STATIC, "QueryExtensionInfos failed");
@@ -540,15 +742,20 @@ void StaticSubscriberManager::RemoveSubscriberWithBundleName(const std::string &
     }
 
     std::string key = std::to_string(userId) + "_" + bundleName;
+    {
+        std::lock_guard<ffrt::recursive_mutex> lock(subscriberMutex_);
+        subscriberIdentities_.erase(key);
+    }
+    GetSnapshot().Erase(StaticSubscriberSnapshot::GetBundlePrefix(userId, bundleName));
     auto bundleIt = disableEvents_.find(key);
     if (bundleIt == disableEvents_.end()) {
         EVENT_LOGD(LOG_TAG_STATIC, "Bundle name is not existed.");
         return;
     }
     disableEvents_.erase(bundleIt);
-    auto result =
-        DelayedSingleton<StaticSubscriberDataManager>::GetInstance()->DeleteDisableEventElementByBundleName(key);
-    if (result != ERR_OK) {
+    disableIndex_.Set(key, {});
+    if (DelayedSingleton<StaticSubscriberDataManager>::GetInstance()->UpdateStaticSubscriberStateAsync(key, {}) !=
+        ERR_OK) {
         EVENT_LOGE(LOG_TAG_STATIC, "Remove disable event by bundle name failed.");
     }
 }
@@ -558,6 +765,11 @@ void StaticSubscriberManager::UpdateSubscriber(const CommonEventData &data)
     NOTIFICATION_HITRACE(HITRACE_TAG_NOTIFICATION);
     EVENT_LOGD(LOG_TAG_STATIC, "enter");
 
+    if (data.GetWant().GetAction() == CommonEventSupport::COMMON_EVENT_USER_REMOVED) {
+        GetSnapshot().Erase(StaticSubscriberSnapshot::GetUserPrefix(data.GetCode()));
+        GetSnapshot().Save();
+        return;
+    }
     if ((data.GetWant().GetAction() != CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED) &&
         (data.GetWant().GetAction() != CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED) &&
         (data.GetWant().GetAction() != CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED)) {
@@ -572,6 +784,11 @@ void StaticSubscriberManager::UpdateSubscriber(const CommonEventData &data)
         EVENT_LOGW(LOG_TAG_STATIC, "GetOsAccountLocalIdFromUid failed, uid = %{public}d", uid);
         return;
     }
+    if (data.GetWant().GetAction() == CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED) {
+        // also for users that are not active, e.g. the system user of singleton apps
+        GetSnapshot().Erase(StaticSubscriberSnapshot::GetBundlePrefix(userId, bundleName));
+        GetSnapshot().Save();
+    }
     std::vector<int> osAccountIds;
     if (DelayedSingleton<OsAccountManagerHelper>::GetInstance()->QueryActiveOsAccountIds(osAccountIds) != ERR_OK) {
         EVENT_LOGW(LOG_TAG_STATIC, "failed to QueryActiveOsAccountIds!");
@@ -593,6 +810,7 @@ void StaticSubscriberManager::UpdateSubscriber(const CommonEventData &data)
         RemoveSubscriberWithBundleName(bundleName, userId);
         AddSubscriberWithBundleName(bundleName, userId);
     }
+    GetSnapshot().Save();
 }
 
 void StaticSubscriberManager::SendStaticEventProcErrHiSysEvent(int32_t userId, const std::string &publisherName,
@@ -613,36 +831,46 @@ int32_t StaticSubscriberManager::UpdateDisableEvents(
     std::lock_guard<ffrt::mutex> lock(disableEventsMutex_);
     std::string key = std::to_string(userId) + "_" + bundleName;
     auto finder = disableEvents_.find(key);
+    std::vector<std::string> currentEvents;
     if (finder == disableEvents_.end()) {
-        if (!enable) {
-            disableEvents_.emplace(key, events);
-        }
-        return DelayedSingleton<StaticSubscriberDataManager>::GetInstance()->
-            UpdateStaticSubscriberState(disableEvents_);
-    }
-
-    for (auto &event : events) {
-        auto &currentEvents = finder->second;
-        auto iter = std::find(currentEvents.begin(), currentEvents.end(), event);
         if (enable) {
-            if (iter == currentEvents.end()) {
-                continue;
-            }
-            if (iter != currentEvents.end()) {
-                currentEvents.erase(iter);
-            }
-        } else {
-            if (iter == currentEvents.end()) {
-                currentEvents.emplace_back(event);
+            return ERR_OK;
+        }
+        currentEvents = events;
+    } else {
+        currentEvents = finder->second;
+        for (auto &event : events) {
+            auto iter = std::find(currentEvents.begin(), currentEvents.end(), event);
+            if (enable) {
+                if (iter != currentEvents.end()) {
+                    currentEvents.erase(iter);
+                }
+            } else {
+                if (iter == currentEvents.end()) {
+                    currentEvents.emplace_back(event);
+                }
             }
         }
     }
 
-    if (finder->second.empty()) {
-        disableEvents_.erase(finder);
+    // only the changed bundle is journaled before answering, the kv store is written behind
+    int32_t ret = DelayedSingleton<StaticSubscriberDataManager>::GetInstance()->
+        UpdateStaticSubscriberStateAsync(key, currentEvents);
+    if (ret != ERR_OK) {
+        EVENT_LOGE(LOG_TAG_STATIC, "Update static subscriber state failed, ret = %{public}d", ret);
+        return ret;
     }
-
-    return DelayedSingleton<StaticSubscriberDataManager>::GetInstance()->UpdateStaticSubscriberState(disableEvents_);
+    disableIndex_.Set(key, currentEvents);
+    if (currentEvents.empty()) {
+        if (finder != disableEvents_.end()) {
+            disableEvents_.erase(finder);
+        }
+    } else if (finder == disableEvents_.end()) {
+        disableEvents_.emplace(key, std::move(currentEvents));
+    } else {
+        finder->second = std::move(currentEvents);
+    }
+    return ERR_OK;
 }
 
 int32_t StaticSubscriberManager::SetStaticSubscriberState(bool enable)
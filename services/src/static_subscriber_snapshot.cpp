@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "static_subscriber_snapshot.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "event_log_wrapper.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+constexpr uint32_t SNAPSHOT_MAGIC = 0x53534543;  // "CESS"
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+constexpr uint8_t FLAG_FILTER_CODE = 0x01;
+constexpr uint8_t FLAG_FILTER_DATA = 0x02;
+constexpr const char *SNAPSHOT_TMP_SUFFIX = ".tmp";
+
+class SnapshotWriter {
+public:
+    template<typename T>
+    void Write(const T &value)
+    {
+        buffer_.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    void WriteString(const std::string &value)
+    {
+        Write(static_cast<uint32_t>(value.size()));
+        buffer_.append(value);
+    }
+
+    std::string &GetBuffer()
+    {
+        return buffer_;
+    }
+
+private:
+    std::string buffer_;
+};
+
+class SnapshotReader {
+public:
+    explicit SnapshotReader(const std::string &buffer) : buffer_(buffer) {}
+
+    template<typename T>
+    bool Read(T &value)
+    {
+        if (buffer_.size() - offset_ < sizeof(T)) {
+            return false;
+        }
+        if (memcpy_s(&value, sizeof(T), buffer_.data() + offset_, sizeof(T)) != EOK) {
+            return false;
+        }
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string &value)
+    {
+        uint32_t size = 0;
+        if (!Read(size) || buffer_.size() - offset_ < size) {
+            return false;
+        }
+        value.assign(buffer_, offset_, size);
+        offset_ += size;
+        return true;
+    }
+
+    bool IsEnd() const
+    {
+        return offset_ == buffer_.size();
+    }
+
+private:
+    const std::string &buffer_;
+    size_t offset_ = 0;
+};
+
+void WriteParameter(SnapshotWriter &writer, const StaticSubscriberSnapshot::ParameterType &value)
+{
+    writer.Write(static_cast<uint8_t>(value.index()));
+    if (std::holds_alternative<bool>(value)) {
+        writer.Write(static_cast<uint8_t>(std::get<bool>(value)));
+    } else if (std::holds_alternative<int32_t>(value)) {
+        writer.Write(std::get<int32_t>(value));
+    } else if (std::holds_alternative<double>(value)) {
+        writer.Write(std::get<double>(value));
+    } else {
+        writer.WriteString(std::get<std::string>(value));
+    }
+}
+
+bool ReadParameter(SnapshotReader &reader, StaticSubscriberSnapshot::ParameterType &value)
+{
+    uint8_t index = 0;
+    if (!reader.Read(index)) {
+        return false;
+    }
+    switch (index) {
+        case 0: {
+            uint8_t boolValue = 0;
+            if (!reader.Read(boolValue)) {
+                return false;
+            }
+            value = boolValue != 0;
+            return true;
+        }
+        case 1: {
+            int32_t intValue = 0;
+            if (!reader.Read(intValue)) {
+                return false;
+            }
+            value = intValue;
+            return true;
+        }
+        case 2: {
+            double doubleValue = 0;
+            if (!reader.Read(doubleValue)) {
+                return false;
+            }
+            value = doubleValue;
+            return true;
+        }
+        case 3: {
+            std::string stringValue;
+            if (!reader.ReadString(stringValue)) {
+                return false;
+            }
+            value = std::move(stringValue);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool ReadSubscriber(SnapshotReader &reader, StaticSubscriberSnapshot::Subscriber &subscriber)
+{
+    uint8_t flags = 0;
+    if (!reader.ReadString(subscriber.event) || !reader.ReadString(subscriber.permission) || !reader.Read(flags)) {
+        return false;
+    }
+    if ((flags & FLAG_FILTER_CODE) != 0) {
+        int32_t code = 0;
+        if (!reader.Read(code)) {
+            return false;
+        }
+        subscriber.filterCode = code;
+    }
+    if ((flags & FLAG_FILTER_DATA) != 0) {
+        std::string data;
+        if (!reader.ReadString(data)) {
+            return false;
+        }
+        subscriber.filterData = std::move(data);
+    }
+    uint32_t parameterCount = 0;
+    if (!reader.Read(parameterCount)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < parameterCount; ++i) {
+        std::string name;
+        StaticSubscriberSnapshot::ParameterType value;
+        if (!reader.ReadString(name) || !ReadParameter(reader, value)) {
+            return false;
+        }
+        subscriber.filterParameters.emplace(std::move(name), std::move(value));
+    }
+    return true;
+}
+
+bool WriteFile(int fd, const std::string &buffer)
+{
+    size_t written = 0;
+    while (written < buffer.size()) {
+        ssize_t ret = write(fd, buffer.data() + written, buffer.size() - written);
+        if (ret < 0 && errno != EINTR) {
+            return false;
+        }
+        written += ret > 0 ? static_cast<size_t>(ret) : 0;
+    }
+    return fsync(fd) == 0;
+}
+
+bool SyncParentDirectory(const std::string &path)
+{
+    size_t pos = path.rfind('/');
+    std::string dir = (pos == std::string::npos) ? "." : path.substr(0, pos == 0 ? 1 : pos);
+    int fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    bool result = fsync(fd) == 0;
+    close(fd);
+    return result;
+}
+}
+
+StaticSubscriberSnapshot::StaticSubscriberSnapshot(const std::string &path) : path_(path) {}
+
+bool StaticSubscriberSnapshot::Load()
+{
+    profiles_.clear();
+    dirty_ = false;
+    std::ifstream file(path_, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        EVENT_LOGD(LOG_TAG_STATIC, "no static subscriber snapshot");
+        return false;
+    }
+    std::string buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (!Parse(buffer)) {
+        EVENT_LOGW(LOG_TAG_STATIC, "invalid static subscriber snapshot, size = %{public}zu", buffer.size());
+        profiles_.clear();
+        // rewrite the file on next save
+        dirty_ = true;
+        return false;
+    }
+    EVENT_LOGI(LOG_TAG_STATIC, "static subscriber snapshot loaded, profiles = %{public}zu", profiles_.size());
+    return true;
+}
+
+bool StaticSubscriberSnapshot::Save()
+{
+    if (!dirty_) {
+        return true;
+    }
+    std::string tmpPath = path_ + SNAPSHOT_TMP_SUFFIX;
+    int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        EVENT_LOGE(LOG_TAG_STATIC, "failed to open static subscriber snapshot, errno = %{public}d", errno);
+        return false;
+    }
+    // the content must be on disk before the rename, or a crash may leave an empty file in place of the old one
+    bool written = WriteFile(fd, Serialize());
+    close(fd);
+    if (!written) {
+        EVENT_LOGE(LOG_TAG_STATIC, "failed to write static subscriber snapshot, errno = %{public}d", errno);
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    if (std::rename(tmpPath.c_str(), path_.c_str()) != 0) {
+        EVENT_LOGE(LOG_TAG_STATIC, "failed to rename static subscriber snapshot");
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    if (!SyncParentDirectory(path_)) {
+        EVENT_LOGW(LOG_TAG_STATIC, "failed to sync static subscriber snapshot directory");
+    }
+    dirty_ = false;
+    return true;
+}
+
+const StaticSubscriberSnapshot::Profile *StaticSubscriberSnapshot::Find(
+    const std::string &key, const std::string &fingerprint) const
+{
+    auto iter = profiles_.find(key);
+    if (iter == profiles_.end() || iter->second.fingerprint != fingerprint) {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+void StaticSubscriberSnapshot::Put(const std::string &key, Profile profile)
+{
+    profiles_[key] = std::move(profile);
+    dirty_ = true;
+}
+
+void StaticSubscriberSnapshot::Erase(const std::string &prefix, const std::set<std::string> &kept)
+{
+    for (auto iter = profiles_.lower_bound(prefix);
+        iter != profiles_.end() && iter->first.compare(0, prefix.size(), prefix) == 0;) {
+        if (kept.find(iter->first) != kept.end()) {
+            ++iter;
+            continue;
+        }
+        iter = profiles_.erase(iter);
+        dirty_ = true;
+    }
+}
+
+std::string StaticSubscriberSnapshot::GetKey(
+    int32_t userId, const std::string &bundleName, const std::string &extensionName)
+{
+    return GetBundlePrefix(userId, bundleName) + extensionName;
+}
+
+std::string StaticSubscriberSnapshot::GetUserPrefix(int32_t userId)
+{
+    return std::to_string(userId) + "_";
+}
+
+std::string StaticSubscriberSnapshot::GetBundlePrefix(int32_t userId, const std::string &bundleName)
+{
+    return GetUserPrefix(userId) + bundleName + "/";
+}
+
+bool StaticSubscriberSnapshot::Parse(const std::string &buffer)
+{
+    SnapshotReader reader(buffer);
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint32_t profileCount = 0;
+    if (!reader.Read(magic) || magic != SNAPSHOT_MAGIC || !reader.Read(version) || version != SNAPSHOT_VERSION ||
+        !reader.Read(profileCount)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < profileCount; ++i) {
+        std::string key;
+        Profile profile;
+        uint32_t subscriberCount = 0;
+        if (!reader.ReadString(key) || !reader.ReadString(profile.fingerprint) || !reader.Read(subscriberCount)) {
+            return false;
+        }
+        for (uint32_t j = 0; j < subscriberCount; ++j) {
+            Subscriber subscriber;
+            if (!ReadSubscriber(reader, subscriber)) {
+                return false;
+            }
+            profile.subscribers.emplace_back(std::move(subscriber));
+        }
+        profiles_.emplace(std::move(key), std::move(profile));
+    }
+    return reader.IsEnd();
+}
+
+std::string StaticSubscriberSnapshot::Serialize() const
+{
+    SnapshotWriter writer;
+    writer.Write(SNAPSHOT_MAGIC);
+    writer.Write(SNAPSHOT_VERSION);
+    writer.Write(static_cast<uint32_t>(profiles_.size()));
+    for (const auto &[key, profile] : profiles_) {
+        writer.WriteString(key);
+        writer.WriteString(profile.fingerprint);
+        writer.Write(static_cast<uint32_t>(profile.subscribers.size()));
+        for (const auto &subscriber : profile.subscribers) {
+            writer.WriteString(subscriber.event);
+            writer.WriteString(subscriber.permission);
+            uint8_t flags = (subscriber.filterCode.has_value() ? FLAG_FILTER_CODE : 0) |
+                (subscriber.filterData.has_value() ? FLAG_FILTER_DATA : 0);
+            writer.Write(flags);
+            if (subscriber.filterCode.has_value()) {
+                writer.Write(subscriber.filterCode.value());
+            }
+            if (subscriber.filterData.has_value()) {
+                writer.WriteString(subscriber.filterData.value());
+            }
+            writer.Write(static_cast<uint32_t>(subscriber.filterParameters.size()));
+            for (const auto &[name, value] : subscriber.filterParameters) {
+                writer.WriteString(name);
+                WriteParameter(writer, value);
+            }
+        }
+    }
+    return std::move(writer.GetBuffer());
+}
+}  // namespace EventFwk
+}  // namespace OHOS
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "structured_dump.h"
+
+#include <ctime>
+
+namespace OHOS {
+namespace EventFwk {
+namespace {
+const char *GetEventStateName(int8_t state)
+{
+    switch (state) {
+        case OrderedEventRecord::IDLE:
+            return "IDLE";
+        case OrderedEventRecord::RECEIVING:
+            return "RECEIVING";
+        case OrderedEventRecord::RECEIVED:
+            return "RECEIVED";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+const char *GetDeliveryStateName(uint8_t state)
+{
+    switch (state) {
+        case OrderedEventRecord::PENDING:
+            return "PENDING";
+        case OrderedEventRecord::DELIVERED:
+            return "DELIVERED";
+        case OrderedEventRecord::SKIPPED:
+            return "SKIPPED";
+        case OrderedEventRecord::TIMEOUT:
+            return "TIMEOUT";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+int64_t ToEpochSeconds(const struct tm &time)
+{
+    struct tm copy = time;
+    return static_cast<int64_t>(mktime(&copy));
+}
+}
+
+nlohmann::json StructuredDump::FromEventRecord(const CommonEventRecord &record)
+{
+    nlohmann::json root = {
+        { "time", ToEpochSeconds(record.recordTime) },
+        { "pid", record.eventRecordInfo.pid },
+        { "uid", record.eventRecordInfo.uid },
+        { "userId", record.userId },
+        { "bundleName", record.eventRecordInfo.bundleName },
+        { "isSystemApp", record.eventRecordInfo.isSystemApp },
+        { "isSystemEvent", record.isSystemEvent },
+        { "publishTime", record.publishTime },
+    };
+    if (record.publishInfo != nullptr) {
+        root["isSticky"] = record.publishInfo->IsSticky();
+        root["isOrdered"] = record.publishInfo->IsOrdered();
+        root["requiredPermissions"] = record.publishInfo->GetSubscriberPermissions();
+    }
+    if (record.commonEventData != nullptr) {
+        const Want &want = record.commonEventData->GetWant();
+        root["action"] = want.GetAction();
+        root["entities"] = want.GetEntities();
+        root["scheme"] = want.GetScheme();
+        root["uri"] = want.GetUriString();
+        root["flags"] = want.GetFlags();
+        root["type"] = want.GetType();
+        root["wantBundleName"] = want.GetBundle();
+        root["abilityName"] = want.GetElement().GetAbilityName();
+        root["code"] = record.commonEventData->GetCode();
+        root["data"] = record.commonEventData->GetData();
+    }
+    return root;
+}
+
+nlohmann::json StructuredDump::FromOrderedEventRecord(const OrderedEventRecord &record)
+{
+    nlohmann::json root = FromEventRecord(record);
+    root["hasLastSubscriber"] = record.resultTo != nullptr;
+    root["state"] = GetEventStateName(record.state.load());
+    root["dispatchTime"] = record.dispatchTime;
+    root["receiverTime"] = record.receiverTime;
+    root["resultAbort"] = record.resultAbort;
+    nlohmann::json receivers = nlohmann::json::array();
+    for (size_t index = 0; index < record.receivers.size(); ++index) {
+        const auto &receiver = record.receivers[index];
+        if (receiver == nullptr) {
+            continue;
+        }
+        nlohmann::json item = FromSubscriberRecord(*receiver, receiver->isFreeze, receiver->freezeTime);
+        if (index < record.deliveryState.size()) {
+            item["deliveryState"] = GetDeliveryStateName(record.deliveryState[index]);
+        }
+        receivers.push_back(std::move(item));
+    }
+    root["receivers"] = std::move(receivers);
+    return root;
+}
+
+nlohmann::json StructuredDump::FromSubscriberRecord(
+    const EventSubscriberRecord &record, bool isFreeze, int64_t freezeTime)
+{
+    nlohmann::json root = {
+        { "time", ToEpochSeconds(record.recordTime) },
+        { "pid", record.eventRecordInfo.pid },
+        { "uid", record.eventRecordInfo.uid },
+        { "bundleName", record.eventRecordInfo.bundleName },
+        { "subId", record.eventRecordInfo.subId },
+        { "isFreeze", isFreeze },
+        { "freezeTime", freezeTime },
+    };
+    if (record.eventSubscribeInfo != nullptr) {
+        const MatchingSkills &matchingSkills = record.eventSubscribeInfo->GetMatchingSkills();
+        root["priority"] = record.eventSubscribeInfo->GetPriority();
+        root["userId"] = record.eventSubscribeInfo->GetUserId();
+        root["permission"] = record.eventSubscribeInfo->GetPermission();
+        root["events"] = matchingSkills.GetEventsRef();
+        root["eventPrefixes"] = matchingSkills.GetEventPrefixes();
+        root["entities"] = matchingSkills.GetEntities();
+        root["schemes"] = matchingSkills.GetSchemes();
+    }
+    if (record.flowControl != nullptr) {
+        root["flowControl"] = record.flowControl->Dump();
+    }
+    return root;
+}
+
+std::string StructuredDump::Serialize(const nlohmann::json &root, bool binary)
+{
+    if (!binary) {
+        return root.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+    }
+    std::vector<uint8_t> buffer = nlohmann::json::to_cbor(root);
+    return std::string(buffer.begin(), buffer.end());
+}
+}  // namespace EventFwk
+}  // namespace OHOS
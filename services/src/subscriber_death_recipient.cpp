@@ -34,7 +34,7 @@ void SubscriberDeathRecipient::OnRemoteDied(const wptr<IRemoteObject> &remote)
         return;
     }
 
-    DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->RemoveSubscriber(object);
+    DelayedSingleton<CommonEventSubscriberManager>::GetInstance()->RemoveSubscribersOnDeath(object);
 
     EVENT_LOGD(LOG_TAG_SUBSCRIBER, "OnRemoteDied end");
 }
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "subscriber_flow_control.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace EventFwk {
+bool SubscriberFlowControl::TryAcquire(const Config &config, const CommonEventRecord &eventRecord)
+{
+    if (!tracked_.load(std::memory_order_acquire)) {
+        return true;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (!draining_ && backlog_.empty() && inFlight_ < config.maxInFlight) {
+        inFlight_++;
+        return true;
+    }
+    DeferLocked(config, eventRecord);
+    return false;
+}
+
+void SubscriberFlowControl::OnSent(bool acquired)
+{
+    sent_.fetch_add(1, std::memory_order_relaxed);
+    if (acquired || !tracked_.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    inFlight_++;
+}
+
+void SubscriberFlowControl::Release()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (inFlight_ > 0) {
+        inFlight_--;
+    }
+}
+
+bool SubscriberFlowControl::Acknowledge(const Config &config, uint32_t count)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    tracked_.store(true, std::memory_order_release);
+    lastAckTime_ = std::chrono::steady_clock::now();
+    // the client also counts events that bypass this subscriber record, never bank more credit than was sent
+    uint64_t acked = std::min(acked_ + count, sent_.load(std::memory_order_relaxed));
+    inFlight_ -= std::min(acked - acked_, inFlight_);
+    acked_ = acked;
+    return StartDrainLocked(config);
+}
+
+std::shared_ptr<CommonEventRecord> SubscriberFlowControl::TakeDeferred(const Config &config)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (backlog_.empty() || inFlight_ >= config.maxInFlight) {
+        draining_ = false;
+        return nullptr;
+    }
+    std::shared_ptr<CommonEventRecord> record = std::move(backlog_.front());
+    backlog_.pop_front();
+    inFlight_++;
+    return record;
+}
+
+bool SubscriberFlowControl::StartAckTimer()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (backlog_.empty() || ackTimerPending_) {
+        return false;
+    }
+    ackTimerPending_ = true;
+    return true;
+}
+
+bool SubscriberFlowControl::OnAckTimeout(const Config &config)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    ackTimerPending_ = false;
+    // events the subscriber process dropped are never acknowledged, their credit would be lost for good
+    if (inFlight_ > 0 &&
+        std::chrono::steady_clock::now() - lastAckTime_ >= std::chrono::milliseconds(config.ackTimeoutMs)) {
+        reclaimed_ += inFlight_;
+        inFlight_ = 0;
+    }
+    return StartDrainLocked(config);
+}
+
+void SubscriberFlowControl::Close()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    backlog_.clear();
+    reclaimed_ += inFlight_;
+    inFlight_ = 0;
+}
+
+bool SubscriberFlowControl::StartDrainLocked(const Config &config)
+{
+    if (draining_ || backlog_.empty() || inFlight_ >= config.maxInFlight) {
+        return false;
+    }
+    draining_ = true;
+    return true;
+}
+
+void SubscriberFlowControl::DeferLocked(const Config &config, const CommonEventRecord &eventRecord)
+{
+    deferred_++;
+    if (config.policy == COALESCE && eventRecord.commonEventData != nullptr) {
+        const std::string &action = eventRecord.commonEventData->GetWant().GetAction();
+        auto iter = std::find_if(backlog_.begin(), backlog_.end(), [&action](const auto &record) {
+            return record->commonEventData != nullptr && record->commonEventData->GetWant().GetAction() == action;
+        });
+        if (iter != backlog_.end()) {
+            backlog_.erase(iter);
+            coalesced_++;
+        }
+    }
+    if (backlog_.size() >= config.maxBacklog) {
+        dropped_++;
+        if (config.policy != DROP_OLDEST || backlog_.empty()) {
+            return;
+        }
+        backlog_.pop_front();
+    }
+    backlog_.emplace_back(std::make_shared<CommonEventRecord>(eventRecord));
+}
+
+std::string SubscriberFlowControl::Dump() const
+{
+    if (!tracked_.load(std::memory_order_acquire)) {
+        return "";
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return "Sent: " + std::to_string(sent_.load(std::memory_order_relaxed)) +
+        " Acked: " + std::to_string(acked_) +
+        " Reclaimed: " + std::to_string(reclaimed_) +
+        " InFlight: " + std::to_string(inFlight_) +
+        " Backlog: " + std::to_string(backlog_.size()) +
+        " Deferred: " + std::to_string(deferred_) +
+        " Dropped: " + std::to_string(dropped_) +
+        " Coalesced: " + std::to_string(coalesced_);
+}
+}  // namespace EventFwk
+}  // namespace OHOS
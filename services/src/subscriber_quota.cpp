@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "subscriber_quota.h"
+
+#include <algorithm>
+
+#include "common_event_constant.h"
+
+namespace OHOS {
+namespace EventFwk {
+void SubscriberQuota::SetLimits(uint32_t maxTotal, uint32_t maxPerUid)
+{
+    maxTotal_ = maxTotal;
+    maxPerUid_ = maxPerUid;
+    warningTotal_ = static_cast<uint32_t>(maxTotal * WARNING_REPORT_PERCENTAGE);
+}
+
+SubscriberQuota::Result SubscriberQuota::Check(uid_t uid, bool checkUidQuota) const
+{
+    if (checkUidQuota && maxPerUid_ != 0 && GetUidCount(uid) >= maxPerUid_) {
+        return UID_QUOTA_EXCEEDED;
+    }
+    // reported once when crossed, the process killed at the limit takes a while to die
+    if (total_ == warningTotal_) {
+        return WARNING;
+    }
+    if (total_ == maxTotal_) {
+        return LIMIT_REACHED;
+    }
+    return ALLOWED;
+}
+
+void SubscriberQuota::Add(pid_t pid, uid_t uid)
+{
+    uint32_t &count = pidCounts_[pid];
+    if (count != 0) {
+        pidRanking_.erase({ count, pid });
+    }
+    count++;
+    pidRanking_.emplace(count, pid);
+    uidCounts_[uid]++;
+    total_++;
+}
+
+void SubscriberQuota::Remove(pid_t pid, uid_t uid)
+{
+    auto pidIt = pidCounts_.find(pid);
+    if (pidIt == pidCounts_.end()) {
+        return;
+    }
+    pidRanking_.erase({ pidIt->second, pid });
+    if (--pidIt->second == 0) {
+        pidCounts_.erase(pidIt);
+    } else {
+        pidRanking_.emplace(pidIt->second, pid);
+    }
+    auto uidIt = uidCounts_.find(uid);
+    if (uidIt != uidCounts_.end() && --uidIt->second == 0) {
+        uidCounts_.erase(uidIt);
+    }
+    total_--;
+}
+
+void SubscriberQuota::Clear()
+{
+    pidCounts_.clear();
+    pidRanking_.clear();
+    uidCounts_.clear();
+    total_ = 0;
+}
+
+uint32_t SubscriberQuota::GetUidCount(uid_t uid) const
+{
+    auto it = uidCounts_.find(uid);
+    return it == uidCounts_.end() ? 0 : it->second;
+}
+
+std::vector<std::pair<pid_t, uint32_t>> SubscriberQuota::GetTopPids(size_t topNum) const
+{
+    std::vector<std::pair<pid_t, uint32_t>> items;
+    items.reserve(std::min(topNum, pidRanking_.size()));
+    for (auto it = pidRanking_.begin(); it != pidRanking_.end() && items.size() < topNum; ++it) {
+        items.emplace_back(it->second, it->first);
+    }
+    return items;
+}
+}  // namespace EventFwk
+}  // namespace OHOS
@@ -33,5 +33,11 @@ int64_t SystemTime::GetNowSysTime()
 
     return duration;
 }
+
+int64_t SystemTime::GetNowSysTimeUs()
+{
+    auto epoch = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(epoch).count();
+}
 }  // namespace EventFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <future>
 #include <gtest/gtest.h>
 #include <numeric>
 #define private public
@@ -62,6 +63,11 @@ public:
     {
         return ERR_OK;
     }
+
+    ErrCode OnReceiveEvents(const std::vector<CommonEventData>& data, int32_t& funcResult) override
+    {
+        return ERR_OK;
+    }
 };
 /**
 * @tc.name: AbilityManagerHelper_0100
@@ -352,6 +358,87 @@ HWTEST_F(AbilityManagerHelperTest, ConnectAbility_RealDelay_Disconnect_0001, Lev
     EXPECT_EQ(it, abilityManagerHelper->subscriberConnection_.end());
 }
 
+/**
+* @tc.name: AbilityManagerHelper_ConnectAbilityAsync_0100
+* @tc.desc: test ConnectAbilityAsync reports a failed connect through the callback and drops the connection.
+* @tc.type: FUNC
+*/
+HWTEST_F(AbilityManagerHelperTest, AbilityManagerHelper_ConnectAbilityAsync_0100, Level1)
+{
+    GTEST_LOG_(INFO) << "AbilityManagerHelper_ConnectAbilityAsync_0100 start";
+    auto abilityManagerHelper = std::make_shared<AbilityManagerHelper>();
+    sptr<IRemoteObject> mockAbilityManager = nullptr;
+    MockSaProxy(mockAbilityManager);
+    Want want;
+    CommonEventData event;
+    int32_t userId = 1;
+    auto promise = std::make_shared<std::promise<std::pair<int, size_t>>>();
+    std::future<std::pair<int, size_t>> future = promise->get_future();
+    abilityManagerHelper->ConnectAbilityAsync(want, event, nullptr, userId, false,
+        [promise](int result, size_t droppedCount) { promise->set_value({ result, droppedCount }); });
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    auto [result, droppedCount] = future.get();
+    EXPECT_EQ(result, -1);
+    EXPECT_EQ(droppedCount, 1);
+    EXPECT_TRUE(abilityManagerHelper->subscriberConnection_.empty());
+    GTEST_LOG_(INFO) << "AbilityManagerHelper_ConnectAbilityAsync_0100 end";
+}
+
+/**
+* @tc.name: AbilityManagerHelper_ConnectAbilityAsync_0200
+* @tc.desc: test ConnectAbilityAsync queues the event on an existing connection without connecting again.
+* @tc.type: FUNC
+*/
+HWTEST_F(AbilityManagerHelperTest, AbilityManagerHelper_ConnectAbilityAsync_0200, Level1)
+{
+    GTEST_LOG_(INFO) << "AbilityManagerHelper_ConnectAbilityAsync_0200 start";
+    auto abilityManagerHelper = std::make_shared<AbilityManagerHelper>();
+    sptr<MockIAbilityManager> mockAbilityMgr = new MockIAbilityManager();
+    MockSaProxy(mockAbilityMgr);
+    EXPECT_CALL(*mockAbilityMgr, ConnectAbility(::testing::_, ::testing::_, ::testing::_, ::testing::_)).Times(0);
+    Want want;
+    CommonEventData event;
+    int32_t userId = 1;
+    std::string connectionKey =
+        want.GetBundle() + "_" + want.GetElement().GetAbilityName() + "_" + std::to_string(userId);
+    sptr<StaticSubscriberConnection> connection = new (std::nothrow) StaticSubscriberConnection(event, connectionKey);
+    abilityManagerHelper->subscriberConnection_[connectionKey] = connection;
+
+    int result = -1;
+    abilityManagerHelper->ConnectAbilityAsync(want, event, nullptr, userId, true,
+        [&result](int code, size_t droppedCount) { result = code; });
+    EXPECT_EQ(result, ERR_OK);
+    EXPECT_EQ(connection->events_.size(), 2);
+    GTEST_LOG_(INFO) << "AbilityManagerHelper_ConnectAbilityAsync_0200 end";
+}
+
+/**
+* @tc.name: AbilityManagerHelper_DoConnectAbility_0100
+* @tc.desc: test DoConnectAbility counts the events cached on a connection whose connect failed.
+* @tc.type: FUNC
+*/
+HWTEST_F(AbilityManagerHelperTest, AbilityManagerHelper_DoConnectAbility_0100, Level1)
+{
+    GTEST_LOG_(INFO) << "AbilityManagerHelper_DoConnectAbility_0100 start";
+    auto abilityManagerHelper = std::make_shared<AbilityManagerHelper>();
+    sptr<IRemoteObject> mockAbilityManager = nullptr;
+    MockSaProxy(mockAbilityManager);
+    Want want;
+    CommonEventData event;
+    std::string connectionKey = "connectionKey";
+    sptr<StaticSubscriberConnection> connection = new (std::nothrow) StaticSubscriberConnection(event, connectionKey);
+    connection->NotifyEvent(event);
+    connection->NotifyEvent(event);
+    abilityManagerHelper->subscriberConnection_[connectionKey] = connection;
+
+    size_t droppedCount = 0;
+    EXPECT_EQ(abilityManagerHelper->DoConnectAbility(want, connection, nullptr, 1, droppedCount), -1);
+    EXPECT_EQ(droppedCount, 3);
+    EXPECT_TRUE(connection->events_.empty());
+    EXPECT_TRUE(abilityManagerHelper->subscriberConnection_.empty());
+    GTEST_LOG_(INFO) << "AbilityManagerHelper_DoConnectAbility_0100 end";
+}
+
 /**
 * @tc.name: AbilityManagerHelper_RemoveConnection_0100
 * @tc.desc: test RemoveConnection function when connection is nullptr.
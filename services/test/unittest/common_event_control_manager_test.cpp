@@ -432,82 +432,119 @@ HWTEST_F(CommonEventControlManagerTest, CanLogUnorderedEvent_ShouldReturnTrue_Wh
         std::make_shared<CommonEventControlManager>();
     std::string testEvent = "test_event";
     EXPECT_TRUE(commonEventControlManager->CanLogUnorderedEvent(testEvent));
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_.size(), 1);
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_[0]->event_, testEvent);
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_[0]->missingCount_, 0);
 }
 
 HWTEST_F(CommonEventControlManagerTest,
-    CanLogUnorderedEvent_ShouldReturnTrueAndClearCache_WhenEventInCacheAndTimeout, Level1) {
+    CanLogUnorderedEvent_ShouldReturnFalse_WhenEventLoggedInInterval, Level1) {
     std::shared_ptr<CommonEventControlManager> commonEventControlManager =
         std::make_shared<CommonEventControlManager>();
-    std::string testEvent = "test_event";
-    auto now = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now());
-    auto oldCache = std::make_shared<CommonEventControlManager::EventLogCache>(testEvent,
-        now - std::chrono::seconds(11), 5);
-    commonEventControlManager->unorderedEventLogCache_.push_back(oldCache);
-    
-    EXPECT_TRUE(commonEventControlManager->CanLogUnorderedEvent(testEvent));
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_.size(), 1);
+    std::string event1 = "event1";
+    std::string event2 = "event2";
+    EXPECT_TRUE(commonEventControlManager->CanLogUnorderedEvent(event1));
+    EXPECT_FALSE(commonEventControlManager->CanLogUnorderedEvent(event1));
+    EXPECT_TRUE(commonEventControlManager->CanLogUnorderedEvent(event2));
 }
 
-HWTEST_F(CommonEventControlManagerTest,
-    CanLogUnorderedEvent_ShouldReturnFalseAndIncreaseSuppressed_WhenEventInCacheAndNotTimeout, Level1) {
+/**
+ * @tc.name: CoalesceUnorderedRecord_0100
+ * @tc.desc: test a pending broadcast of a coalescing event takes the newest payload until it is claimed.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CommonEventControlManagerTest, CoalesceUnorderedRecord_0100, Level1)
+{
+    auto createRecord = [](const std::string &event, int32_t code) {
+        auto record = std::make_shared<OrderedEventRecord>();
+        Want want;
+        want.SetAction(event);
+        record->commonEventData = std::make_shared<CommonEventData>(want, code, "");
+        record->publishInfo = std::make_shared<CommonEventPublishInfo>();
+        record->userId = 100;
+        return record;
+    };
     std::shared_ptr<CommonEventControlManager> commonEventControlManager =
         std::make_shared<CommonEventControlManager>();
-    std::string testEvent = "test_event";
-    auto now = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now());
-    auto oldCache = std::make_shared<CommonEventControlManager::EventLogCache>(testEvent,
-        now - std::chrono::milliseconds(9), 5);
-    commonEventControlManager->unorderedEventLogCache_.push_back(oldCache);
-    
-    EXPECT_FALSE(commonEventControlManager->CanLogUnorderedEvent(testEvent));
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_.size(), 1);
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_[0]->missingCount_, 6);
+    auto first = createRecord("event.state", 1);
+    EXPECT_FALSE(commonEventControlManager->CoalesceUnorderedRecord(first));
+
+    commonEventControlManager->SetCoalescingEvents({ "event.state" });
+    EXPECT_FALSE(commonEventControlManager->CoalesceUnorderedRecord(first));
+    EXPECT_TRUE(commonEventControlManager->CoalesceUnorderedRecord(createRecord("event.state", 2)));
+    EXPECT_EQ(first->commonEventData->GetCode(), 2);
+    EXPECT_FALSE(commonEventControlManager->CoalesceUnorderedRecord(createRecord("event.other", 3)));
+
+    commonEventControlManager->ClaimUnorderedRecord(first);
+    EXPECT_FALSE(commonEventControlManager->CoalesceUnorderedRecord(createRecord("event.state", 4)));
+    EXPECT_EQ(first->commonEventData->GetCode(), 2);
 }
 
-HWTEST_F(CommonEventControlManagerTest, CanLogUnorderedEvent_ShouldHandleMultipleEventsCorrectly, Level1) {
+/**
+ * @tc.name: CoalesceUnorderedRecord_0200
+ * @tc.desc: test publishes from another publisher or with other publish info do not fold into a pending broadcast.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CommonEventControlManagerTest, CoalesceUnorderedRecord_0200, Level1)
+{
+    auto createRecord = [](uid_t publisherUid, int32_t code) {
+        auto record = std::make_shared<OrderedEventRecord>();
+        Want want;
+        want.SetAction("event.state");
+        record->commonEventData = std::make_shared<CommonEventData>(want, code, "");
+        record->publishInfo = std::make_shared<CommonEventPublishInfo>();
+        record->eventRecordInfo.uid = publisherUid;
+        record->userId = 100;
+        return record;
+    };
     std::shared_ptr<CommonEventControlManager> commonEventControlManager =
         std::make_shared<CommonEventControlManager>();
-    std::string event1 = "event1";
-    std::string event2 = "event2";
-    auto now = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now());
-    auto oldCache1 = std::make_shared<CommonEventControlManager::EventLogCache>(event1,
-        now - std::chrono::seconds(11), 5);
-    auto oldCache2 = std::make_shared<CommonEventControlManager::EventLogCache>(event2,
-        now - std::chrono::milliseconds(9), 5);
-    commonEventControlManager->unorderedEventLogCache_.push_back(oldCache1);
-    commonEventControlManager->unorderedEventLogCache_.push_back(oldCache2);
-    
-    EXPECT_TRUE(commonEventControlManager->CanLogUnorderedEvent(event1));
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_.size(), 2);
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_[0]->event_, event1);
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_[0]->missingCount_, 0);
-    
-    EXPECT_FALSE(commonEventControlManager->CanLogUnorderedEvent(event2));
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_.size(), 2);
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_[1]->event_, event2);
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_[1]->missingCount_, 6);
+    commonEventControlManager->SetCoalescingEvents({ "event.state" });
+    auto first = createRecord(1000, 1);
+    EXPECT_FALSE(commonEventControlManager->CoalesceUnorderedRecord(first));
+
+    auto otherPublisher = createRecord(2000, 2);
+    EXPECT_FALSE(commonEventControlManager->CoalesceUnorderedRecord(otherPublisher));
+    auto withPermission = createRecord(1000, 3);
+    withPermission->publishInfo->SetSubscriberPermissions({ "ohos.permission.TEST" });
+    EXPECT_FALSE(commonEventControlManager->CoalesceUnorderedRecord(withPermission));
+    auto toBundle = createRecord(1000, 4);
+    toBundle->publishInfo->SetBundleName("com.ces.test");
+    EXPECT_FALSE(commonEventControlManager->CoalesceUnorderedRecord(toBundle));
+    EXPECT_EQ(first->commonEventData->GetCode(), 1);
+
+    EXPECT_TRUE(commonEventControlManager->CoalesceUnorderedRecord(createRecord(1000, 5)));
+    EXPECT_EQ(first->commonEventData->GetCode(), 5);
+    EXPECT_EQ(otherPublisher->commonEventData->GetCode(), 2);
 }
 
-HWTEST_F(CommonEventControlManagerTest, CanLogUnorderedEvent_ShouldClearOtherEvents_WhenAllEventTimeout, Level1) {
+/**
+ * @tc.name: RemoveProcessReceivers_0100
+ * @tc.desc: test the queued ordered receivers of a dead process are skipped and the others are kept.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CommonEventControlManagerTest, RemoveProcessReceivers_0100, Level1)
+{
     std::shared_ptr<CommonEventControlManager> commonEventControlManager =
         std::make_shared<CommonEventControlManager>();
-    std::string event1 = "event1";
-    std::string event2 = "event2";
-    auto now = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now());
-
-    auto oldCache1 = std::make_shared<CommonEventControlManager::EventLogCache>(event1,
-        now - std::chrono::seconds(11), 5);
-    auto oldCache2 = std::make_shared<CommonEventControlManager::EventLogCache>(event2,
-        now - std::chrono::seconds(9), 5);
-    commonEventControlManager->unorderedEventLogCache_.push_back(oldCache1);
-    commonEventControlManager->unorderedEventLogCache_.push_back(oldCache2);
-
-    EXPECT_TRUE(commonEventControlManager->CanLogUnorderedEvent(event1));
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_.size(), 1);
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_[0]->event_, event1);
-    EXPECT_EQ(commonEventControlManager->unorderedEventLogCache_[0]->missingCount_, 0);
+    auto record = std::make_shared<OrderedEventRecord>();
+    Want want;
+    want.SetAction("event.ordered");
+    record->commonEventData = std::make_shared<CommonEventData>(want);
+    record->publishInfo = std::make_shared<CommonEventPublishInfo>();
+    for (pid_t pid : { 1000, 2000, 1000 }) {
+        auto receiver = std::make_shared<EventSubscriberRecord>();
+        receiver->eventRecordInfo.pid = pid;
+        record->receivers.emplace_back(receiver);
+    }
+    record->ResetDeliveryState();
+    record->nextReceiver = 1;
+    record->deliveryState[0] = OrderedEventRecord::DELIVERED;
+    commonEventControlManager->orderedEventQueue_.emplace_back(record);
+
+    commonEventControlManager->RemoveProcessReceivers(1000);
+    EXPECT_EQ(record->deliveryState[0], OrderedEventRecord::DELIVERED);
+    EXPECT_EQ(record->deliveryState[1], OrderedEventRecord::PENDING);
+    EXPECT_EQ(record->deliveryState[2], OrderedEventRecord::SKIPPED);
+    EXPECT_TRUE(commonEventControlManager->NotifyOrderedEvent(record, 2));
+    EXPECT_EQ(record->curReceiver, nullptr);
 }
 }
 }
@@ -583,4 +583,139 @@ HWTEST_F(CommonEventFreezeUnitTest, CommonEventFreezeUnitTest_1003,
     GTEST_LOG_(INFO)
         << "CommonEventFreezeUnitTest, CommonEventFreezeUnitTest_1003, TestSize.Level0 end";
 }
+
+/**
+ * @tc.name: FrozenEvents_0100
+ * @tc.desc: Verify frozen events are stored once per process, deduplicated and taken out by pid or uid.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CommonEventFreezeUnitTest, FrozenEvents_0100,
+    Function | MediumTest | Level0)
+{
+    auto makeSubscriber = [this](pid_t pid) {
+        CommonEventSubscribeInfo subscribeInfo(matchingSkills_);
+        SubscriberRecordPtr record = std::make_shared<EventSubscriberRecord>();
+        record->eventSubscribeInfo = std::make_shared<CommonEventSubscribeInfo>(subscribeInfo);
+        record->commonEventListener = new CommonEventListener(std::make_shared<SubscriberTest>(subscribeInfo));
+        record->eventRecordInfo = eventRecordInfo_;
+        record->eventRecordInfo.pid = pid;
+        return record;
+    };
+    auto makeEvent = [](const std::string &action, bool sticky) {
+        CommonEventRecord eventRecord;
+        OHOS::AAFwk::Want want;
+        want.SetAction(action);
+        eventRecord.commonEventData = std::make_shared<CommonEventData>(want);
+        eventRecord.publishInfo = std::make_shared<CommonEventPublishInfo>();
+        eventRecord.publishInfo->SetSticky(sticky);
+        return eventRecord;
+    };
+    CommonEventSubscriberManager commonEventSubscriberManager;
+    SubscriberRecordPtr first = makeSubscriber(100);
+    SubscriberRecordPtr second = makeSubscriber(200);
+    CommonEventRecord event = makeEvent(EVENT, false);
+    CommonEventRecord oldState = makeEvent("com.ces.test.state", true);
+    CommonEventRecord newState = makeEvent("com.ces.test.state", true);
+
+    commonEventSubscriberManager.InsertFrozenEvents(first, event);
+    commonEventSubscriberManager.InsertFrozenEvents(second, event);
+    // the same publish is frozen once, a newer state replaces the older one
+    commonEventSubscriberManager.InsertFrozenEvents(first, event);
+    commonEventSubscriberManager.InsertFrozenEvents(first, oldState, true);
+    commonEventSubscriberManager.InsertFrozenEvents(first, newState, true);
+
+    EXPECT_EQ(commonEventSubscriberManager.GetAllFrozenEvents().size(), 1);
+    EXPECT_EQ(commonEventSubscriberManager.GetAllFrozenEvents()[TEST_UID].size(), 2);
+    FrozenProcessRecords &frozenStore = commonEventSubscriberManager.frozenEvents_;
+    const std::vector<EventRecordPtr> &firstEvents = frozenStore[FrozenProcessKey(100, TEST_UID)][*first];
+    ASSERT_EQ(firstEvents.size(), 2);
+    EXPECT_EQ(firstEvents.back()->commonEventData, newState.commonEventData);
+    // the subscribers an event was dispatched to share its frozen copy
+    EXPECT_EQ(firstEvents.front(), frozenStore[FrozenProcessKey(200, TEST_UID)][*second].front());
+
+    FrozenRecords frozenRecords = commonEventSubscriberManager.GetFrozenEventsByPid(100);
+    ASSERT_EQ(frozenRecords.size(), 1);
+    EXPECT_EQ(frozenRecords.begin()->second.size(), 2);
+    ASSERT_EQ(commonEventSubscriberManager.frozenPids_[TEST_UID].size(), 1);
+    EXPECT_EQ(commonEventSubscriberManager.frozenPids_[TEST_UID].count(200), 1);
+
+    std::unordered_map<pid_t, FrozenRecords> frozenEvents = commonEventSubscriberManager.GetFrozenEvents(TEST_UID);
+    ASSERT_EQ(frozenEvents.size(), 1);
+    EXPECT_EQ(frozenEvents[200].size(), 1);
+    EXPECT_TRUE(commonEventSubscriberManager.frozenEvents_.empty());
+    EXPECT_TRUE(commonEventSubscriberManager.frozenPids_.empty());
+
+    commonEventSubscriberManager.InsertFrozenEvents(second, event);
+    commonEventSubscriberManager.RemoveFrozenEventsBySubscriber(second);
+    EXPECT_TRUE(commonEventSubscriberManager.frozenEvents_.empty());
+    EXPECT_TRUE(commonEventSubscriberManager.frozenPids_.empty());
+}
+
+/**
+ * @tc.name: FrozenEvents_0200
+ * @tc.desc: Verify sticky and coalescing events supersede their earlier frozen events.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CommonEventFreezeUnitTest, FrozenEvents_0200,
+    Function | MediumTest | Level0)
+{
+    CommonEventControlManager commonEventControlManager;
+    CommonEventRecord eventRecord;
+    EXPECT_FALSE(commonEventControlManager.IsSupersedingEvent(eventRecord));
+
+    OHOS::AAFwk::Want want;
+    want.SetAction(EVENT);
+    eventRecord.commonEventData = std::make_shared<CommonEventData>(want);
+    eventRecord.publishInfo = std::make_shared<CommonEventPublishInfo>();
+    EXPECT_FALSE(commonEventControlManager.IsSupersedingEvent(eventRecord));
+    commonEventControlManager.SetCoalescingEvents({ EVENT });
+    EXPECT_TRUE(commonEventControlManager.IsSupersedingEvent(eventRecord));
+
+    commonEventControlManager.SetCoalescingEvents({});
+    eventRecord.publishInfo->SetSticky(true);
+    EXPECT_TRUE(commonEventControlManager.IsSupersedingEvent(eventRecord));
+}
+
+/**
+ * @tc.name: FrozenEvents_0300
+ * @tc.desc: Verify unfreezing one uid leaves the frozen events of the proxy subscribers of another uid.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CommonEventFreezeUnitTest, FrozenEvents_0300,
+    Function | MediumTest | Level0)
+{
+    auto makeProxySubscriber = [this](uid_t uid) {
+        CommonEventSubscribeInfo subscribeInfo(matchingSkills_);
+        SubscriberRecordPtr record = std::make_shared<EventSubscriberRecord>();
+        record->eventSubscribeInfo = std::make_shared<CommonEventSubscribeInfo>(subscribeInfo);
+        record->commonEventListener = new CommonEventListener(std::make_shared<SubscriberTest>(subscribeInfo));
+        record->eventRecordInfo = eventRecordInfo_;
+        record->eventRecordInfo.pid = UNDEFINED_PID;
+        record->eventRecordInfo.uid = uid;
+        record->eventRecordInfo.isProxy = true;
+        return record;
+    };
+    CommonEventSubscriberManager commonEventSubscriberManager;
+    SubscriberRecordPtr first = makeProxySubscriber(TEST_UID);
+    SubscriberRecordPtr second = makeProxySubscriber(TEST_UID + 1);
+    CommonEventRecord eventRecord;
+    OHOS::AAFwk::Want want;
+    want.SetAction(EVENT);
+    eventRecord.commonEventData = std::make_shared<CommonEventData>(want);
+    eventRecord.publishInfo = std::make_shared<CommonEventPublishInfo>();
+    commonEventSubscriberManager.InsertFrozenEvents(first, eventRecord);
+    commonEventSubscriberManager.InsertFrozenEvents(second, eventRecord);
+    EXPECT_EQ(commonEventSubscriberManager.frozenEvents_.size(), 2);
+    EXPECT_TRUE(commonEventSubscriberManager.GetFrozenEventsByPid(UNDEFINED_PID).empty());
+
+    std::unordered_map<pid_t, FrozenRecords> frozenEvents = commonEventSubscriberManager.GetFrozenEvents(TEST_UID);
+    ASSERT_EQ(frozenEvents.size(), 1);
+    ASSERT_EQ(frozenEvents[UNDEFINED_PID].size(), 1);
+    EXPECT_EQ(frozenEvents[UNDEFINED_PID].begin()->first.eventRecordInfo.uid, TEST_UID);
+
+    ASSERT_EQ(commonEventSubscriberManager.frozenEvents_.size(), 1);
+    EXPECT_EQ(commonEventSubscriberManager.frozenEvents_.begin()->first, FrozenProcessKey(UNDEFINED_PID, TEST_UID + 1));
+    EXPECT_EQ(commonEventSubscriberManager.frozenPids_.count(TEST_UID), 0);
+    EXPECT_EQ(commonEventSubscriberManager.frozenPids_[TEST_UID + 1].count(UNDEFINED_PID), 1);
+}
 }  // namespace
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "common_event_policy.h"
+#undef private
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+namespace {
+const std::string CONTROLLED_EVENT = "usual.event.CONTROLLED";
+const std::string OTHER_EVENT = "usual.event.OTHER";
+constexpr int32_t ALLOWED_UID = 1000;
+constexpr int32_t OTHER_UID = 2000;
+}
+
+class CommonEventPolicyTest : public testing::Test {
+public:
+    CommonEventPolicyTest()
+    {}
+    ~CommonEventPolicyTest()
+    {}
+
+    static void SetUpTestCase(void)
+    {}
+    static void TearDownTestCase(void)
+    {}
+    void SetUp()
+    {}
+    void TearDown()
+    {}
+};
+
+/*
+ * @tc.number: CommonEventPolicy_0100
+ * @tc.name: IsPublishAllowed
+ * @tc.desc: Verify only listed uids publish a controlled event and other events are not controlled.
+ */
+HWTEST_F(CommonEventPolicyTest, CommonEventPolicy_0100, Level1)
+{
+    std::vector<nlohmann::json> configs = { nlohmann::json::parse(R"({"publishControl": [
+        {"eventName": "usual.event.CONTROLLED", "uidList": [1000, "invalid"]},
+        {"eventName": "usual.event.NOBODY", "uidList": []},
+        {"uidList": [2000]}
+    ]})") };
+    auto policy = CommonEventPolicy::Compile(configs);
+    ASSERT_NE(policy, nullptr);
+    EXPECT_EQ(policy->publishControl_.size(), 2);
+    EXPECT_TRUE(policy->IsPublishAllowed(CONTROLLED_EVENT, ALLOWED_UID));
+    EXPECT_FALSE(policy->IsPublishAllowed(CONTROLLED_EVENT, OTHER_UID));
+    EXPECT_FALSE(policy->IsPublishAllowed("usual.event.NOBODY", ALLOWED_UID));
+    EXPECT_TRUE(policy->IsPublishAllowed(OTHER_EVENT, OTHER_UID));
+}
+
+/*
+ * @tc.number: CommonEventPolicy_0200
+ * @tc.name: Compile
+ * @tc.desc: Verify each section is taken from the first config holding it.
+ */
+HWTEST_F(CommonEventPolicyTest, CommonEventPolicy_0200, Level1)
+{
+    std::vector<nlohmann::json> configs = {
+        nlohmann::json::parse(R"({"coalescingEvents": ["usual.event.STATE", 1],
+            "backpressure": {"maxInFlight": 8, "ackTimeoutMs": 500, "policy": "coalesce"}})"),
+        nlohmann::json::parse(R"({"coalescingEvents": ["usual.event.OTHER"],
+            "publishControl": [{"eventName": "usual.event.CONTROLLED", "uidList": [1000]}]})"),
+    };
+    auto policy = CommonEventPolicy::Compile(configs);
+    ASSERT_NE(policy, nullptr);
+    EXPECT_EQ(policy->GetCoalescingEvents().size(), 1);
+    EXPECT_EQ(policy->GetCoalescingEvents().count("usual.event.STATE"), 1);
+    EXPECT_EQ(policy->GetFlowControlConfig().maxInFlight, 8);
+    EXPECT_EQ(policy->GetFlowControlConfig().maxBacklog, SubscriberFlowControl::Config().maxBacklog);
+    EXPECT_EQ(policy->GetFlowControlConfig().ackTimeoutMs, 500);
+    EXPECT_EQ(policy->GetFlowControlConfig().policy, SubscriberFlowControl::COALESCE);
+    EXPECT_FALSE(policy->IsPublishAllowed(CONTROLLED_EVENT, OTHER_UID));
+}
+
+/*
+ * @tc.number: CommonEventPolicy_0300
+ * @tc.name: Compile
+ * @tc.desc: Verify no config leaves every event allowed and the default flow control.
+ */
+HWTEST_F(CommonEventPolicyTest, CommonEventPolicy_0300, Level1)
+{
+    auto policy = CommonEventPolicy::Compile({});
+    ASSERT_NE(policy, nullptr);
+    EXPECT_TRUE(policy->IsPublishAllowed(CONTROLLED_EVENT, OTHER_UID));
+    EXPECT_TRUE(policy->GetCoalescingEvents().empty());
+    EXPECT_EQ(policy->GetFlowControlConfig().policy, SubscriberFlowControl::DEFER);
+}
+}  // namespace EventFwk
+}  // namespace OHOS
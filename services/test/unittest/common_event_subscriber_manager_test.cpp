@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include <numeric>
+#include <tuple>
 #define private public
 #include "common_event.h"
 #include "common_event_manager.h"
@@ -64,6 +65,21 @@ public:
     {}
 };
 
+class DeadCommonEventListener : public CommonEventListener {
+public:
+    DeadCommonEventListener(const std::shared_ptr<CommonEventSubscriber> &subscriber, bool isDead)
+        : CommonEventListener(subscriber), isDead_(isDead)
+    {}
+
+    bool IsObjectDead() const override
+    {
+        return isDead_;
+    }
+
+private:
+    bool isDead_;
+};
+
 void CommonEventSubscriberManagerTest::SetUpTestCase(void)
 {}
 
@@ -529,7 +545,7 @@ HWTEST_F(CommonEventSubscriberManagerTest, CommonEventSubscriberManager_2200, Le
     subscriberRecord->eventRecordInfo.uid = uids;
     // set frozenEvents_
     FrozenRecords frozenRecord;
-    commonEventSubscriberManager->frozenEvents_.emplace(uids, frozenRecord);
+    commonEventSubscriberManager->frozenEvents_.emplace(FrozenProcessKey(0, uids), frozenRecord);
     commonEventSubscriberManager->RemoveFrozenEventsBySubscriber(subscriberRecord);
     GTEST_LOG_(INFO) << "CommonEventSubscriberManager_2200 end";
 }
@@ -561,6 +577,50 @@ HWTEST_F(CommonEventSubscriberManagerTest, CommonEventSubscriberManager_2300, Le
     commonEventSubscriberManager->UpdateAllFreezeInfos(false, 1);
     GTEST_LOG_(INFO) << "CommonEventSubscriberManager_2300 end";
 }
+
+/**
+ * @tc.name: CommonEventSubscriberManager_2310
+ * @tc.desc: test DumpState pages without overflow when page and page size are huge.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CommonEventSubscriberManagerTest, CommonEventSubscriberManager_2310, Level1)
+{
+    GTEST_LOG_(INFO) << "CommonEventSubscriberManager_2310 start";
+    std::shared_ptr<CommonEventSubscriberManager> commonEventSubscriberManager =
+        std::make_shared<CommonEventSubscriberManager>();
+    ASSERT_NE(nullptr, commonEventSubscriberManager);
+    int32_t userId = 100;
+    for (int32_t index = 0; index < 3; ++index) {
+        SubscriberRecordPtr record = std::make_shared<EventSubscriberRecord>();
+        MatchingSkills matchingSkills;
+        record->eventSubscribeInfo = std::make_shared<CommonEventSubscribeInfo>(matchingSkills);
+        record->eventSubscribeInfo->SetUserId(userId);
+        commonEventSubscriberManager->subscribers_.emplace_back(record);
+    }
+
+    DumpFilter filter;
+    filter.page = SIZE_MAX;
+    filter.pageSize = SIZE_MAX;
+    std::string result;
+    DumpWriter writer(result);
+    commonEventSubscriberManager->DumpState("", userId, filter, writer);
+    EXPECT_NE(result.find("of 1"), std::string::npos);
+    EXPECT_EQ(result.find("NO 1"), std::string::npos);
+
+    filter.page = 0;
+    result.clear();
+    commonEventSubscriberManager->DumpState("", userId, filter, writer);
+    EXPECT_NE(result.find("NO 3"), std::string::npos);
+
+    filter.page = 1;
+    filter.pageSize = 2;
+    result.clear();
+    commonEventSubscriberManager->DumpState("", userId, filter, writer);
+    EXPECT_NE(result.find("page 1 of 2"), std::string::npos);
+    EXPECT_EQ(result.find("NO 2"), std::string::npos);
+    EXPECT_NE(result.find("NO 3"), std::string::npos);
+    GTEST_LOG_(INFO) << "CommonEventSubscriberManager_2310 end";
+}
 #endif
 /**
  * @tc.name: CommonEventSubscriberManager_2400
@@ -1992,209 +2052,144 @@ HWTEST_F(CommonEventSubscriberManagerTest, CheckSubscriberByMaximumVersion_004,
     EXPECT_TRUE(result);
 }
 
-HWTEST_F(CommonEventSubscriberManagerTest, CompactSubscriberDataStructures_0100, Level1)
+HWTEST_F(CommonEventSubscriberManagerTest, CompactStep_0100, Level1)
 {
-    GTEST_LOG_(INFO) << "CompactSubscriberDataStructures_0100 start";
+    GTEST_LOG_(INFO) << "CompactStep_0100 start";
     CommonEventSubscriberManager commonEventSubscriberManager;
 
-    EXPECT_EQ(false, commonEventSubscriberManager.hasCompacted_);
-    commonEventSubscriberManager.CompactSubscriberDataStructures();
-    EXPECT_EQ(true, commonEventSubscriberManager.hasCompacted_);
-    EXPECT_EQ(0, commonEventSubscriberManager.subscribers_.size());
+    EXPECT_EQ(false, commonEventSubscriberManager.CompactStep());
+    EXPECT_EQ(false, commonEventSubscriberManager.compacting_);
+    EXPECT_EQ(0, commonEventSubscriberManager.compactRuns_);
 
-    GTEST_LOG_(INFO) << "CompactSubscriberDataStructures_0100 end";
+    GTEST_LOG_(INFO) << "CompactStep_0100 end";
 }
 
-HWTEST_F(CommonEventSubscriberManagerTest, CompactSubscriberDataStructures_0200, Level1)
+HWTEST_F(CommonEventSubscriberManagerTest, CompactStep_0200, Level1)
 {
-    GTEST_LOG_(INFO) << "CompactSubscriberDataStructures_0200 start";
+    GTEST_LOG_(INFO) << "CompactStep_0200 start";
     CommonEventSubscriberManager commonEventSubscriberManager;
 
-    for (int i = 0; i < 3; i++) {
-        MatchingSkills matchingSkills;
-        matchingSkills.AddEvent("event" + std::to_string(i));
-        CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    MatchingSkills matchingSkills;
+    matchingSkills.AddEvent("event1");
+    CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    struct tm recordTime {0};
+    std::vector<sptr<IRemoteObject>> listeners;
+    for (int i = 0; i < 300; i++) {
         std::shared_ptr<DreivedSubscriber> subscriber = std::make_shared<DreivedSubscriber>(subscribeInfo);
         sptr<IRemoteObject> commonEventListener = new CommonEventListener(subscriber);
-
-        struct tm recordTime {0};
         EventRecordInfo eventRecordInfo;
         eventRecordInfo.pid = 1000 + i;
         eventRecordInfo.uid = 10000 + i;
         eventRecordInfo.bundleName = "bundle" + std::to_string(i);
-
         commonEventSubscriberManager.InsertSubscriber(
             std::make_shared<CommonEventSubscribeInfo>(subscribeInfo),
             commonEventListener, recordTime, eventRecordInfo);
+        listeners.emplace_back(commonEventListener);
     }
+    for (int i = 0; i < 290; i++) {
+        commonEventSubscriberManager.RemoveSubscriber(listeners[i]);
+    }
+    EXPECT_EQ(true, commonEventSubscriberManager.compactScheduled_.load());
 
-    size_t originalSize = commonEventSubscriberManager.subscribers_.size();
-    EXPECT_EQ(3, originalSize);
-
-    commonEventSubscriberManager.CompactSubscriberDataStructures();
-
-    EXPECT_EQ(true, commonEventSubscriberManager.hasCompacted_);
-    EXPECT_EQ(3, commonEventSubscriberManager.subscribers_.size());
-    EXPECT_EQ(3, commonEventSubscriberManager.subscriberCounts_.size());
-
-    GTEST_LOG_(INFO) << "CompactSubscriberDataStructures_0200 end";
-}
-
-HWTEST_F(CommonEventSubscriberManagerTest, CompactSubscriberDataStructures_0300, Level1)
-{
-    GTEST_LOG_(INFO) << "CompactSubscriberDataStructures_0300 start";
-    CommonEventSubscriberManager commonEventSubscriberManager;
-
-    MatchingSkills matchingSkills;
-    matchingSkills.AddEvent("event1");
-    CommonEventSubscribeInfo subscribeInfo(matchingSkills);
-    std::shared_ptr<DreivedSubscriber> subscriber = std::make_shared<DreivedSubscriber>(subscribeInfo);
-    sptr<IRemoteObject> commonEventListener = new CommonEventListener(subscriber);
-
-    struct tm recordTime {0};
-    EventRecordInfo eventRecordInfo;
-    eventRecordInfo.pid = 1000;
-    eventRecordInfo.uid = 10000;
-    eventRecordInfo.bundleName = "bundle1";
-
-    commonEventSubscriberManager.InsertSubscriber(
-        std::make_shared<CommonEventSubscribeInfo>(subscribeInfo),
-        commonEventListener, recordTime, eventRecordInfo);
-
-    commonEventSubscriberManager.subscribers_.emplace_back(nullptr);
-
-    auto invalidRecord = std::make_shared<EventSubscriberRecord>();
-    invalidRecord->commonEventListener = nullptr;
-    commonEventSubscriberManager.subscribers_.emplace_back(invalidRecord);
-
-    commonEventSubscriberManager.CompactSubscriberDataStructures();
+    // drive the slices by hand instead of waiting for the queue
+    EXPECT_EQ(true, commonEventSubscriberManager.CompactStep());
+    while (commonEventSubscriberManager.CompactStep()) {}
 
-    EXPECT_EQ(true, commonEventSubscriberManager.hasCompacted_);
-    EXPECT_EQ(1, commonEventSubscriberManager.subscribers_.size());
+    auto &records = commonEventSubscriberManager.eventSubscribers_["event1"];
+    EXPECT_EQ(10, records.size());
+    EXPECT_EQ(records.size(), records.capacity());
+    EXPECT_EQ(commonEventSubscriberManager.subscribers_.size(), commonEventSubscriberManager.subscribers_.capacity());
+    EXPECT_EQ(1, commonEventSubscriberManager.compactRuns_);
+    EXPECT_LT(commonEventSubscriberManager.compactAfter_.GetSlackBytes(),
+        commonEventSubscriberManager.compactBefore_.GetSlackBytes());
 
-    GTEST_LOG_(INFO) << "CompactSubscriberDataStructures_0300 end";
+    GTEST_LOG_(INFO) << "CompactStep_0200 end";
 }
 
-HWTEST_F(CommonEventSubscriberManagerTest, CompactSubscriberDataStructures_0400, Level1)
+HWTEST_F(CommonEventSubscriberManagerTest, CompactStep_0300, Level1)
 {
-    GTEST_LOG_(INFO) << "CompactSubscriberDataStructures_0400 start";
+    GTEST_LOG_(INFO) << "CompactStep_0300 start";
     CommonEventSubscriberManager commonEventSubscriberManager;
 
-    MatchingSkills matchingSkills;
-    matchingSkills.AddEvent("event1");
-    matchingSkills.AddEvent("event2");
-    matchingSkills.AddEvent("event3");
-    CommonEventSubscribeInfo subscribeInfo(matchingSkills);
-    std::shared_ptr<DreivedSubscriber> subscriber = std::make_shared<DreivedSubscriber>(subscribeInfo);
-    sptr<IRemoteObject> commonEventListener = new CommonEventListener(subscriber);
+    commonEventSubscriberManager.eventSubscribers_["event1"];
+    commonEventSubscriberManager.eventSubscribers_["event2"].emplace_back(std::make_shared<EventSubscriberRecord>());
+    EXPECT_EQ(1, commonEventSubscriberManager.MeasureFragmentationLocked().emptyEvents);
 
-    struct tm recordTime {0};
-    EventRecordInfo eventRecordInfo;
-    eventRecordInfo.pid = 1000;
-    eventRecordInfo.uid = 10000;
-    eventRecordInfo.bundleName = "bundle1";
-
-    commonEventSubscriberManager.InsertSubscriber(
-        std::make_shared<CommonEventSubscribeInfo>(subscribeInfo),
-        commonEventListener, recordTime, eventRecordInfo);
-
-    MatchingSkills matchingSkills2;
-    matchingSkills2.AddEvent("event1");
-    CommonEventSubscribeInfo subscribeInfo2(matchingSkills2);
-    std::shared_ptr<DreivedSubscriber> subscriber2 = std::make_shared<DreivedSubscriber>(subscribeInfo2);
-    sptr<IRemoteObject> commonEventListener2 = new CommonEventListener(subscriber2);
+    while (commonEventSubscriberManager.CompactStep()) {}
 
-    EventRecordInfo eventRecordInfo2;
-    eventRecordInfo2.pid = 2000;
-    eventRecordInfo2.uid = 20000;
-    eventRecordInfo2.bundleName = "bundle2";
-
-    commonEventSubscriberManager.InsertSubscriber(
-        std::make_shared<CommonEventSubscribeInfo>(subscribeInfo2),
-        commonEventListener2, recordTime, eventRecordInfo2);
-
-    commonEventSubscriberManager.CompactSubscriberDataStructures();
+    EXPECT_EQ(1, commonEventSubscriberManager.eventSubscribers_.size());
+    EXPECT_EQ(1, commonEventSubscriberManager.eventSubscribers_.count("event2"));
+    EXPECT_EQ(0, commonEventSubscriberManager.compactAfter_.emptyEvents);
 
-    EXPECT_EQ(true, commonEventSubscriberManager.hasCompacted_);
-    EXPECT_EQ(2, commonEventSubscriberManager.subscribers_.size());
-    EXPECT_EQ(2, commonEventSubscriberManager.subscriberCounts_.size());
-    EXPECT_EQ(3, commonEventSubscriberManager.eventSubscribers_.size());
-
-    GTEST_LOG_(INFO) << "CompactSubscriberDataStructures_0400 end";
+    GTEST_LOG_(INFO) << "CompactStep_0300 end";
 }
 
-HWTEST_F(CommonEventSubscriberManagerTest, GetSubscriberRecords_Compact_0100, Level1)
+#ifdef CEM_SUPPORT_DUMP
+HWTEST_F(CommonEventSubscriberManagerTest, DumpMemory_Compaction_0100, Level1)
 {
-    GTEST_LOG_(INFO) << "GetSubscriberRecords_Compact_0100 start";
+    GTEST_LOG_(INFO) << "DumpMemory_Compaction_0100 start";
     CommonEventSubscriberManager commonEventSubscriberManager;
 
-    MatchingSkills matchingSkills;
-    matchingSkills.AddEvent("event1");
-    CommonEventSubscribeInfo subscribeInfo(matchingSkills);
-    std::shared_ptr<DreivedSubscriber> subscriber = std::make_shared<DreivedSubscriber>(subscribeInfo);
-    sptr<IRemoteObject> commonEventListener = new CommonEventListener(subscriber);
-
-    struct tm recordTime {0};
-    EventRecordInfo eventRecordInfo;
-    eventRecordInfo.pid = 1000;
-    eventRecordInfo.uid = 10000;
-    eventRecordInfo.bundleName = "bundle1";
-
-    commonEventSubscriberManager.InsertSubscriber(
-        std::make_shared<CommonEventSubscribeInfo>(subscribeInfo),
-        commonEventListener, recordTime, eventRecordInfo);
-
-    EXPECT_EQ(false, commonEventSubscriberManager.hasCompacted_);
-
-    CommonEventRecord eventRecord;
-    std::shared_ptr<CommonEventData> commonEventData = std::make_shared<CommonEventData>();
-    OHOS::AAFwk::Want want;
-    want.SetAction(CommonEventSupport::COMMON_EVENT_SCREEN_OFF);
-    commonEventData->SetWant(want);
-    eventRecord.commonEventData = commonEventData;
-
-    commonEventSubscriberManager.GetSubscriberRecords(eventRecord);
+    commonEventSubscriberManager.eventSubscribers_["event1"];
+    while (commonEventSubscriberManager.CompactStep()) {}
 
-    EXPECT_EQ(true, commonEventSubscriberManager.hasCompacted_);
+    std::vector<std::string> state;
+    commonEventSubscriberManager.DumpMemory(state);
+    ASSERT_EQ(1, state.size());
+    EXPECT_NE(std::string::npos, state[0].find("Compaction: 1 runs, last run"));
 
-    GTEST_LOG_(INFO) << "GetSubscriberRecords_Compact_0100 end";
+    GTEST_LOG_(INFO) << "DumpMemory_Compaction_0100 end";
 }
+#endif
 
-HWTEST_F(CommonEventSubscriberManagerTest, GetSubscriberRecords_Compact_0200, Level1)
+HWTEST_F(CommonEventSubscriberManagerTest, RemoveSubscribersOnDeath_0100, Level1)
 {
-    GTEST_LOG_(INFO) << "GetSubscriberRecords_Compact_0200 start";
+    GTEST_LOG_(INFO) << "RemoveSubscribersOnDeath_0100 start";
     CommonEventSubscriberManager commonEventSubscriberManager;
-
-    MatchingSkills matchingSkills;
-    matchingSkills.AddEvent("event1");
-    CommonEventSubscribeInfo subscribeInfo(matchingSkills);
-    std::shared_ptr<DreivedSubscriber> subscriber = std::make_shared<DreivedSubscriber>(subscribeInfo);
-    sptr<IRemoteObject> commonEventListener = new CommonEventListener(subscriber);
+    std::vector<pid_t> diedPids;
+    commonEventSubscriberManager.SetProcessDiedCallback([&diedPids](pid_t pid, uid_t) { diedPids.emplace_back(pid); });
 
     struct tm recordTime {0};
-    EventRecordInfo eventRecordInfo;
-    eventRecordInfo.pid = 1000;
-    eventRecordInfo.uid = 10000;
-    eventRecordInfo.bundleName = "bundle1";
-
-    commonEventSubscriberManager.InsertSubscriber(
-        std::make_shared<CommonEventSubscribeInfo>(subscribeInfo),
-        commonEventListener, recordTime, eventRecordInfo);
-
-    EXPECT_EQ(false, commonEventSubscriberManager.hasCompacted_);
-
-    CommonEventRecord eventRecord;
-    std::shared_ptr<CommonEventData> commonEventData = std::make_shared<CommonEventData>();
-    OHOS::AAFwk::Want want;
-    want.SetAction("usual.event.BOOT_COMPLETED");
-    commonEventData->SetWant(want);
-    eventRecord.commonEventData = commonEventData;
+    std::vector<sptr<IRemoteObject>> listeners;
+    // the last listener belongs to a live process that reused pid 1000, the one before to another uid
+    std::vector<std::tuple<pid_t, uid_t, bool>> processes = {
+        { 1000, 10000, true }, { 1000, 10000, true }, { 2000, 10000, false }, { 1000, 10000, true },
+        { 1000, 10001, true }, { 1000, 10000, false }
+    };
+    for (const auto &[pid, uid, isDead] : processes) {
+        MatchingSkills matchingSkills;
+        matchingSkills.AddEvent("event1");
+        matchingSkills.AddEvent(pid == 1000 ? "event2" : "event3");
+        CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+        std::shared_ptr<DreivedSubscriber> subscriber = std::make_shared<DreivedSubscriber>(subscribeInfo);
+        sptr<IRemoteObject> commonEventListener = new DeadCommonEventListener(subscriber, isDead);
+        EventRecordInfo eventRecordInfo;
+        eventRecordInfo.pid = pid;
+        eventRecordInfo.uid = uid;
+        commonEventSubscriberManager.InsertSubscriber(
+            std::make_shared<CommonEventSubscribeInfo>(subscribeInfo),
+            commonEventListener, recordTime, eventRecordInfo);
+        listeners.emplace_back(commonEventListener);
+    }
 
-    commonEventSubscriberManager.GetSubscriberRecords(eventRecord);
+    EXPECT_EQ(3, commonEventSubscriberManager.RemoveSubscribersOnDeath(listeners[1]));
+    ASSERT_EQ(3, commonEventSubscriberManager.subscribers_.size());
+    EXPECT_EQ(listeners[2], commonEventSubscriberManager.subscribers_[0]->commonEventListener);
+    EXPECT_EQ(listeners[4], commonEventSubscriberManager.subscribers_[1]->commonEventListener);
+    EXPECT_EQ(listeners[5], commonEventSubscriberManager.subscribers_[2]->commonEventListener);
+    EXPECT_EQ(3, commonEventSubscriberManager.eventSubscribers_["event1"].size());
+    EXPECT_EQ(2, commonEventSubscriberManager.eventSubscribers_["event2"].size());
+    EXPECT_EQ(3, commonEventSubscriberManager.subscriberQuota_.GetTotal());
+    ASSERT_EQ(1, diedPids.size());
+    EXPECT_EQ(1000, diedPids[0]);
 
-    EXPECT_EQ(false, commonEventSubscriberManager.hasCompacted_);
+    // the other listeners of the dead process report their deaths later
+    EXPECT_EQ(0, commonEventSubscriberManager.RemoveSubscribersOnDeath(listeners[0]));
+    EXPECT_EQ(0, commonEventSubscriberManager.RemoveSubscribersOnDeath(listeners[3]));
+    EXPECT_EQ(0, commonEventSubscriberManager.RemoveSubscribersOnDeath(nullptr));
+    EXPECT_EQ(1, diedPids.size());
 
-    GTEST_LOG_(INFO) << "GetSubscriberRecords_Compact_0200 end";
+    GTEST_LOG_(INFO) << "RemoveSubscribersOnDeath_0100 end";
 }
 
 HWTEST_F(CommonEventSubscriberManagerTest, GetTopSubscriberRecordsMap_0100, Level1)
@@ -2585,9 +2580,16 @@ HWTEST_F(CommonEventSubscriberManagerTest, GetProcessNameFromProcCmdline_0300, L
     GTEST_LOG_(INFO) << "GetProcessNameFromProcCmdline_0300 end";
 }
 
+static void SetSubscriberCount(CommonEventSubscriberManager &manager, pid_t pid, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        manager.subscriberQuota_.Add(pid, 0);
+    }
+}
+
 /**
  * @tc.name: GetTopSubscriberCounts_0100
- * @tc.desc: test GetTopSubscriberCounts function with empty subscriberCounts_
+ * @tc.desc: test GetTopSubscriberCounts function with empty subscriberQuota_
  * @tc.type: FUNC
  */
 HWTEST_F(CommonEventSubscriberManagerTest, GetTopSubscriberCounts_0100, Level1)
@@ -2611,11 +2613,11 @@ HWTEST_F(CommonEventSubscriberManagerTest, GetTopSubscriberCounts_0200, Level1)
     GTEST_LOG_(INFO) << "GetTopSubscriberCounts_0200 start";
     CommonEventSubscriberManager commonEventSubscriberManager;
  
-    commonEventSubscriberManager.subscriberCounts_[1001] = 50;
-    commonEventSubscriberManager.subscriberCounts_[1002] = 30;
-    commonEventSubscriberManager.subscriberCounts_[1003] = 100;
-    commonEventSubscriberManager.subscriberCounts_[1004] = 20;
-    commonEventSubscriberManager.subscriberCounts_[1005] = 80;
+    SetSubscriberCount(commonEventSubscriberManager, 1001, 50);
+    SetSubscriberCount(commonEventSubscriberManager, 1002, 30);
+    SetSubscriberCount(commonEventSubscriberManager, 1003, 100);
+    SetSubscriberCount(commonEventSubscriberManager, 1004, 20);
+    SetSubscriberCount(commonEventSubscriberManager, 1005, 80);
  
     auto result = commonEventSubscriberManager.GetTopSubscriberCounts(3);
     EXPECT_EQ(3, result.size());
@@ -2631,7 +2633,7 @@ HWTEST_F(CommonEventSubscriberManagerTest, GetTopSubscriberCounts_0200, Level1)
 
 /**
  * @tc.name: GetTopSubscriberCounts_0300
- * @tc.desc: test GetTopSubscriberCounts function when topNum is greater than subscriberCounts_ size
+ * @tc.desc: test GetTopSubscriberCounts function when topNum is greater than the number of pids
  * @tc.type: FUNC
  */
 HWTEST_F(CommonEventSubscriberManagerTest, GetTopSubscriberCounts_0300, Level1)
@@ -2639,8 +2641,8 @@ HWTEST_F(CommonEventSubscriberManagerTest, GetTopSubscriberCounts_0300, Level1)
     GTEST_LOG_(INFO) << "GetTopSubscriberCounts_0300 start";
     CommonEventSubscriberManager commonEventSubscriberManager;
  
-    commonEventSubscriberManager.subscriberCounts_[2001] = 10;
-    commonEventSubscriberManager.subscriberCounts_[2002] = 5;
+    SetSubscriberCount(commonEventSubscriberManager, 2001, 10);
+    SetSubscriberCount(commonEventSubscriberManager, 2002, 5);
  
     auto result = commonEventSubscriberManager.GetTopSubscriberCounts(10);
     EXPECT_EQ(2, result.size());
@@ -2663,7 +2665,7 @@ HWTEST_F(CommonEventSubscriberManagerTest, GetTopSubscriberCounts_0400, Level1)
     CommonEventSubscriberManager commonEventSubscriberManager;
  
     for (int i = 1; i <= 15; i++) {
-        commonEventSubscriberManager.subscriberCounts_[3000 + i] = i * 10;
+        SetSubscriberCount(commonEventSubscriberManager, 3000 + i, i * 10);
     }
  
     auto result = commonEventSubscriberManager.GetTopSubscriberCounts();
@@ -2685,13 +2687,63 @@ HWTEST_F(CommonEventSubscriberManagerTest, GetTopSubscriberCounts_0500, Level1)
     GTEST_LOG_(INFO) << "GetTopSubscriberCounts_0500 start";
     CommonEventSubscriberManager commonEventSubscriberManager;
  
-    commonEventSubscriberManager.subscriberCounts_[4001] = 100;
-    commonEventSubscriberManager.subscriberCounts_[4002] = 50;
+    SetSubscriberCount(commonEventSubscriberManager, 4001, 100);
+    SetSubscriberCount(commonEventSubscriberManager, 4002, 50);
  
     auto result = commonEventSubscriberManager.GetTopSubscriberCounts(0);
     EXPECT_TRUE(result.empty());
  
     GTEST_LOG_(INFO) << "GetTopSubscriberCounts_0500 end";
 }
+
+/**
+ * @tc.name: GetSubscriberRecords_Prefix_0100
+ * @tc.desc: test prefix subscribers receive system events and their own events only.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CommonEventSubscriberManagerTest, GetSubscriberRecords_Prefix_0100, Level1)
+{
+    GTEST_LOG_(INFO) << "GetSubscriberRecords_Prefix_0100 start";
+    MockGetEventPermission(false);
+    CommonEventSubscriberManager commonEventSubscriberManager;
+
+    MatchingSkills matchingSkills;
+    matchingSkills.AddEventPrefix("usual.event.wifi.*");
+    matchingSkills.AddEventPrefix("com.ces.test.");
+    CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    subscribeInfo.SetUserId(ALL_USER);
+    std::shared_ptr<DreivedSubscriber> subscriber = std::make_shared<DreivedSubscriber>(subscribeInfo);
+    sptr<IRemoteObject> commonEventListener = new CommonEventListener(subscriber);
+
+    struct tm recordTime {0};
+    EventRecordInfo eventRecordInfo;
+    eventRecordInfo.pid = 1000;
+    eventRecordInfo.uid = 10000;
+    eventRecordInfo.bundleName = "bundle1";
+    EXPECT_NE(nullptr, commonEventSubscriberManager.InsertSubscriber(
+        std::make_shared<CommonEventSubscribeInfo>(subscribeInfo), commonEventListener, recordTime, eventRecordInfo));
+    EXPECT_EQ(0, commonEventSubscriberManager.eventSubscribers_.size());
+    EXPECT_EQ(2, commonEventSubscriberManager.prefixSubscribers_.Size());
+
+    CommonEventRecord eventRecord;
+    eventRecord.publishInfo = std::make_shared<CommonEventPublishInfo>();
+    eventRecord.commonEventData = std::make_shared<CommonEventData>();
+    eventRecord.eventRecordInfo.uid = 20000;
+    eventRecord.userId = ALL_USER;
+    OHOS::AAFwk::Want want;
+    want.SetAction(CommonEventSupport::COMMON_EVENT_WIFI_POWER_STATE);
+    eventRecord.commonEventData->SetWant(want);
+    EXPECT_EQ(1, commonEventSubscriberManager.GetSubscriberRecords(eventRecord).size());
+
+    want.SetAction("com.ces.test.custom");
+    eventRecord.commonEventData->SetWant(want);
+    EXPECT_EQ(0, commonEventSubscriberManager.GetSubscriberRecords(eventRecord).size());
+    eventRecord.eventRecordInfo.uid = 10000;
+    EXPECT_EQ(1, commonEventSubscriberManager.GetSubscriberRecords(eventRecord).size());
+
+    EXPECT_EQ(ERR_OK, commonEventSubscriberManager.RemoveSubscriber(commonEventListener));
+    EXPECT_TRUE(commonEventSubscriberManager.prefixSubscribers_.Empty());
+    GTEST_LOG_(INFO) << "GetSubscriberRecords_Prefix_0100 end";
+}
 }
 }
\ No newline at end of file
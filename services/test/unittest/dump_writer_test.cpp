@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#define private public
+#include "dump_writer.h"
+#undef private
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr int32_t PID = 1234;
+constexpr int32_t UID = 20010000;
+const std::string BUNDLE_NAME = "com.example.test";
+constexpr size_t LARGE_DUMP_LINES = 4096;
+}
+
+class DumpWriterTest : public testing::Test {
+public:
+    DumpWriterTest()
+    {}
+    ~DumpWriterTest()
+    {}
+
+    static void SetUpTestCase(void)
+    {}
+    static void TearDownTestCase(void)
+    {}
+    void SetUp()
+    {}
+    void TearDown()
+    {}
+};
+
+/*
+ * @tc.number: DumpWriter_0100
+ * @tc.name: Append
+ * @tc.desc: Verify text and numbers are appended to a string output.
+ */
+HWTEST_F(DumpWriterTest, DumpWriter_0100, Level1)
+{
+    std::string output;
+    {
+        DumpWriter writer(output);
+        writer.Append("PID: ").Append(static_cast<int64_t>(PID)).Append("\n");
+        writer.Append("FreezeTime: ").Append(static_cast<int64_t>(-1));
+        EXPECT_TRUE(writer.Flush());
+    }
+    EXPECT_EQ(output, "PID: 1234\nFreezeTime: -1");
+}
+
+/*
+ * @tc.number: DumpWriter_0200
+ * @tc.name: Flush
+ * @tc.desc: Verify a dump larger than the buffer is streamed to the fd in order.
+ */
+HWTEST_F(DumpWriterTest, DumpWriter_0200, Level1)
+{
+    FILE *file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    std::string expected;
+    {
+        DumpWriter writer(fileno(file));
+        for (size_t line = 0; line < LARGE_DUMP_LINES; ++line) {
+            writer.Append("NO ").Append(static_cast<int64_t>(line)).Append("\n");
+            expected.append("NO ").append(std::to_string(line)).append("\n");
+        }
+        EXPECT_LE(writer.buffer_.size(), expected.size());
+    }
+    std::string written(expected.size(), '\0');
+    rewind(file);
+    EXPECT_EQ(fread(written.data(), 1, written.size(), file), expected.size());
+    EXPECT_EQ(written, expected);
+    fclose(file);
+}
+
+/*
+ * @tc.number: DumpWriter_0300
+ * @tc.name: Flush
+ * @tc.desc: Verify a failed write is reported.
+ */
+HWTEST_F(DumpWriterTest, DumpWriter_0300, Level1)
+{
+    DumpWriter writer(-1);
+    writer.Append("Subscribers:\tNo information\n");
+    EXPECT_FALSE(writer.Flush());
+}
+
+/*
+ * @tc.number: DumpFilter_0100
+ * @tc.name: Match
+ * @tc.desc: Verify every set condition of a filter must match and an empty filter matches all.
+ */
+HWTEST_F(DumpWriterTest, DumpFilter_0100, Level1)
+{
+    DumpFilter filter;
+    EXPECT_TRUE(filter.Match(PID, UID, BUNDLE_NAME));
+
+    filter.uid = UID;
+    filter.bundleName = BUNDLE_NAME;
+    EXPECT_TRUE(filter.Match(PID, UID, BUNDLE_NAME));
+    EXPECT_FALSE(filter.Match(PID, UID + 1, BUNDLE_NAME));
+    EXPECT_FALSE(filter.Match(PID, UID, "com.example.other"));
+
+    filter.pid = PID + 1;
+    EXPECT_FALSE(filter.Match(PID, UID, BUNDLE_NAME));
+}
+}  // namespace EventFwk
+}  // namespace OHOS
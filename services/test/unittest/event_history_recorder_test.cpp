@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "event_history_recorder.h"
+#undef private
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr int32_t USER_ID = 100;
+constexpr int32_t OTHER_USER_ID = 101;
+constexpr pid_t PUBLISHER_PID = 1234;
+constexpr pid_t RECEIVER_PID = 2345;
+constexpr uint32_t RECEIVER_COST_US = 1500;
+
+std::shared_ptr<OrderedEventRecord> CreateRecord(const std::string &event, int32_t userId, size_t receiverNum)
+{
+    auto record = std::make_shared<OrderedEventRecord>();
+    Want want;
+    want.SetAction(event);
+    record->commonEventData = std::make_shared<CommonEventData>(want);
+    record->publishInfo = std::make_shared<CommonEventPublishInfo>();
+    record->userId = userId;
+    record->eventRecordInfo.pid = PUBLISHER_PID;
+    record->eventRecordInfo.bundleName = "com.example.publisher";
+    for (size_t i = 0; i < receiverNum; ++i) {
+        auto receiver = std::make_shared<EventSubscriberRecord>();
+        receiver->eventRecordInfo.pid = RECEIVER_PID;
+        receiver->eventRecordInfo.bundleName = "com.example.receiver";
+        record->receivers.emplace_back(receiver);
+        record->deliveryState.emplace_back(i == 0 ? OrderedEventRecord::DELIVERED : OrderedEventRecord::SKIPPED);
+        record->deliveryCost.emplace_back(RECEIVER_COST_US);
+    }
+    return record;
+}
+}
+
+class EventHistoryRecorderTest : public testing::Test {
+public:
+    EventHistoryRecorderTest()
+    {}
+    ~EventHistoryRecorderTest()
+    {}
+
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void EventHistoryRecorderTest::SetUpTestCase(void)
+{}
+
+void EventHistoryRecorderTest::TearDownTestCase(void)
+{}
+
+void EventHistoryRecorderTest::SetUp(void)
+{}
+
+void EventHistoryRecorderTest::TearDown(void)
+{}
+
+/*
+ * @tc.number: EventHistoryRecorder_0100
+ * @tc.name: test Intern
+ * @tc.desc: verify equal strings share one id and ids resolve back to the string
+ */
+HWTEST_F(EventHistoryRecorderTest, EventHistoryRecorder_0100, Level1)
+{
+    EventHistoryRecorder recorder;
+    uint32_t id = recorder.Intern("event.a");
+    EXPECT_NE(id, 0);
+    EXPECT_EQ(recorder.Intern("event.a"), id);
+    EXPECT_NE(recorder.Intern("event.b"), id);
+    EXPECT_EQ(recorder.GetString(id), "event.a");
+    EXPECT_EQ(recorder.GetString(0), "<unknown>");
+
+    std::string longEvent(EventHistoryRecorder::MAX_STRING_LENGTH + 10, 'e');
+    uint32_t longId = recorder.Intern(longEvent);
+    EXPECT_EQ(recorder.Intern(longEvent), longId);
+    EXPECT_EQ(recorder.GetString(longId), longEvent.substr(0, EventHistoryRecorder::MAX_STRING_LENGTH));
+}
+
+/*
+ * @tc.number: EventHistoryRecorder_0110
+ * @tc.name: test Intern
+ * @tc.desc: verify a full table evicts strings and ids of evicted strings resolve to unknown
+ */
+HWTEST_F(EventHistoryRecorderTest, EventHistoryRecorder_0110, Level1)
+{
+    EventHistoryRecorder recorder;
+    std::vector<uint32_t> ids;
+    size_t total = EventHistoryRecorder::MAX_STRING_NUM * 4;
+    for (size_t i = 0; i < total; ++i) {
+        ids.emplace_back(recorder.Intern("event." + std::to_string(i)));
+        EXPECT_NE(ids.back(), 0);
+    }
+    size_t evicted = 0;
+    for (size_t i = 0; i < total; ++i) {
+        std::string value = recorder.GetString(ids[i]);
+        if (value == "<unknown>") {
+            evicted++;
+            continue;
+        }
+        EXPECT_EQ(value, "event." + std::to_string(i));
+    }
+    EXPECT_GE(evicted, total - EventHistoryRecorder::MAX_STRING_NUM);
+    EXPECT_EQ(recorder.GetString(ids.back()), "event." + std::to_string(total - 1));
+}
+
+/*
+ * @tc.number: EventHistoryRecorder_0200
+ * @tc.name: test Record
+ * @tc.desc: verify the ring keeps the newest entries once it wraps
+ */
+HWTEST_F(EventHistoryRecorderTest, EventHistoryRecorder_0200, Level1)
+{
+    EventHistoryRecorder recorder;
+    size_t total = EventHistoryRecorder::CAPACITY + 10;
+    for (size_t i = 0; i < total; ++i) {
+        recorder.Record(*CreateRecord("event." + std::to_string(i), USER_ID, 1));
+    }
+    EventHistoryRecorder::Entry entry {};
+    EXPECT_FALSE(recorder.Load(0, entry));
+    ASSERT_TRUE(recorder.Load(total - 1, entry));
+    EXPECT_EQ(recorder.GetString(entry.event), "event." + std::to_string(total - 1));
+    EXPECT_EQ(entry.fanOut, 1);
+    EXPECT_EQ(entry.receivers[0].costUs, RECEIVER_COST_US);
+}
+
+#ifdef CEM_SUPPORT_DUMP
+/*
+ * @tc.number: EventHistoryRecorder_0300
+ * @tc.name: test DumpState
+ * @tc.desc: verify recorded publishes are dumped newest first and filtered by event and user
+ */
+HWTEST_F(EventHistoryRecorderTest, EventHistoryRecorder_0300, Level1)
+{
+    EventHistoryRecorder recorder;
+    std::vector<std::string> state;
+    recorder.DumpState("", ALL_USER, state);
+    ASSERT_EQ(state.size(), 1);
+    EXPECT_EQ(state[0], "History Events:\tNo information");
+
+    recorder.Record(*CreateRecord("event.a", USER_ID, 2));
+    recorder.Record(*CreateRecord("event.b", OTHER_USER_ID, 0));
+
+    state.clear();
+    recorder.DumpState("", ALL_USER, state);
+    ASSERT_EQ(state.size(), 2);
+    EXPECT_EQ(state[0].find("History Events:\tTotal 2 information\nNO 1\n"), 0);
+    EXPECT_NE(state[0].find("\tEvent: event.b\n"), std::string::npos);
+    EXPECT_NE(state[1].find("\tEvent: event.a\n"), std::string::npos);
+    EXPECT_NE(state[1].find("(PENDING 0, DELIVERED 1, SKIPPED 1, TIMEOUT 0)"), std::string::npos);
+    EXPECT_NE(state[1].find("BundleName: com.example.receiver PID: 2345 EventState: DELIVERED CostTime: 1.500ms"),
+        std::string::npos);
+
+    state.clear();
+    recorder.DumpState("event.a", ALL_USER, state);
+    EXPECT_EQ(state.size(), 1);
+
+    state.clear();
+    recorder.DumpState("", OTHER_USER_ID, state);
+    ASSERT_EQ(state.size(), 1);
+    EXPECT_NE(state[0].find("\tEvent: event.b\n"), std::string::npos);
+}
+#endif
+}  // namespace EventFwk
+}  // namespace OHOS
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "event_latency_metrics.h"
+#undef private
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+class EventLatencyMetricsTest : public testing::Test {
+public:
+    EventLatencyMetricsTest()
+    {}
+    ~EventLatencyMetricsTest()
+    {}
+
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+};
+
+void EventLatencyMetricsTest::SetUpTestCase(void)
+{}
+
+void EventLatencyMetricsTest::TearDownTestCase(void)
+{}
+
+void EventLatencyMetricsTest::SetUp(void)
+{}
+
+void EventLatencyMetricsTest::TearDown(void)
+{}
+
+/*
+ * @tc.number: EventLatencyMetrics_0100
+ * @tc.name: test Record
+ * @tc.desc: verify samples land in the histogram of their event and stage
+ */
+HWTEST_F(EventLatencyMetricsTest, EventLatencyMetrics_0100, Level1)
+{
+    EventLatencyMetrics metrics;
+    for (int64_t cost = 1; cost <= 100; ++cost) {
+        metrics.Record("event.a", EventLatencyMetrics::MATCH, cost);
+    }
+    metrics.Record("event.b", EventLatencyMetrics::RECEIVER_IPC, -1);
+    metrics.Record("event.b", EventLatencyMetrics::STAGE_MAX, 1);
+
+    auto &match = metrics.GetSlot("event.a")->stages[EventLatencyMetrics::MATCH];
+    EXPECT_EQ(match.count.load(), 100);
+    EXPECT_EQ(match.max.load(), 100);
+    uint64_t p50 = EventLatencyMetrics::GetPercentile(match, 100, 50);
+    EXPECT_GE(p50, 50);
+    EXPECT_LE(p50, 57);
+
+    auto &receiver = metrics.GetSlot("event.b")->stages[EventLatencyMetrics::RECEIVER_IPC];
+    EXPECT_EQ(receiver.count.load(), 1);
+    EXPECT_EQ(receiver.max.load(), 0);
+}
+
+/*
+ * @tc.number: EventLatencyMetrics_0200
+ * @tc.name: test GetSlot
+ * @tc.desc: verify events without a free slot within the probe length share the overflow slot
+ */
+HWTEST_F(EventLatencyMetricsTest, EventLatencyMetrics_0200, Level1)
+{
+    EventLatencyMetrics metrics;
+    size_t claimed = 0;
+    for (size_t i = 0; i < EventLatencyMetrics::MAX_EVENT_NUM * 2; ++i) {
+        std::string event = "event." + std::to_string(i);
+        auto slot = metrics.GetSlot(event);
+        EXPECT_EQ(metrics.GetSlot(event), slot);
+        if (slot != &metrics.overflow_) {
+            EXPECT_EQ(slot->event, event);
+            claimed++;
+        }
+    }
+    EXPECT_GT(claimed, EventLatencyMetrics::MAX_EVENT_NUM / 2);
+    EXPECT_LE(claimed, EventLatencyMetrics::MAX_EVENT_NUM);
+    EXPECT_LT(claimed, EventLatencyMetrics::MAX_EVENT_NUM * 2);
+}
+
+#ifdef CEM_SUPPORT_DUMP
+/*
+ * @tc.number: EventLatencyMetrics_0300
+ * @tc.name: test DumpState
+ * @tc.desc: verify only stages with samples are dumped for the requested event
+ */
+HWTEST_F(EventLatencyMetricsTest, EventLatencyMetrics_0300, Level1)
+{
+    EventLatencyMetrics metrics;
+    metrics.Record("event.a", EventLatencyMetrics::QUEUE_WAIT, 2000);
+    metrics.Record("event.b", EventLatencyMetrics::MATCH, 10);
+
+    std::vector<std::string> state;
+    metrics.DumpState("event.a", state);
+    ASSERT_EQ(state.size(), 1);
+    EXPECT_EQ(state[0], "Event: event.a\n\tqueue: count=1 p50=2.000ms p99=2.000ms max=2.000ms\n");
+
+    state.clear();
+    metrics.DumpState("", state);
+    EXPECT_EQ(state.size(), 2);
+}
+#endif
+}  // namespace EventFwk
+}  // namespace OHOS
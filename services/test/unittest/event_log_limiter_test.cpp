@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+
+#define private public
+#include "event_log_limiter.h"
+#undef private
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr int64_t INTERVAL = 50;
+constexpr int64_t START_TIME = 1000;
+}
+
+class EventLogLimiterTest : public testing::Test {
+public:
+    EventLogLimiterTest()
+    {}
+    ~EventLogLimiterTest()
+    {}
+
+    static void SetUpTestCase(void)
+    {}
+    static void TearDownTestCase(void)
+    {}
+    void SetUp()
+    {}
+    void TearDown()
+    {}
+};
+
+/*
+ * @tc.number: EventLogLimiter_0100
+ * @tc.name: CanLog
+ * @tc.desc: Verify one line per interval passes and the suppressed count is reported with the next one.
+ */
+HWTEST_F(EventLogLimiterTest, EventLogLimiter_0100, Level1)
+{
+    EventLogLimiter limiter(INTERVAL);
+    uint32_t suppressed = 0;
+    EXPECT_TRUE(limiter.CanLog("event1", START_TIME, suppressed));
+    EXPECT_EQ(suppressed, 0);
+    for (int64_t offset = 1; offset < INTERVAL; offset += 10) {
+        EXPECT_FALSE(limiter.CanLog("event1", START_TIME + offset, suppressed));
+    }
+    EXPECT_TRUE(limiter.CanLog("event1", START_TIME + INTERVAL, suppressed));
+    EXPECT_EQ(suppressed, 5);
+    EXPECT_FALSE(limiter.CanLog("event1", START_TIME + INTERVAL + 1, suppressed));
+    EXPECT_TRUE(limiter.CanLog("event1", START_TIME + INTERVAL * 2, suppressed));
+    EXPECT_EQ(suppressed, 1);
+}
+
+/*
+ * @tc.number: EventLogLimiter_0200
+ * @tc.name: CanLog
+ * @tc.desc: Verify events are limited independently.
+ */
+HWTEST_F(EventLogLimiterTest, EventLogLimiter_0200, Level1)
+{
+    EventLogLimiter limiter(INTERVAL);
+    uint32_t suppressed = 0;
+    EXPECT_TRUE(limiter.CanLog("event1", START_TIME, suppressed));
+    EXPECT_TRUE(limiter.CanLog("event2", START_TIME, suppressed));
+    EXPECT_FALSE(limiter.CanLog("event1", START_TIME + 1, suppressed));
+    EXPECT_FALSE(limiter.CanLog("event2", START_TIME + 1, suppressed));
+    EXPECT_FALSE(limiter.CanLog("event2", START_TIME + 2, suppressed));
+    EXPECT_TRUE(limiter.CanLog("event2", START_TIME + INTERVAL, suppressed));
+    EXPECT_EQ(suppressed, 2);
+}
+
+/*
+ * @tc.number: EventLogLimiter_0300
+ * @tc.name: CanLog
+ * @tc.desc: Verify a full table hands a quiet slot to a new event and lets lines through when none is quiet.
+ */
+HWTEST_F(EventLogLimiterTest, EventLogLimiter_0300, Level1)
+{
+    EventLogLimiter limiter(INTERVAL);
+    uint32_t suppressed = 0;
+    size_t key = EventLogLimiter::GetKey("new_event");
+    for (auto &slot : limiter.slots_) {
+        slot.key.store(++key);
+        slot.windowStart.store(START_TIME);
+    }
+
+    // every slot is busy in this interval, a new event is never suppressed
+    EXPECT_TRUE(limiter.CanLog("new_event", START_TIME + 1, suppressed));
+    EXPECT_TRUE(limiter.CanLog("new_event", START_TIME + 2, suppressed));
+
+    // once the others went quiet the new event takes a slot and is limited again
+    EXPECT_TRUE(limiter.CanLog("new_event", START_TIME + INTERVAL, suppressed));
+    EXPECT_FALSE(limiter.CanLog("new_event", START_TIME + INTERVAL + 1, suppressed));
+}
+}  // namespace EventFwk
+}  // namespace OHOS
@@ -38,6 +38,15 @@ int AbilityManagerHelper::ConnectAbility(
     return 0;
 }
 
+void AbilityManagerHelper::ConnectAbilityAsync(const Want &want, const CommonEventData &event,
+    const sptr<IRemoteObject> &callerToken, const int32_t &userId, bool isPriority, const ConnectCallback &callback)
+{
+    g_isConnectAbilityCalled = true;
+    if (callback) {
+        callback(0, 0);
+    }
+}
+
 sptr<AAFwk::IAbilityManager> AbilityManagerHelper::GetAbilityMgrProxy()
 {
     return nullptr;
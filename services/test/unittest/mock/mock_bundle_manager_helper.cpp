@@ -309,6 +309,14 @@ bool BundleManagerHelper::GetApplicationInfos(const AppExecFwk::ApplicationFlag
     return true;
 }
 
+bool BundleManagerHelper::GetApplicationInfos(const AppExecFwk::ApplicationFlag &flag, const int32_t &userId,
+    std::vector<AppExecFwk::ApplicationInfo> &appInfos)
+{
+    appInfos = g_mockAppInfos;
+    g_mockAppInfos.clear();
+    return true;
+}
+
 bool BundleManagerHelper::GetApiTargetVersionByUid(const uid_t uid, int32_t &apiTargetVersion)
 {
     apiTargetVersion = g_mockVersion;
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "ordered_event_record_pool.h"
+#undef private
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr size_t RECEIVER_NUM = 8;
+constexpr size_t RECORD_NUM = 4;
+}
+
+class OrderedEventRecordPoolTest : public testing::Test {
+public:
+    OrderedEventRecordPoolTest()
+    {}
+    ~OrderedEventRecordPoolTest()
+    {}
+
+    static void SetUpTestCase(void)
+    {}
+    static void TearDownTestCase(void)
+    {}
+    void SetUp()
+    {}
+    void TearDown()
+    {}
+};
+
+/*
+ * @tc.number: OrderedEventRecordPool_0100
+ * @tc.name: Acquire
+ * @tc.desc: Verify a released record comes back reset with the capacity of its arrays kept.
+ */
+HWTEST_F(OrderedEventRecordPoolTest, OrderedEventRecordPool_0100, Level1)
+{
+    OrderedEventRecordPool &pool = OrderedEventRecordPool::GetInstance();
+    std::shared_ptr<OrderedEventRecord> record = pool.Acquire();
+    ASSERT_NE(record, nullptr);
+    OrderedEventRecord *released = record.get();
+    record->userId = 100;
+    record->eventRecordInfo.pid = 1000;
+    record->eventRecordInfo.bundleName = "bundle";
+    record->nextReceiver = RECEIVER_NUM;
+    record->state.store(OrderedEventRecord::RECEIVED);
+    for (size_t index = 0; index < RECEIVER_NUM; ++index) {
+        record->receivers.emplace_back(std::make_shared<EventSubscriberRecord>());
+    }
+    record->ResetDeliveryState();
+    EXPECT_EQ(record->deliveryState.size(), RECEIVER_NUM);
+    EXPECT_EQ(record->deliveryCost.size(), RECEIVER_NUM);
+    std::weak_ptr<EventSubscriberRecord> receiver = record->receivers.front();
+
+    size_t reused = pool.GetStats().reused;
+    record.reset();
+    EXPECT_TRUE(receiver.expired());
+
+    record = pool.Acquire();
+    EXPECT_EQ(record.get(), released);
+    EXPECT_EQ(pool.GetStats().reused, reused + 1);
+    EXPECT_EQ(record->userId, UNDEFINED_USER);
+    EXPECT_EQ(record->eventRecordInfo.pid, 0);
+    EXPECT_TRUE(record->eventRecordInfo.bundleName.empty());
+    EXPECT_EQ(record->nextReceiver, 0);
+    EXPECT_EQ(record->state.load(), OrderedEventRecord::IDLE);
+    EXPECT_TRUE(record->receivers.empty());
+    EXPECT_TRUE(record->deliveryState.empty());
+    EXPECT_GE(record->receivers.capacity(), RECEIVER_NUM);
+    EXPECT_GE(record->deliveryState.capacity(), RECEIVER_NUM);
+}
+
+/*
+ * @tc.number: OrderedEventRecordPool_0200
+ * @tc.name: Release
+ * @tc.desc: Verify a record whose receiver array grew past the retained size is not kept.
+ */
+HWTEST_F(OrderedEventRecordPoolTest, OrderedEventRecordPool_0200, Level1)
+{
+    OrderedEventRecordPool &pool = OrderedEventRecordPool::GetInstance();
+    std::shared_ptr<OrderedEventRecord> record = pool.Acquire();
+    record->receivers.reserve(1024);
+    size_t idle = pool.GetStats().idle;
+    record.reset();
+    EXPECT_EQ(pool.GetStats().idle, idle);
+}
+
+/*
+ * @tc.number: OrderedEventRecordList_0100
+ * @tc.name: erase
+ * @tc.desc: Verify records keep their order, leave from any position and go back to the pool once erased.
+ */
+HWTEST_F(OrderedEventRecordPoolTest, OrderedEventRecordList_0100, Level1)
+{
+    OrderedEventRecordPool &pool = OrderedEventRecordPool::GetInstance();
+    OrderedEventRecordList list;
+    std::vector<OrderedEventRecord *> records;
+    for (size_t index = 0; index < RECORD_NUM; ++index) {
+        std::shared_ptr<OrderedEventRecord> record = pool.Acquire();
+        record->nextReceiver = index;
+        EXPECT_TRUE(list.emplace_back(record));
+        EXPECT_FALSE(list.emplace_back(record));
+        records.emplace_back(record.get());
+    }
+    EXPECT_EQ(list.size(), RECORD_NUM);
+
+    std::shared_ptr<OrderedEventRecord> middle = *(++list.begin());
+    EXPECT_TRUE(list.erase(middle));
+    EXPECT_FALSE(list.erase(middle));
+    middle.reset();
+    std::vector<std::shared_ptr<OrderedEventRecord>> remaining(list.begin(), list.end());
+    ASSERT_EQ(remaining.size(), RECORD_NUM - 1);
+    EXPECT_EQ(remaining[0]->nextReceiver, 0);
+    EXPECT_EQ(remaining[1]->nextReceiver, 2);
+    EXPECT_EQ(remaining[2]->nextReceiver, 3);
+
+    size_t idle = pool.GetStats().idle;
+    EXPECT_TRUE(list.erase(remaining.back()));
+    remaining.clear();
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+    EXPECT_EQ(pool.GetStats().idle, idle + RECORD_NUM - 1);
+}
+}  // namespace EventFwk
+}  // namespace OHOS
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "slab_allocator.h"
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr size_t RECORD_NUM = 100;
+
+struct TestRecord {
+    int32_t id = 0;
+    std::string name;
+};
+
+struct OtherTag {};
+
+struct ReleaseTag {};
+}
+
+class SlabAllocatorTest : public testing::Test {
+public:
+    SlabAllocatorTest()
+    {}
+    ~SlabAllocatorTest()
+    {}
+
+    static void SetUpTestCase(void)
+    {}
+    static void TearDownTestCase(void)
+    {}
+    void SetUp()
+    {}
+    void TearDown()
+    {}
+};
+
+/*
+ * @tc.number: SlabAllocator_0100
+ * @tc.name: allocate_shared
+ * @tc.desc: Verify shared objects take pooled blocks and give them back when released.
+ */
+HWTEST_F(SlabAllocatorTest, SlabAllocator_0100, Level1)
+{
+    SlabPool &pool = GetSlabPool<TestRecord>();
+    size_t inUse = pool.GetStats().inUse;
+    std::vector<std::shared_ptr<TestRecord>> records;
+    for (size_t index = 0; index < RECORD_NUM; ++index) {
+        auto record = std::allocate_shared<TestRecord>(SlabAllocator<TestRecord>());
+        record->id = static_cast<int32_t>(index);
+        record->name = "record" + std::to_string(index);
+        records.emplace_back(std::move(record));
+    }
+    SlabPool::Stats stats = pool.GetStats();
+    EXPECT_EQ(stats.inUse, inUse + RECORD_NUM);
+    EXPECT_GE(stats.blockSize, sizeof(TestRecord));
+    EXPECT_EQ(stats.blockSize % alignof(std::max_align_t), 0);
+    EXPECT_GE(stats.reservedBytes, stats.inUse * stats.blockSize);
+    for (size_t index = 0; index < RECORD_NUM; ++index) {
+        EXPECT_EQ(records[index]->id, static_cast<int32_t>(index));
+    }
+
+    // a released block is handed out again before a new slab is carved
+    TestRecord *released = records.back().get();
+    records.pop_back();
+    auto record = std::allocate_shared<TestRecord>(SlabAllocator<TestRecord>());
+    EXPECT_EQ(record.get(), released);
+    EXPECT_EQ(pool.GetStats().slabs, stats.slabs);
+
+    record.reset();
+    records.clear();
+    EXPECT_EQ(pool.GetStats().inUse, inUse);
+}
+
+/*
+ * @tc.number: SlabAllocator_0200
+ * @tc.name: Allocate
+ * @tc.desc: Verify a pool only serves its block size and the allocator falls back to operator new otherwise.
+ */
+HWTEST_F(SlabAllocatorTest, SlabAllocator_0200, Level1)
+{
+    SlabPool &pool = GetSlabPool<OtherTag>();
+    void *block = pool.Allocate(sizeof(TestRecord));
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(pool.Allocate(sizeof(TestRecord) * 4), nullptr);
+    EXPECT_FALSE(pool.Deallocate(block, sizeof(TestRecord) * 4));
+    EXPECT_TRUE(pool.Deallocate(block, sizeof(TestRecord)));
+    EXPECT_EQ(pool.GetStats().inUse, 0);
+
+    SlabAllocator<TestRecord, OtherTag> allocator;
+    TestRecord *records = allocator.allocate(4);
+    ASSERT_NE(records, nullptr);
+    EXPECT_EQ(pool.GetStats().inUse, 0);
+    allocator.deallocate(records, 4);
+}
+
+/*
+ * @tc.number: SlabAllocator_0300
+ * @tc.name: Deallocate
+ * @tc.desc: Verify fully free slabs are returned to the heap except for one.
+ */
+HWTEST_F(SlabAllocatorTest, SlabAllocator_0300, Level1)
+{
+    SlabPool &pool = GetSlabPool<ReleaseTag>();
+    std::vector<void *> blocks;
+    for (size_t index = 0; index < RECORD_NUM * 4; ++index) {
+        void *block = pool.Allocate(sizeof(TestRecord));
+        ASSERT_NE(block, nullptr);
+        blocks.emplace_back(block);
+    }
+    SlabPool::Stats stats = pool.GetStats();
+    EXPECT_GT(stats.slabs, 2);
+    size_t slabBytes = stats.reservedBytes / stats.slabs;
+
+    for (void *block : blocks) {
+        EXPECT_TRUE(pool.Deallocate(block, sizeof(TestRecord)));
+    }
+    stats = pool.GetStats();
+    EXPECT_EQ(stats.inUse, 0);
+    EXPECT_EQ(stats.slabs, 1);
+    EXPECT_EQ(stats.reservedBytes, slabBytes);
+
+    int32_t local = 0;
+    EXPECT_FALSE(pool.Deallocate(&local, sizeof(TestRecord)));
+    void *block = pool.Allocate(sizeof(TestRecord));
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(pool.GetStats().slabs, 1);
+    EXPECT_TRUE(pool.Deallocate(block, sizeof(TestRecord)));
+}
+}  // namespace EventFwk
+}  // namespace OHOS
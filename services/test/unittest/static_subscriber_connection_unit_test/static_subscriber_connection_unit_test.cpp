@@ -50,6 +50,8 @@ void StaticSubscriberConnectionUnitTest::SetUp() {}
 
 void StaticSubscriberConnectionUnitTest::TearDown() {}
 bool g_mockOnReceiveEventRet = false;
+size_t g_mockReceivedBatchSize = 0;
+size_t g_mockReceiveCount = 0;
 
 class MockStaticSubscriber : public StaticSubscriberStub {
 public:
@@ -59,6 +61,15 @@ public:
     ErrCode OnReceiveEvent(const CommonEventData& data, int32_t& funcResult) override
     {
         g_mockOnReceiveEventRet = true;
+        g_mockReceiveCount++;
+        return ERR_OK;
+    }
+
+    ErrCode OnReceiveEvents(const std::vector<CommonEventData>& data, int32_t& funcResult) override
+    {
+        g_mockOnReceiveEventRet = true;
+        g_mockReceivedBatchSize = data.size();
+        g_mockReceiveCount++;
         return ERR_OK;
     }
 };
@@ -121,6 +132,63 @@ HWTEST_F(StaticSubscriberConnectionUnitTest, NotifyEvent_0200, Function | Medium
     GTEST_LOG_(INFO) << "NotifyEvent_0200 end!";
 }
 
+/*
+ * @tc.name: NotifyEvent_0300
+ * @tc.desc: Test that events cached before connecting are sent in one batch with one pending action.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StaticSubscriberConnectionUnitTest, NotifyEvent_0300, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "NotifyEvent_0300 start!";
+    CommonEventData data;
+    sptr<StaticSubscriberConnection> connection = new (std::nothrow) StaticSubscriberConnection(data, "");
+    ASSERT_NE(nullptr, connection);
+    connection->NotifyEvent(data);
+    connection->NotifyEvent(data);
+    EXPECT_EQ(connection->events_.size(), 3);
+
+    g_mockReceivedBatchSize = 0;
+    ElementName element;
+    sptr<IRemoteObject> mockSubscriber = new MockStaticSubscriber();
+    connection->OnAbilityConnectDone(element, mockSubscriber, 0);
+    EXPECT_TRUE(connection->events_.empty());
+    EXPECT_EQ(connection->action_.size(), 1);
+    sleep(1);
+    EXPECT_EQ(g_mockReceivedBatchSize, 3);
+    EXPECT_TRUE(connection->pendingEvents_.empty());
+    EXPECT_FALSE(connection->flushScheduled_);
+    connection->Clear();
+    g_mockOnReceiveEventRet = false;
+    GTEST_LOG_(INFO) << "NotifyEvent_0300 end!";
+}
+
+/*
+ * @tc.name: NotifyEvent_0400
+ * @tc.desc: Test that a large batch is split into several transactions.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StaticSubscriberConnectionUnitTest, NotifyEvent_0400, Function | MediumTest | Level1)
+{
+    GTEST_LOG_(INFO) << "NotifyEvent_0400 start!";
+    CommonEventData data;
+    sptr<StaticSubscriberConnection> connection = new (std::nothrow) StaticSubscriberConnection(data, "");
+    ASSERT_NE(nullptr, connection);
+    connection->events_.clear();
+    connection->proxy_ = new MockStaticSubscriber();
+    connection->pendingEvents_.assign(33, data);
+
+    g_mockReceivedBatchSize = 0;
+    g_mockReceiveCount = 0;
+    connection->FlushEvents("");
+    // 16 + 16 events in batches, the last one alone
+    EXPECT_EQ(g_mockReceiveCount, 3);
+    EXPECT_EQ(g_mockReceivedBatchSize, 16);
+    EXPECT_TRUE(connection->pendingEvents_.empty());
+    connection->proxy_ = nullptr;
+    g_mockOnReceiveEventRet = false;
+    GTEST_LOG_(INFO) << "NotifyEvent_0400 end!";
+}
+
 /*
  * @tc.name: RemoveEvent_0100
  * @tc.desc: Test that RemoveEvent can correctly remove the specified action from action_.
@@ -235,4 +235,41 @@ HWTEST_F(StaticSubscriberDataManagerUnitTest, IsNeedUpdateKey_0100, Function | M
     std::string key = "12345";
     auto ret = dataManager->IsNeedUpdateKey(key);
     EXPECT_EQ(true, ret);
-}
\ No newline at end of file
+}
+/*
+ * @tc.name: UpdateStaticSubscriberStateAsync_0100
+ * @tc.desc: Test that journaled changes are coalesced per bundle into one flush and the journal is removed after it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StaticSubscriberDataManagerUnitTest, UpdateStaticSubscriberStateAsync_0100, Function | MediumTest | Level1)
+{
+    auto dataManager = std::make_shared<StaticSubscriberDataManager>();
+    ASSERT_NE(nullptr, dataManager);
+    std::vector<std::string> events = { "testEvent1" };
+    EXPECT_EQ(ERR_OK, dataManager->UpdateStaticSubscriberStateAsync("100_testBundleName", events));
+    events.emplace_back("testEvent2");
+    EXPECT_EQ(ERR_OK, dataManager->UpdateStaticSubscriberStateAsync("100_testBundleName", events));
+    EXPECT_EQ(ERR_OK, dataManager->UpdateStaticSubscriberStateAsync("100_removedBundleName", { "testEvent1" }));
+    EXPECT_EQ(ERR_OK, dataManager->UpdateStaticSubscriberStateAsync("100_removedBundleName", {}));
+    std::map<std::string, std::vector<std::string>> expected = {
+        { "100_testBundleName", events }, { "100_removedBundleName", {} }
+    };
+    EXPECT_EQ(dataManager->pendingChanges_, expected);
+    EXPECT_TRUE(dataManager->flushScheduled_);
+    // the journal already holds every accepted change before the flush
+    std::map<std::string, std::vector<std::string>> journal;
+    EXPECT_TRUE(dataManager->ReadJournal(journal));
+    EXPECT_EQ(journal, expected);
+
+    EXPECT_EQ(ERR_OK, dataManager->FlushStaticSubscriberState());
+    EXPECT_TRUE(dataManager->pendingChanges_.empty());
+    journal.clear();
+    EXPECT_FALSE(dataManager->ReadJournal(journal));
+
+    std::map<std::string, std::vector<std::string>> queried;
+    std::set<std::string> bundleList;
+    EXPECT_EQ(ERR_OK, dataManager->QueryStaticSubscriberStateData(queried, bundleList));
+    std::map<std::string, std::vector<std::string>> written = { { "100_testBundleName", events } };
+    EXPECT_EQ(queried, written);
+    EXPECT_EQ(ERR_OK, dataManager->UpdateStaticSubscriberState({}));
+}
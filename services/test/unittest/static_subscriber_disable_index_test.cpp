@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "static_subscriber_disable_index.h"
+#undef private
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr int32_t USER_ID = 100;
+const std::string BUNDLE_NAME = "com.example.test";
+const std::string EVENT_SCREEN_ON = "usual.event.SCREEN_ON";
+const std::string EVENT_SCREEN_OFF = "usual.event.SCREEN_OFF";
+const std::string EVENT_TIME_TICK = "usual.event.TIME_TICK";
+}
+
+class StaticSubscriberDisableIndexTest : public testing::Test {
+public:
+    StaticSubscriberDisableIndexTest()
+    {}
+    ~StaticSubscriberDisableIndexTest()
+    {}
+
+    static void SetUpTestCase(void)
+    {}
+    static void TearDownTestCase(void)
+    {}
+    void SetUp()
+    {}
+    void TearDown()
+    {}
+};
+
+/*
+ * @tc.number: StaticSubscriberDisableIndex_0100
+ * @tc.name: Rebuild
+ * @tc.desc: Verify disabled events are found by user, bundle and event, and invalid keys are skipped.
+ */
+HWTEST_F(StaticSubscriberDisableIndexTest, StaticSubscriberDisableIndex_0100, Level1)
+{
+    std::map<std::string, std::vector<std::string>> disableEvents = {
+        { std::to_string(USER_ID) + "_" + BUNDLE_NAME, { EVENT_SCREEN_ON, EVENT_SCREEN_OFF } },
+        { std::to_string(USER_ID + 1) + "_" + BUNDLE_NAME, { EVENT_TIME_TICK } },
+        { BUNDLE_NAME, { EVENT_SCREEN_ON } },
+    };
+    StaticSubscriberDisableIndex index;
+    index.Rebuild(disableEvents);
+    EXPECT_TRUE(index.Contains(USER_ID, BUNDLE_NAME, EVENT_SCREEN_ON));
+    EXPECT_TRUE(index.Contains(USER_ID, BUNDLE_NAME, EVENT_SCREEN_OFF));
+    EXPECT_FALSE(index.Contains(USER_ID, BUNDLE_NAME, EVENT_TIME_TICK));
+    EXPECT_TRUE(index.Contains(USER_ID + 1, BUNDLE_NAME, EVENT_TIME_TICK));
+    EXPECT_FALSE(index.Contains(USER_ID + 1, BUNDLE_NAME, EVENT_SCREEN_ON));
+    EXPECT_FALSE(index.Contains(USER_ID, "com.example.other", EVENT_SCREEN_ON));
+    EXPECT_FALSE(index.Contains(USER_ID, BUNDLE_NAME, "usual.event.UNKNOWN"));
+    EXPECT_EQ(index.bundles_.size(), 2);
+}
+
+/*
+ * @tc.number: StaticSubscriberDisableIndex_0200
+ * @tc.name: Set
+ * @tc.desc: Verify a bundle's disabled events are replaced and an empty list removes the bundle.
+ */
+HWTEST_F(StaticSubscriberDisableIndexTest, StaticSubscriberDisableIndex_0200, Level1)
+{
+    std::string key = std::to_string(USER_ID) + "_" + BUNDLE_NAME;
+    StaticSubscriberDisableIndex index;
+    index.Set(key, { EVENT_SCREEN_ON });
+    EXPECT_TRUE(index.Contains(USER_ID, BUNDLE_NAME, EVENT_SCREEN_ON));
+
+    index.Set(key, { EVENT_SCREEN_OFF });
+    EXPECT_FALSE(index.Contains(USER_ID, BUNDLE_NAME, EVENT_SCREEN_ON));
+    EXPECT_TRUE(index.Contains(USER_ID, BUNDLE_NAME, EVENT_SCREEN_OFF));
+
+    index.Set(key, {});
+    EXPECT_FALSE(index.Contains(USER_ID, BUNDLE_NAME, EVENT_SCREEN_OFF));
+    EXPECT_TRUE(index.bundles_.empty());
+}
+
+/*
+ * @tc.number: StaticSubscriberDisableIndex_0300
+ * @tc.name: Set
+ * @tc.desc: Verify event ids beyond one bitset word are indexed.
+ */
+HWTEST_F(StaticSubscriberDisableIndexTest, StaticSubscriberDisableIndex_0300, Level1)
+{
+    constexpr int32_t EVENT_COUNT = 130;
+    std::vector<std::string> events;
+    for (int32_t i = 0; i < EVENT_COUNT; ++i) {
+        events.emplace_back("event" + std::to_string(i));
+    }
+    StaticSubscriberDisableIndex index;
+    index.Set(std::to_string(USER_ID) + "_" + BUNDLE_NAME, events);
+    index.Set(std::to_string(USER_ID) + "_com.example.other", { events.back() });
+    for (const auto &event : events) {
+        EXPECT_TRUE(index.Contains(USER_ID, BUNDLE_NAME, event));
+    }
+    EXPECT_TRUE(index.Contains(USER_ID, "com.example.other", events.back()));
+    EXPECT_FALSE(index.Contains(USER_ID, "com.example.other", events.front()));
+}
+}  // namespace EventFwk
+}  // namespace OHOS
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "static_subscriber_filter.h"
+#undef private
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr int32_t FILTER_CODE = 1;
+const std::string FILTER_DATA = "data";
+
+CommonEventData CreateEventData(int32_t code, const std::string &data)
+{
+    Want want;
+    want.SetAction("usual.event.TEST");
+    want.SetParam("bool", true);
+    want.SetParam("int", 1);
+    want.SetParam("string", std::string("value"));
+    return CommonEventData(want, code, data);
+}
+}
+
+class StaticSubscriberFilterTest : public testing::Test {
+public:
+    StaticSubscriberFilterTest()
+    {}
+    ~StaticSubscriberFilterTest()
+    {}
+
+    static void SetUpTestCase(void)
+    {}
+    static void TearDownTestCase(void)
+    {}
+    void SetUp()
+    {}
+    void TearDown()
+    {}
+};
+
+/*
+ * @tc.number: StaticSubscriberFilter_0100
+ * @tc.name: Compile
+ * @tc.desc: Verify parameter names are interned once across filters and an empty filter matches any event.
+ */
+HWTEST_F(StaticSubscriberFilterTest, StaticSubscriberFilter_0100, Level1)
+{
+    StaticSubscriberFilter::KeyTable keys;
+    auto empty = StaticSubscriberFilter::Compile(std::nullopt, std::nullopt, {}, keys);
+    ASSERT_NE(empty, nullptr);
+    EXPECT_TRUE(empty->IsEmpty());
+
+    auto first = StaticSubscriberFilter::Compile(FILTER_CODE, FILTER_DATA, { { "bool", true }, { "int", 1 } }, keys);
+    auto second = StaticSubscriberFilter::Compile(std::nullopt, std::nullopt, { { "int", 1 } }, keys);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(first->program_.size(), 4);
+    EXPECT_EQ(keys.GetSize(), 2);
+    EXPECT_EQ(first->program_.back().slot, second->program_.back().slot);
+
+    CommonEventData data = CreateEventData(FILTER_CODE + 1, "");
+    StaticSubscriberFilter::ParameterCache cache(keys, data.GetWant().GetParams());
+    EXPECT_TRUE(empty->Match(data, cache));
+    EXPECT_TRUE(cache.loaded_.empty());
+}
+
+/*
+ * @tc.number: StaticSubscriberFilter_0200
+ * @tc.name: Match
+ * @tc.desc: Verify code, data and typed parameter conditions, a value of another type does not match.
+ */
+HWTEST_F(StaticSubscriberFilterTest, StaticSubscriberFilter_0200, Level1)
+{
+    StaticSubscriberFilter::KeyTable keys;
+    auto filter = StaticSubscriberFilter::Compile(FILTER_CODE, FILTER_DATA,
+        { { "bool", true }, { "int", 1 }, { "string", std::string("value") } }, keys);
+    auto wrongType = StaticSubscriberFilter::Compile(std::nullopt, std::nullopt, { { "int", 1.0 } }, keys);
+    auto missing = StaticSubscriberFilter::Compile(std::nullopt, std::nullopt, { { "missing", true } }, keys);
+
+    CommonEventData data = CreateEventData(FILTER_CODE, FILTER_DATA);
+    StaticSubscriberFilter::ParameterCache cache(keys, data.GetWant().GetParams());
+    EXPECT_TRUE(filter->Match(data, cache));
+    EXPECT_FALSE(wrongType->Match(data, cache));
+    EXPECT_FALSE(missing->Match(data, cache));
+
+    CommonEventData otherCode = CreateEventData(FILTER_CODE + 1, FILTER_DATA);
+    StaticSubscriberFilter::ParameterCache otherCodeCache(keys, otherCode.GetWant().GetParams());
+    EXPECT_FALSE(filter->Match(otherCode, otherCodeCache));
+    // rejected by the code before any parameter is read
+    EXPECT_TRUE(otherCodeCache.loaded_.empty());
+
+    CommonEventData otherData = CreateEventData(FILTER_CODE, "other");
+    StaticSubscriberFilter::ParameterCache otherDataCache(keys, otherData.GetWant().GetParams());
+    EXPECT_FALSE(filter->Match(otherData, otherDataCache));
+}
+
+/*
+ * @tc.number: StaticSubscriberFilter_0300
+ * @tc.name: ParameterCache
+ * @tc.desc: Verify a want parameter is read once and shared by the filters testing it.
+ */
+HWTEST_F(StaticSubscriberFilterTest, StaticSubscriberFilter_0300, Level1)
+{
+    StaticSubscriberFilter::KeyTable keys;
+    auto first = StaticSubscriberFilter::Compile(std::nullopt, std::nullopt, { { "int", 1 } }, keys);
+    auto second = StaticSubscriberFilter::Compile(std::nullopt, std::nullopt, { { "int", 2 } }, keys);
+    CommonEventData data = CreateEventData(FILTER_CODE, FILTER_DATA);
+    StaticSubscriberFilter::ParameterCache cache(keys, data.GetWant().GetParams());
+    EXPECT_TRUE(first->Match(data, cache));
+    uint32_t slot = keys.GetSlot("int");
+    ASSERT_TRUE(cache.loaded_[slot]);
+    const auto *value = cache.Get(slot);
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(std::get<int32_t>(*value), 1);
+    EXPECT_FALSE(second->Match(data, cache));
+    EXPECT_EQ(cache.Get(keys.GetSize()), nullptr);
+}
+}  // namespace EventFwk
+}  // namespace OHOS
@@ -77,5 +77,11 @@ ErrCode OsAccountManagerHelper::GetOsAccountLocalIdFromUid(const int32_t uid, in
     id = g_mockIdForGetOsAccountLocalIdFromUid;
     return g_mockGetOsAccountLocalIdFromUidRet ? ERR_OK : ERR_INVALID_OPERATION;
 }
+
+ErrCode OsAccountManagerHelper::GetForegroundUserIds(std::vector<int32_t> &foregroundUserIds)
+{
+    foregroundUserIds.emplace_back(g_mockId);
+    return g_mockQueryActiveOsAccountIdsRet ? ERR_OK : ERR_INVALID_OPERATION;
+}
 }  // namespace EventFwk
 }  // namespace OHOS
\ No newline at end of file
@@ -3851,6 +3851,7 @@ HWTEST_F(StaticSubscriberManagerUnitTest, IsDisableEvent_0100, Function | Medium
     int32_t uid = 100;
     std::string key = std::to_string(uid) + "_" + bundleName;
     manager->disableEvents_.emplace(key, events);
+    manager->disableIndex_.Rebuild(manager->disableEvents_);
     int32_t userId = 100;
     auto ret = manager->IsDisableEvent(bundleName, event, uid);
     EXPECT_EQ(true, ret);
@@ -4418,6 +4419,75 @@ HWTEST_F(StaticSubscriberManagerUnitTest,
     EXPECT_FALSE(manager->CheckSubscriberWhetherMatched(subscriber, publishInfo));
 }
 
+/*
+ * @tc.name: SubscriberIdentityTest_0100
+ * @tc.desc: test that bundle attributes of a static subscriber are resolved when it is added and reused by
+ *           publisher filters until a package event drops them.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StaticSubscriberManagerUnitTest, SubscriberIdentityTest_0100, Function | MediumTest | Level1)
+{
+    auto manager = std::make_shared<StaticSubscriberManager>();
+    ASSERT_NE(nullptr, manager);
+    StaticSubscriberManager::StaticSubscriberInfo testInfo = {
+        .name = "testName",
+        .bundleName = "testBundle",
+        .userId = 100,
+        .permission = ""
+    };
+    SetUidMock(1);
+    SetSystemMock(true);
+    manager->AddToValidSubscribers("testEvent", testInfo);
+    ASSERT_EQ(1, manager->validSubscribers_["testEvent"].size());
+    auto subscriber = manager->validSubscribers_["testEvent"][0];
+    ASSERT_NE(nullptr, subscriber.identity);
+    EXPECT_EQ(1, subscriber.identity->uid);
+    EXPECT_TRUE(subscriber.identity->isSystemApp);
+
+    // matching uses the resolved attributes, not the current bundle manager answers
+    SetUidMock(2);
+    SetSystemMock(false);
+    CommonEventPublishInfo publishInfo;
+    publishInfo.SetSubscriberType(static_cast<int32_t>(SubscriberType::SYSTEM_SUBSCRIBER_TYPE));
+    publishInfo.SetSubscriberUid({1});
+    publishInfo.SetValidationRule(ValidationRule::AND);
+    EXPECT_TRUE(manager->CheckSubscriberWhetherMatched(subscriber, publishInfo));
+
+    manager->RemoveSubscriberWithBundleName("testBundle", 100);
+    EXPECT_EQ(0, manager->subscriberIdentities_.size());
+    EXPECT_EQ(2, manager->GetSubscriberIdentity("testBundle", 100)->uid);
+}
+
+/*
+ * @tc.name: SubscriberIdentityTest_0200
+ * @tc.desc: test that a subscriber whose bundle attributes failed to resolve resolves them again when matched.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StaticSubscriberManagerUnitTest, SubscriberIdentityTest_0200, Function | MediumTest | Level1)
+{
+    auto manager = std::make_shared<StaticSubscriberManager>();
+    ASSERT_NE(nullptr, manager);
+    StaticSubscriberManager::StaticSubscriberInfo testInfo = {
+        .name = "testName",
+        .bundleName = "testBundle",
+        .userId = 100,
+        .permission = ""
+    };
+    SetUidMock(-1);
+    SetSystemMock(false);
+    manager->AddToValidSubscribers("testEvent", testInfo);
+    ASSERT_EQ(1, manager->validSubscribers_["testEvent"].size());
+    auto subscriber = manager->validSubscribers_["testEvent"][0];
+    EXPECT_EQ(nullptr, subscriber.identity);
+    EXPECT_EQ(0, manager->subscriberIdentities_.size());
+
+    SetUidMock(3);
+    CommonEventPublishInfo publishInfo;
+    publishInfo.SetSubscriberUid({3});
+    EXPECT_TRUE(manager->CheckSubscriberWhetherMatched(subscriber, publishInfo));
+    EXPECT_EQ(1, manager->subscriberIdentities_.size());
+}
+
 /*
  * @tc.name: InitValidSubscribersTest_0900
  * @tc.desc: test if StaticSubscriberManager's InitValidSubscribers function executed as expected
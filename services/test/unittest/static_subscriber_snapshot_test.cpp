@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#define private public
+#include "static_subscriber_snapshot.h"
+#undef private
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+namespace {
+const std::string SNAPSHOT_PATH = "/data/local/tmp/static_subscriber_snapshot_test";
+const std::string FINGERPRINT = "/data/app/el1/bundle/public/com.example.test/entry.hap#1000000";
+constexpr int32_t USER_ID = 100;
+constexpr int32_t FILTER_CODE = 1;
+
+StaticSubscriberSnapshot::Profile CreateProfile()
+{
+    StaticSubscriberSnapshot::Subscriber subscriber;
+    subscriber.event = "usual.event.TIME_TICK";
+    subscriber.permission = "ohos.permission.test";
+    subscriber.filterCode = FILTER_CODE;
+    subscriber.filterData = "data";
+    subscriber.filterParameters.emplace("bool", true);
+    subscriber.filterParameters.emplace("int", 1);
+    subscriber.filterParameters.emplace("double", 1.5);
+    subscriber.filterParameters.emplace("string", std::string("value"));
+
+    StaticSubscriberSnapshot::Profile profile;
+    profile.fingerprint = FINGERPRINT;
+    profile.subscribers.emplace_back(subscriber);
+    profile.subscribers.emplace_back(StaticSubscriberSnapshot::Subscriber { .event = "usual.event.SCREEN_ON" });
+    return profile;
+}
+}
+
+class StaticSubscriberSnapshotTest : public testing::Test {
+public:
+    StaticSubscriberSnapshotTest()
+    {}
+    ~StaticSubscriberSnapshotTest()
+    {}
+
+    static void SetUpTestCase(void)
+    {}
+    static void TearDownTestCase(void)
+    {}
+    void SetUp()
+    {
+        std::remove(SNAPSHOT_PATH.c_str());
+    }
+    void TearDown()
+    {
+        std::remove(SNAPSHOT_PATH.c_str());
+    }
+};
+
+/*
+ * @tc.number: StaticSubscriberSnapshot_0100
+ * @tc.name: Save and Load
+ * @tc.desc: Verify parsed profiles survive a save and load and are only found with the same fingerprint.
+ */
+HWTEST_F(StaticSubscriberSnapshotTest, StaticSubscriberSnapshot_0100, Level1)
+{
+    std::string key = StaticSubscriberSnapshot::GetKey(USER_ID, "com.example.test", "StaticSubscriber");
+    StaticSubscriberSnapshot snapshot(SNAPSHOT_PATH);
+    EXPECT_FALSE(snapshot.Load());
+    snapshot.Put(key, CreateProfile());
+    EXPECT_TRUE(snapshot.Save());
+    EXPECT_FALSE(snapshot.dirty_);
+    EXPECT_NE(access((SNAPSHOT_PATH + ".tmp").c_str(), F_OK), 0);
+
+    StaticSubscriberSnapshot loaded(SNAPSHOT_PATH);
+    EXPECT_TRUE(loaded.Load());
+    EXPECT_EQ(loaded.Find(key, "/data/app/el1/bundle/public/com.example.test/entry.hap#1000001"), nullptr);
+    const auto *profile = loaded.Find(key, FINGERPRINT);
+    ASSERT_NE(profile, nullptr);
+    ASSERT_EQ(profile->subscribers.size(), 2);
+    const auto &subscriber = profile->subscribers[0];
+    EXPECT_EQ(subscriber.event, "usual.event.TIME_TICK");
+    EXPECT_EQ(subscriber.permission, "ohos.permission.test");
+    EXPECT_EQ(subscriber.filterCode, FILTER_CODE);
+    EXPECT_EQ(subscriber.filterData, "data");
+    EXPECT_EQ(subscriber.filterParameters, CreateProfile().subscribers[0].filterParameters);
+    EXPECT_FALSE(profile->subscribers[1].filterCode.has_value());
+    EXPECT_FALSE(profile->subscribers[1].filterData.has_value());
+}
+
+/*
+ * @tc.number: StaticSubscriberSnapshot_0200
+ * @tc.name: Erase
+ * @tc.desc: Verify profiles are erased by user and bundle prefix without touching similar keys, including the
+ *           system user of singleton apps.
+ */
+HWTEST_F(StaticSubscriberSnapshotTest, StaticSubscriberSnapshot_0200, Level1)
+{
+    StaticSubscriberSnapshot snapshot(SNAPSHOT_PATH);
+    std::string key0 = StaticSubscriberSnapshot::GetKey(USER_ID, "com.example.test", "StaticSubscriber");
+    std::string key1 = StaticSubscriberSnapshot::GetKey(USER_ID, "com.example.test2", "StaticSubscriber");
+    std::string key2 = StaticSubscriberSnapshot::GetKey(USER_ID + 1, "com.example.test", "StaticSubscriber");
+    std::string systemKey = StaticSubscriberSnapshot::GetKey(0, "com.example.test", "StaticSubscriber");
+    snapshot.Put(key0, CreateProfile());
+    snapshot.Put(key1, CreateProfile());
+    snapshot.Put(key2, CreateProfile());
+    snapshot.Put(systemKey, CreateProfile());
+
+    snapshot.Erase(StaticSubscriberSnapshot::GetBundlePrefix(USER_ID, "com.example.test"));
+    EXPECT_EQ(snapshot.Find(key0, FINGERPRINT), nullptr);
+    EXPECT_NE(snapshot.Find(key1, FINGERPRINT), nullptr);
+
+    snapshot.Erase(StaticSubscriberSnapshot::GetUserPrefix(USER_ID + 1), { key2 });
+    EXPECT_NE(snapshot.Find(key2, FINGERPRINT), nullptr);
+    snapshot.Erase(StaticSubscriberSnapshot::GetUserPrefix(USER_ID));
+    EXPECT_EQ(snapshot.Find(key1, FINGERPRINT), nullptr);
+    EXPECT_NE(snapshot.Find(key2, FINGERPRINT), nullptr);
+    EXPECT_NE(snapshot.Find(systemKey, FINGERPRINT), nullptr);
+    snapshot.Erase(StaticSubscriberSnapshot::GetUserPrefix(0));
+    EXPECT_EQ(snapshot.Find(systemKey, FINGERPRINT), nullptr);
+    EXPECT_NE(snapshot.Find(key2, FINGERPRINT), nullptr);
+}
+
+/*
+ * @tc.number: StaticSubscriberSnapshot_0300
+ * @tc.name: Load
+ * @tc.desc: Verify a truncated snapshot file is rejected as a whole.
+ */
+HWTEST_F(StaticSubscriberSnapshotTest, StaticSubscriberSnapshot_0300, Level1)
+{
+    std::string key = StaticSubscriberSnapshot::GetKey(USER_ID, "com.example.test", "StaticSubscriber");
+    StaticSubscriberSnapshot snapshot(SNAPSHOT_PATH);
+    snapshot.Put(key, CreateProfile());
+    std::string buffer = snapshot.Serialize();
+    {
+        std::ofstream file(SNAPSHOT_PATH, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size() - 1));
+    }
+
+    StaticSubscriberSnapshot loaded(SNAPSHOT_PATH);
+    EXPECT_FALSE(loaded.Load());
+    EXPECT_TRUE(loaded.profiles_.empty());
+    EXPECT_TRUE(loaded.dirty_);
+}
+}  // namespace EventFwk
+}  // namespace OHOS
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "structured_dump.h"
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr int32_t TEST_CODE = 7;
+constexpr pid_t TEST_PID = 100;
+constexpr uid_t TEST_UID = 20010001;
+constexpr int32_t TEST_PRIORITY = 10;
+
+void InitEventRecord(CommonEventRecord &record, const std::string &event)
+{
+    Want want;
+    want.SetAction(event);
+    record.commonEventData = std::make_shared<CommonEventData>(want, TEST_CODE, "data");
+    record.publishInfo = std::make_shared<CommonEventPublishInfo>();
+    record.publishInfo->SetOrdered(true);
+    record.eventRecordInfo.pid = TEST_PID;
+    record.eventRecordInfo.uid = TEST_UID;
+    record.eventRecordInfo.bundleName = "com.example.publisher";
+}
+
+std::shared_ptr<EventSubscriberRecord> CreateSubscriberRecord(const std::string &event)
+{
+    MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(event);
+    auto record = std::make_shared<EventSubscriberRecord>();
+    record->eventSubscribeInfo = std::make_shared<CommonEventSubscribeInfo>(matchingSkills);
+    record->eventSubscribeInfo->SetPriority(TEST_PRIORITY);
+    record->eventRecordInfo.pid = TEST_PID;
+    record->eventRecordInfo.uid = TEST_UID;
+    record->eventRecordInfo.bundleName = "com.example.subscriber";
+    return record;
+}
+}
+
+class StructuredDumpTest : public testing::Test {
+public:
+    StructuredDumpTest()
+    {}
+    ~StructuredDumpTest()
+    {}
+
+    static void SetUpTestCase(void)
+    {}
+    static void TearDownTestCase(void)
+    {}
+    void SetUp()
+    {}
+    void TearDown()
+    {}
+};
+
+/*
+ * @tc.number: StructuredDump_0100
+ * @tc.name: FromEventRecord
+ * @tc.desc: Verify the fields of a sticky or pending event are dumped by name.
+ */
+HWTEST_F(StructuredDumpTest, StructuredDump_0100, Level1)
+{
+    CommonEventRecord record;
+    InitEventRecord(record, "event");
+    nlohmann::json root = StructuredDump::FromEventRecord(record);
+    EXPECT_EQ(root["action"], "event");
+    EXPECT_EQ(root["code"], TEST_CODE);
+    EXPECT_EQ(root["data"], "data");
+    EXPECT_EQ(root["pid"], TEST_PID);
+    EXPECT_EQ(root["uid"], TEST_UID);
+    EXPECT_EQ(root["bundleName"], "com.example.publisher");
+    EXPECT_EQ(root["isOrdered"], true);
+    EXPECT_EQ(root["isSticky"], false);
+
+    // a record without data still dumps its publisher
+    CommonEventRecord emptyRecord;
+    root = StructuredDump::FromEventRecord(emptyRecord);
+    EXPECT_FALSE(root.contains("action"));
+    EXPECT_TRUE(root.contains("pid"));
+}
+
+/*
+ * @tc.number: StructuredDump_0200
+ * @tc.name: FromOrderedEventRecord
+ * @tc.desc: Verify a pending event dumps its receivers with their delivery states.
+ */
+HWTEST_F(StructuredDumpTest, StructuredDump_0200, Level1)
+{
+    OrderedEventRecord record;
+    InitEventRecord(record, "event");
+    record.state = OrderedEventRecord::RECEIVING;
+    record.receivers.emplace_back(CreateSubscriberRecord("event"));
+    record.receivers.emplace_back(nullptr);
+    record.receivers.emplace_back(CreateSubscriberRecord("event"));
+    record.deliveryState = { OrderedEventRecord::DELIVERED, OrderedEventRecord::SKIPPED,
+        OrderedEventRecord::PENDING };
+
+    nlohmann::json root = StructuredDump::FromOrderedEventRecord(record);
+    EXPECT_EQ(root["action"], "event");
+    EXPECT_EQ(root["state"], "RECEIVING");
+    ASSERT_EQ(root["receivers"].size(), 2);
+    EXPECT_EQ(root["receivers"][0]["deliveryState"], "DELIVERED");
+    EXPECT_EQ(root["receivers"][1]["deliveryState"], "PENDING");
+    EXPECT_EQ(root["receivers"][0]["priority"], TEST_PRIORITY);
+    EXPECT_EQ(root["receivers"][0]["events"], nlohmann::json::array({ "event" }));
+    EXPECT_EQ(root["receivers"][0]["bundleName"], "com.example.subscriber");
+}
+
+/*
+ * @tc.number: StructuredDump_0300
+ * @tc.name: Serialize
+ * @tc.desc: Verify the json and cbor forms decode to the same dump.
+ */
+HWTEST_F(StructuredDumpTest, StructuredDump_0300, Level1)
+{
+    auto subscriber = CreateSubscriberRecord("event");
+    nlohmann::json root = {
+        { "version", StructuredDump::SCHEMA_VERSION },
+        { "subscribers", nlohmann::json::array({ StructuredDump::FromSubscriberRecord(*subscriber, true, 1) }) },
+    };
+    std::string text = StructuredDump::Serialize(root, false);
+    EXPECT_EQ(text.find('\n'), std::string::npos);
+    EXPECT_EQ(nlohmann::json::parse(text), root);
+
+    std::string binary = StructuredDump::Serialize(root, true);
+    EXPECT_LT(binary.size(), text.size());
+    EXPECT_EQ(nlohmann::json::from_cbor(std::vector<uint8_t>(binary.begin(), binary.end())), root);
+    EXPECT_EQ(root["subscribers"][0]["isFreeze"], true);
+}
+}  // namespace EventFwk
+}  // namespace OHOS
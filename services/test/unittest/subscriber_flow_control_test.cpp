@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "subscriber_flow_control.h"
+#undef private
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr uint32_t MAX_IN_FLIGHT = 2;
+constexpr uint32_t MAX_BACKLOG = 2;
+
+CommonEventRecord CreateRecord(const std::string &event, int32_t code)
+{
+    CommonEventRecord record;
+    Want want;
+    want.SetAction(event);
+    record.commonEventData = std::make_shared<CommonEventData>(want, code, "");
+    record.publishInfo = std::make_shared<CommonEventPublishInfo>();
+    return record;
+}
+
+SubscriberFlowControl::Config CreateConfig(SubscriberFlowControl::Policy policy)
+{
+    SubscriberFlowControl::Config config;
+    config.policy = policy;
+    config.maxInFlight = MAX_IN_FLIGHT;
+    config.maxBacklog = MAX_BACKLOG;
+    return config;
+}
+}
+
+class SubscriberFlowControlTest : public testing::Test {
+public:
+    SubscriberFlowControlTest()
+    {}
+    ~SubscriberFlowControlTest()
+    {}
+
+    static void SetUpTestCase(void)
+    {}
+    static void TearDownTestCase(void)
+    {}
+    void SetUp()
+    {}
+    void TearDown()
+    {}
+};
+
+/*
+ * @tc.number: SubscriberFlowControl_0100
+ * @tc.name: TryAcquire
+ * @tc.desc: Verify a subscriber that never acknowledged is counted but never throttled.
+ */
+HWTEST_F(SubscriberFlowControlTest, SubscriberFlowControl_0100, Level1)
+{
+    SubscriberFlowControl flowControl;
+    auto config = CreateConfig(SubscriberFlowControl::DEFER);
+    for (int32_t i = 0; i < 10; ++i) {
+        EXPECT_TRUE(flowControl.TryAcquire(config, CreateRecord("event", i)));
+        flowControl.OnSent(true);
+    }
+    EXPECT_EQ(flowControl.sent_.load(), 10);
+    EXPECT_EQ(flowControl.inFlight_, 0);
+    EXPECT_TRUE(flowControl.backlog_.empty());
+    EXPECT_TRUE(flowControl.Dump().empty());
+}
+
+/*
+ * @tc.number: SubscriberFlowControl_0200
+ * @tc.name: Acknowledge
+ * @tc.desc: Verify events beyond the credit are deferred and drained in order, ahead of newer events.
+ */
+HWTEST_F(SubscriberFlowControlTest, SubscriberFlowControl_0200, Level1)
+{
+    SubscriberFlowControl flowControl;
+    auto config = CreateConfig(SubscriberFlowControl::DEFER);
+    EXPECT_FALSE(flowControl.Acknowledge(config, 0));
+    EXPECT_TRUE(flowControl.TryAcquire(config, CreateRecord("event", 1)));
+    flowControl.OnSent(true);
+    EXPECT_TRUE(flowControl.TryAcquire(config, CreateRecord("event", 2)));
+    flowControl.OnSent(true);
+    EXPECT_FALSE(flowControl.TryAcquire(config, CreateRecord("event", 3)));
+    EXPECT_FALSE(flowControl.TryAcquire(config, CreateRecord("event", 4)));
+    // backlog is full, the newest event is dropped
+    EXPECT_FALSE(flowControl.TryAcquire(config, CreateRecord("event", 5)));
+    EXPECT_EQ(flowControl.dropped_, 1);
+
+    EXPECT_TRUE(flowControl.Acknowledge(config, 1));
+    auto record = flowControl.TakeDeferred(config);
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->commonEventData->GetCode(), 3);
+    flowControl.OnSent(true);
+    EXPECT_EQ(flowControl.TakeDeferred(config), nullptr);
+    EXPECT_FALSE(flowControl.draining_);
+
+    EXPECT_TRUE(flowControl.Acknowledge(config, 2));
+    // a new event waits behind the backlog being drained
+    EXPECT_FALSE(flowControl.TryAcquire(config, CreateRecord("event", 6)));
+    record = flowControl.TakeDeferred(config);
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->commonEventData->GetCode(), 4);
+    flowControl.OnSent(true);
+    record = flowControl.TakeDeferred(config);
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->commonEventData->GetCode(), 6);
+    flowControl.OnSent(true);
+    EXPECT_EQ(flowControl.TakeDeferred(config), nullptr);
+    EXPECT_EQ(flowControl.Dump(),
+        "Sent: 5 Acked: 3 Reclaimed: 0 InFlight: 2 Backlog: 0 Deferred: 4 Dropped: 1 Coalesced: 0");
+}
+
+/*
+ * @tc.number: SubscriberFlowControl_0300
+ * @tc.name: TryAcquire
+ * @tc.desc: Verify the drop oldest and coalesce policies when the subscriber is out of credit.
+ */
+HWTEST_F(SubscriberFlowControlTest, SubscriberFlowControl_0300, Level1)
+{
+    SubscriberFlowControl dropOldest;
+    auto config = CreateConfig(SubscriberFlowControl::DROP_OLDEST);
+    dropOldest.Acknowledge(config, 0);
+    for (int32_t i = 0; i < 5; ++i) {
+        dropOldest.TryAcquire(config, CreateRecord("event", i));
+    }
+    ASSERT_EQ(dropOldest.backlog_.size(), 2);
+    EXPECT_EQ(dropOldest.backlog_[0]->commonEventData->GetCode(), 3);
+    EXPECT_EQ(dropOldest.backlog_[1]->commonEventData->GetCode(), 4);
+    EXPECT_EQ(dropOldest.dropped_, 1);
+
+    SubscriberFlowControl coalesce;
+    config = CreateConfig(SubscriberFlowControl::COALESCE);
+    coalesce.Acknowledge(config, 0);
+    for (int32_t i = 0; i < 5; ++i) {
+        coalesce.TryAcquire(config, CreateRecord(i % 2 == 0 ? "battery" : "network", i));
+    }
+    ASSERT_EQ(coalesce.backlog_.size(), 2);
+    EXPECT_EQ(coalesce.backlog_[0]->commonEventData->GetCode(), 3);
+    EXPECT_EQ(coalesce.backlog_[1]->commonEventData->GetCode(), 4);
+    EXPECT_EQ(coalesce.coalesced_, 1);
+    EXPECT_EQ(coalesce.dropped_, 0);
+}
+
+/*
+ * @tc.number: SubscriberFlowControl_0400
+ * @tc.name: OnAckTimeout
+ * @tc.desc: Verify unacknowledged credit is reclaimed after the ack timeout and the counters never go back.
+ */
+HWTEST_F(SubscriberFlowControlTest, SubscriberFlowControl_0400, Level1)
+{
+    SubscriberFlowControl flowControl;
+    auto config = CreateConfig(SubscriberFlowControl::DEFER);
+    config.ackTimeoutMs = 0;
+    flowControl.Acknowledge(config, 0);
+    EXPECT_FALSE(flowControl.StartAckTimer());
+    for (int32_t i = 0; i < 2; ++i) {
+        EXPECT_TRUE(flowControl.TryAcquire(config, CreateRecord("event", i)));
+        flowControl.OnSent(true);
+    }
+    EXPECT_FALSE(flowControl.TryAcquire(config, CreateRecord("event", 2)));
+    EXPECT_TRUE(flowControl.StartAckTimer());
+    EXPECT_FALSE(flowControl.StartAckTimer());
+
+    // the subscriber dropped both events without acknowledging them
+    EXPECT_TRUE(flowControl.OnAckTimeout(config));
+    EXPECT_EQ(flowControl.reclaimed_, MAX_IN_FLIGHT);
+    auto record = flowControl.TakeDeferred(config);
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->commonEventData->GetCode(), 2);
+    flowControl.Release();
+    EXPECT_EQ(flowControl.TakeDeferred(config), nullptr);
+    EXPECT_EQ(flowControl.sent_.load(), MAX_IN_FLIGHT);
+    EXPECT_EQ(flowControl.inFlight_, 0);
+
+    EXPECT_TRUE(flowControl.TryAcquire(config, CreateRecord("event", 0)));
+    flowControl.Close();
+    EXPECT_EQ(flowControl.reclaimed_, MAX_IN_FLIGHT + 1);
+    EXPECT_EQ(flowControl.inFlight_, 0);
+}
+}  // namespace EventFwk
+}  // namespace OHOS
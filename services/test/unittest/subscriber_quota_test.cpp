@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#include "subscriber_quota.h"
+#undef private
+
+namespace OHOS {
+namespace EventFwk {
+using namespace testing::ext;
+
+namespace {
+constexpr uint32_t MAX_TOTAL = 10;
+constexpr uint32_t MAX_PER_UID = 3;
+constexpr uid_t TEST_UID = 20010001;
+}
+
+class SubscriberQuotaTest : public testing::Test {
+public:
+    SubscriberQuotaTest()
+    {}
+    ~SubscriberQuotaTest()
+    {}
+
+    static void SetUpTestCase(void)
+    {}
+    static void TearDownTestCase(void)
+    {}
+    void SetUp()
+    {}
+    void TearDown()
+    {}
+};
+
+/*
+ * @tc.number: SubscriberQuota_0100
+ * @tc.name: GetTopPids
+ * @tc.desc: Verify the ranking follows additions and removals.
+ */
+HWTEST_F(SubscriberQuotaTest, SubscriberQuota_0100, Level1)
+{
+    SubscriberQuota quota;
+    quota.SetLimits(MAX_TOTAL, 0);
+    quota.Add(100, TEST_UID);
+    quota.Add(200, TEST_UID);
+    quota.Add(200, TEST_UID);
+    quota.Add(300, TEST_UID);
+    quota.Add(300, TEST_UID);
+    quota.Add(300, TEST_UID);
+
+    auto top = quota.GetTopPids(2);
+    ASSERT_EQ(top.size(), 2);
+    EXPECT_EQ(top[0], std::make_pair(300, 3U));
+    EXPECT_EQ(top[1], std::make_pair(200, 2U));
+
+    quota.Remove(300, TEST_UID);
+    quota.Remove(300, TEST_UID);
+    quota.Remove(400, TEST_UID);
+    top = quota.GetTopPids(1);
+    ASSERT_EQ(top.size(), 1);
+    EXPECT_EQ(top[0], std::make_pair(200, 2U));
+    EXPECT_EQ(quota.GetTotal(), 4);
+    EXPECT_EQ(quota.pidRanking_.size(), quota.pidCounts_.size());
+
+    quota.Remove(100, TEST_UID);
+    EXPECT_EQ(quota.pidCounts_.count(100), 0);
+    EXPECT_EQ(quota.GetTopPids(10).size(), 2);
+}
+
+/*
+ * @tc.number: SubscriberQuota_0200
+ * @tc.name: Check
+ * @tc.desc: Verify a uid at its quota is rejected only when the quota applies to it.
+ */
+HWTEST_F(SubscriberQuotaTest, SubscriberQuota_0200, Level1)
+{
+    SubscriberQuota quota;
+    quota.SetLimits(MAX_TOTAL, MAX_PER_UID);
+    for (pid_t pid = 100; pid < 100 + static_cast<pid_t>(MAX_PER_UID); ++pid) {
+        EXPECT_EQ(quota.Check(TEST_UID, true), SubscriberQuota::ALLOWED);
+        quota.Add(pid, TEST_UID);
+    }
+    EXPECT_EQ(quota.GetUidCount(TEST_UID), MAX_PER_UID);
+    EXPECT_EQ(quota.Check(TEST_UID, true), SubscriberQuota::UID_QUOTA_EXCEEDED);
+    EXPECT_EQ(quota.Check(TEST_UID, false), SubscriberQuota::ALLOWED);
+    EXPECT_EQ(quota.Check(TEST_UID + 1, true), SubscriberQuota::ALLOWED);
+
+    quota.Remove(100, TEST_UID);
+    EXPECT_EQ(quota.Check(TEST_UID, true), SubscriberQuota::ALLOWED);
+
+    // 0 disables the quota
+    quota.SetLimits(MAX_TOTAL, 0);
+    quota.Add(100, TEST_UID);
+    EXPECT_EQ(quota.Check(TEST_UID, true), SubscriberQuota::ALLOWED);
+}
+
+/*
+ * @tc.number: SubscriberQuota_0300
+ * @tc.name: Check
+ * @tc.desc: Verify the alarm threshold and the limit are reported when the total reaches them.
+ */
+HWTEST_F(SubscriberQuotaTest, SubscriberQuota_0300, Level1)
+{
+    SubscriberQuota quota;
+    quota.SetLimits(MAX_TOTAL, 0);
+    pid_t pid = 100;
+    while (quota.GetTotal() < quota.warningTotal_) {
+        EXPECT_EQ(quota.Check(TEST_UID, true), SubscriberQuota::ALLOWED);
+        quota.Add(pid++, TEST_UID);
+    }
+    EXPECT_EQ(quota.Check(TEST_UID, true), SubscriberQuota::WARNING);
+    while (quota.GetTotal() < MAX_TOTAL) {
+        quota.Add(pid++, TEST_UID);
+    }
+    EXPECT_EQ(quota.Check(TEST_UID, true), SubscriberQuota::LIMIT_REACHED);
+
+    quota.Clear();
+    EXPECT_EQ(quota.GetTotal(), 0);
+    EXPECT_TRUE(quota.GetTopPids(1).empty());
+    EXPECT_EQ(quota.GetUidCount(TEST_UID), 0);
+}
+}  // namespace EventFwk
+}  // namespace OHOS
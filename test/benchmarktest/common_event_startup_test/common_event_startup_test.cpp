@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define private public
+#include "common_event_constant.h"
+#include "common_event_manager_service.h"
+#include "common_event_permission_manager.h"
+#include "common_event_support.h"
+#include "mock_bundle_manager.h"
+
+using namespace OHOS;
+using namespace OHOS::EventFwk;
+
+namespace {
+const std::string EVENT_NAME = "STARTUP_EVENT_BENCHMARK";
+constexpr int32_t USER_ID = 100;
+
+/**
+ * Runs the start path in a forked child, the tables built on first use are process wide statics and singletons,
+ * so only a fresh process measures a cold start.
+ *
+ * @param startPath Indicates the steps to time, returns false on failure.
+ * @param seconds Indicates the output time spent in startPath.
+ * @return Returns true if startPath succeeded in the child.
+ */
+template<typename Function>
+bool RunInFreshProcess(Function startPath, double &seconds)
+{
+    int fds[2] = {-1, -1};
+    if (pipe(fds) != 0) {
+        return false;
+    }
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        auto start = std::chrono::steady_clock::now();
+        bool result = startPath();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        elapsed = result ? elapsed : -1.0;
+        ssize_t written = write(fds[1], &elapsed, sizeof(elapsed));
+        _exit(written == sizeof(elapsed) ? 0 : 1);
+    }
+    close(fds[1]);
+    double elapsed = -1.0;
+    ssize_t size = read(fds[0], &elapsed, sizeof(elapsed));
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (size != sizeof(elapsed) || elapsed < 0) {
+        return false;
+    }
+    seconds = elapsed;
+    return true;
+}
+
+class BenchmarkCommonEventStartup : public benchmark::Fixture {
+public:
+    BenchmarkCommonEventStartup()
+    {
+        Iterations(iterations);
+        Repetitions(repetitions);
+        ReportAggregatesOnly();
+        UseManualTime();
+    }
+
+    ~BenchmarkCommonEventStartup() override = default;
+
+    void SetUp(const ::benchmark::State &state) override
+    {}
+    void TearDown(const ::benchmark::State &state) override
+    {}
+
+protected:
+    const int32_t repetitions = 3;
+    const int32_t iterations = 20;
+};
+
+/**
+ * @tc.name: CommonEventStartupTestCase001
+ * @tc.desc: Init and the tables built on first use: time of the OnStart path until the service is ready, plus the
+ *           first system event and permission lookups, each in a fresh process
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+BENCHMARK_F(BenchmarkCommonEventStartup, CommonEventStartupTestCase001)(benchmark::State &state)
+{
+    std::string event = EVENT_NAME;
+    while (state.KeepRunning()) {
+        double seconds = 0;
+        bool result = RunInFreshProcess([&event]() {
+            sptr<CommonEventManagerService> service = new CommonEventManagerService();
+            if (service->Init() != ERR_OK || !service->IsReady()) {
+                return false;
+            }
+            DelayedSingleton<CommonEventSupport>::GetInstance()->IsSystemEvent(event);
+            DelayedSingleton<CommonEventPermissionManager>::GetInstance()->GetEventPermission(event);
+            return true;
+        }, seconds);
+        if (!result) {
+            state.SkipWithError("Init failed.");
+            break;
+        }
+        state.SetIterationTime(seconds);
+    }
+}
+
+/**
+ * @tc.name: CommonEventStartupTestCase002
+ * @tc.desc: Init and PublishCommonEvent: time from OnStart until the first publish is accepted, each in a fresh
+ *           process
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+BENCHMARK_F(BenchmarkCommonEventStartup, CommonEventStartupTestCase002)(benchmark::State &state)
+{
+    Want want;
+    want.SetAction(EVENT_NAME);
+    CommonEventData data(want);
+    CommonEventPublishInfo publishInfo;
+    struct tm recordTime = {0};
+
+    while (state.KeepRunning()) {
+        double seconds = 0;
+        bool result = RunInFreshProcess([&data, &publishInfo, &recordTime]() {
+            sptr<CommonEventManagerService> service = new CommonEventManagerService();
+            if (service->Init() != ERR_OK || !service->IsReady()) {
+                return false;
+            }
+            return service->innerCommonEventManager_->PublishCommonEvent(data, publishInfo, nullptr, recordTime,
+                0, 0, 0, USER_ID, "bundlename");
+        }, seconds);
+        if (!result) {
+            state.SkipWithError("Init or PublishCommonEvent failed.");
+            break;
+        }
+        state.SetIterationTime(seconds);
+    }
+}
+}
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -29,7 +29,8 @@ constexpr char HELP_MSG[] =
     "These are common cem commands list:\n"
     "  help                         list available commands\n"
     "  publish                      publish a common event with options\n"
-    "  dump                         dump the info of events\n";
+    "  dump                         dump the info of events\n"
+    "  stats                        dump the state of the service as json\n";
 
 constexpr char HELP_MSG_PUBLISH[] =
     "usage: cem publish [<options>]\n"
@@ -49,7 +50,16 @@ constexpr char HELP_MSG_DUMP[] =
     "       subscriber              all subscribers\n"
     "       sticky                  sticky events\n"
     "       pending                 pending events\n"
-    "       history                 history events\n";
+    "       history                 history events\n"
+    "       metrics                 publish latency per stage\n"
+    "       memory                  estimated memory of the subscribers\n";
+
+constexpr char HELP_MSG_STATS[] =
+    "usage: cem stats [<options>]\n"
+    "options list:\n"
+    "  -h, --help                   list available commands\n"
+    "  -e, --event <name>           dump the state filter by the specified event\n"
+    "  -u, --user-id <userId>       dump the state filter by the specified userId\n";
 
 constexpr char HELP_MSG_NO_EVENT_OPTION[] = "error: you must specify an event name with '-e' or '--event'.\n";
 constexpr char STRING_PUBLISH_COMMON_EVENT_OK[] = "publish the common event successfully.\n";
@@ -57,6 +67,8 @@ constexpr char STRING_PUBLISH_COMMON_EVENT_NG[] = "error: failed to publish the
 constexpr char STRING_DUMP_COMMON_EVENT_NG[] = "error: failed to dump the common event(s).\n";
 constexpr char USER_PUBLISH_COMMON_EVENT_NG[] = "error: user version cannot publish common events.\n";
 constexpr char USER_DUMP_COMMON_EVENT_NG[] = "error: user version cannot use dump.\n";
+// the keys of a structured dump are sorted, an error object is the only one starting with "error"
+constexpr char STRING_STRUCTURED_DUMP_ERROR[] = "{\"error\":";
 }  // namespace
 
 struct PublishCmdInfo {
@@ -84,6 +96,7 @@ private:
     ErrCode RunAsHelpCommand();
     ErrCode RunAsPublishCommand();
     ErrCode RunAsDumpCommand();
+    ErrCode RunAsStatsCommand();
     void CheckPublishOpt();
     void SetPublishCmdInfo(PublishCmdInfo &cmdInfo, ErrCode &result, bool &hasOption);
 #ifdef CEM_SUPPORT_DUMP
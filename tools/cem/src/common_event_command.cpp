@@ -45,6 +45,7 @@ ErrCode CommonEventCommand::CreateCommandMap()
         {"help", std::bind(&CommonEventCommand::RunAsHelpCommand, this)},
         {"publish", std::bind(&CommonEventCommand::RunAsPublishCommand, this)},
         {"dump", std::bind(&CommonEventCommand::RunAsDumpCommand, this)},
+        {"stats", std::bind(&CommonEventCommand::RunAsStatsCommand, this)},
     };
     return ERR_OK;
 }
@@ -196,6 +197,41 @@ ErrCode CommonEventCommand::RunAsDumpCommand()
 #endif
 }
 
+ErrCode CommonEventCommand::RunAsStatsCommand()
+{
+#ifdef CEM_SUPPORT_DUMP
+    EVENT_LOGI(LOG_TAG_CES, "enter");
+    ErrCode result = ERR_OK;
+    bool hasOption = false;
+    DumpCmdInfo cmdInfo;
+    SetDumpCmdInfo(cmdInfo, result, hasOption);
+    // the whole state is structured at once, a part cannot be chosen
+    if (result != ERR_OK || cmdInfo.eventType != DumpEventType::ALL) {
+        resultReceiver_.append(HELP_MSG_STATS);
+        return ERR_INVALID_VALUE;
+    }
+    std::vector<std::string> dumpResults;
+    bool dumpResult = CommonEvent::GetInstance()->DumpState(
+        static_cast<int32_t>(DumpEventType::STRUCTURED), cmdInfo.action, cmdInfo.userId, dumpResults);
+    if (!dumpResult || dumpResults.empty()) {
+        resultReceiver_ = STRING_DUMP_COMMON_EVENT_NG;
+        return ERR_INVALID_VALUE;
+    }
+    // the service sends the dump back in slices to keep each reply small
+    for (const auto &slice : dumpResults) {
+        resultReceiver_.append(slice);
+    }
+    resultReceiver_.append("\n");
+    if (dumpResults.front().rfind(STRING_STRUCTURED_DUMP_ERROR, 0) == 0) {
+        return ERR_INVALID_VALUE;
+    }
+    return ERR_OK;
+#else
+    resultReceiver_.append(USER_DUMP_COMMON_EVENT_NG);
+    return ERR_INVALID_VALUE;
+#endif
+}
+
 #ifdef CEM_SUPPORT_DUMP
 void CommonEventCommand::SetDumpCmdInfo(DumpCmdInfo &cmdInfo, ErrCode &result, bool &hasOption)
 {
@@ -251,6 +287,10 @@ void CommonEventCommand::CheckDumpEventType(DumpCmdInfo &cmdInfo, ErrCode &resul
         cmdInfo.eventType = DumpEventType::PENDING;
     } else if (strcmp(optarg, "history") == 0) {
         cmdInfo.eventType = DumpEventType::HISTORY;
+    } else if (strcmp(optarg, "metrics") == 0) {
+        cmdInfo.eventType = DumpEventType::METRICS;
+    } else if (strcmp(optarg, "memory") == 0) {
+        cmdInfo.eventType = DumpEventType::MEMORY;
     } else {
         resultReceiver_.append("error: option 'p' requires a value.\n");
         result = ERR_INVALID_VALUE;
@@ -230,5 +230,22 @@ ErrCode MockCommonEventStub::SetFreezeStatus(
     funcResult = ERR_OK;
     return ERR_OK;
 }
+
+ErrCode MockCommonEventStub::NegotiateWireFormat(
+    int32_t version,
+    int32_t& funcResult)
+{
+    EVENT_LOGD(LOG_TAG_CES, "enter");
+    funcResult = version;
+    return ERR_OK;
+}
+
+ErrCode MockCommonEventStub::AckEvents(
+    const sptr<IRemoteObject>& commonEventListener,
+    uint32_t count)
+{
+    EVENT_LOGD(LOG_TAG_CES, "enter");
+    return ERR_OK;
+}
 } // namespace EventFwk
 } // namespace OHOS
@@ -123,6 +123,14 @@ public:
         bool isFreeze,
         bool& funcResult) override;
 
+    ErrCode NegotiateWireFormat(
+        int32_t version,
+        int32_t& funcResult) override;
+
+    ErrCode AckEvents(
+        const sptr<IRemoteObject>& commonEventListener,
+        uint32_t count) override;
+
 private:
     static std::mutex instanceMutex_;
     static sptr<MockCommonEventStub> instance_;